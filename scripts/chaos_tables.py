@@ -0,0 +1,133 @@
+"""Generate src/modes/mode_chaos_tables.c: precomputed attractor orbits for Chaos mode playback.
+
+Each attractor is integrated offline with fixed-step RK4. Threshold crossings on the same ten
+streams as the live engine (2A-6A on x, 2B-6B on y/z) are interpolated inside their step and stored
+as varint deltas in 1/SUBSTEPS of a step, so the firmware walks one pointer per event.
+
+Usage: python scripts/chaos_tables.py   (rewrites the C file; commit the result)
+"""
+import os
+
+SUBSTEPS = 16          # Must match CHAOS_TABLE_SUBSTEPS in mode_chaos_tables.h
+ORBIT_STEPS = 16384    # Steps per stored orbit; playback loops the orbit
+WARMUP_STEPS = 3000    # Transient dropped before recording
+
+OUT = os.path.join(os.path.dirname(__file__), "..", "src", "modes", "mode_chaos_tables.c")
+
+
+def lorenz(s):
+    x, y, z = s
+    return (10.0 * (y - x), x * (28.0 - z) - y, x * y - (8.0 / 3.0) * z)
+
+
+def rossler(s):
+    x, y, z = s
+    return (-y - z, x + 0.2 * y, 0.2 + z * (x - 5.7))
+
+
+def chua(s):
+    x, y, z = s
+    m0, m1 = -1.143, -0.714
+    fx = m1 * x + 0.5 * (m0 - m1) * (abs(x + 1.0) - abs(x - 1.0))
+    return (15.6 * (y - x - fx), x - y + z, -28.0 * y)
+
+
+# name, derivative, initial state, dt, steps per beat, x thresholds (A), (y|z, threshold) pairs (B)
+ATTRACTORS = [
+    ("lorenz", lorenz, (0.1, 0.0, 0.0), 0.01, 25,
+     (5.0, 10.0, 15.0, -5.0, -10.0),
+     (("y", 10.0), ("z", 20.0), ("y", -10.0), ("z", 30.0), ("z", 10.0))),
+    ("rossler", rossler, (1.0, 1.0, 0.0), 0.05, 30,
+     (2.0, 5.0, 8.0, -3.0, -6.0),
+     (("y", 2.0), ("z", 1.0), ("y", -4.0), ("z", 8.0), ("z", 15.0))),
+    ("chua", chua, (0.7, 0.0, 0.0), 0.01, 50,
+     (0.5, 1.0, 1.5, -0.5, -1.0),
+     (("y", 0.1), ("z", 1.0), ("y", -0.1), ("z", 2.5), ("z", -1.0))),
+]
+
+
+def rk4(f, s, h):
+    k1 = f(s)
+    k2 = f(tuple(s[i] + 0.5 * h * k1[i] for i in range(3)))
+    k3 = f(tuple(s[i] + 0.5 * h * k2[i] for i in range(3)))
+    k4 = f(tuple(s[i] + h * k3[i] for i in range(3)))
+    return tuple(s[i] + h / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]) for i in range(3))
+
+
+def crossed(cur, prev, th):
+    # Same rule as crossed_threshold() in mode_chaos.c: either direction
+    return (prev < th <= cur) or (prev > th >= cur)
+
+
+def varint(n):
+    out = []
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return out
+
+
+def streams_for(f, s, h, x_th, yz_th):
+    for _ in range(WARMUP_STEPS):
+        s = rk4(f, s, h)
+    probes = [(0, th) for th in x_th] + [(1 if v == "y" else 2, th) for v, th in yz_th]
+    events = [[] for _ in probes]
+    for step in range(ORBIT_STEPS):
+        prev = s
+        s = rk4(f, s, h)
+        for i, (axis, th) in enumerate(probes):
+            if crossed(s[axis], prev[axis], th):
+                frac = (th - prev[axis]) / (s[axis] - prev[axis])
+                sub = step * SUBSTEPS + min(SUBSTEPS - 1, max(0, int(frac * SUBSTEPS)))
+                events[i].append(sub)
+    return events
+
+
+def main():
+    lines = [
+        "/* Generated by scripts/chaos_tables.py - do not edit. */",
+        '#include "mode_chaos_tables.h"',
+        "",
+    ]
+    descriptors = []
+    total = 0
+    for name, f, s0, h, spb, x_th, yz_th in ATTRACTORS:
+        events = streams_for(f, s0, h, x_th, yz_th)
+        stream_refs = []
+        for i, ev in enumerate(events):
+            data, last = [], 0
+            for t in ev:
+                data += varint(t - last)
+                last = t
+            total += len(data)
+            sym = "%s_stream_%d" % (name, i)
+            lines.append("static const uint8_t %s[%d] = {" % (sym, max(1, len(data))))
+            body = data or [0]
+            for k in range(0, len(body), 16):
+                lines.append("    " + ", ".join("0x%02X" % b for b in body[k:k + 16]) + ",")
+            lines.append("};")
+            stream_refs.append("{ %s, %du }" % (sym, len(ev)))
+        descriptors.append((name, spb, stream_refs))
+        lines.append("")
+
+    lines.append("const chaos_table_t chaos_tables[CHAOS_TABLE_NUM_ATTRACTORS] = {")
+    for name, spb, refs in descriptors:
+        lines.append("    { /* %s */" % name)
+        lines.append("        %du * CHAOS_TABLE_SUBSTEPS, %du," % (ORBIT_STEPS, spb))
+        lines.append("        {")
+        for r in refs:
+            lines.append("            %s," % r)
+        lines.append("        },")
+        lines.append("    },")
+    lines.append("};")
+    with open(OUT, "w", newline="\n") as fh:
+        fh.write("\n".join(lines) + "\n")
+    print("wrote %s (%d bytes of event data)" % (os.path.normpath(OUT), total))
+
+
+if __name__ == "__main__":
+    main()
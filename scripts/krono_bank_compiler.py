@@ -0,0 +1,261 @@
+"""Compile drum patterns into a Krono user pattern-bank image (flash sector 6, read in place).
+
+Inputs are text pattern files or Standard MIDI Files; every bank becomes one Fixed-mode bank after
+the built-in ones. The image layout is pattern_bank_header_t / pattern_bank_record_t in
+src/drivers/pattern_bank.h.
+
+Text format (one bank per `bank` line; '#' starts a comment):
+
+    bank Techno turnaround
+    steps 32                      # optional; default is the longest track
+    2A x...x...x...x... x.x.x...x...x...
+    3A ....x.......x...           # shorter tracks repeat to fill the bank
+    6A xxxxxxxxxxxxxxxx
+
+Hits are x X 1 *, rests . - 0 _; spaces and | are ignored. Jacks are 2A 2B 3A 3B 4A 4B 5A 5B 6A 6B.
+
+MIDI notes (channel 10 by default) are quantized to 16ths, mapped from General MIDI drums to the
+Fixed-mode layout (2=kick, 3=snare, 4=clap/toms, 5=open hat, 6=closed hat/cymbals) and cut into
+banks of --steps steps; empty banks are skipped.
+
+Usage:
+    python scripts/krono_bank_compiler.py grooves.txt fills.mid -o banks.bin
+    python scripts/krono_bank_compiler.py --dump banks.bin
+    dfu-util -a 0 -s 0x08040000 -D banks.bin
+"""
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x4B4E424B          # Must match PATTERN_BANK_MAGIC
+VERSION = 1                 # Must match PATTERN_BANK_VERSION
+FLASH_ADDR = 0x08040000     # PATTERN_BANK_FLASH_ADDR
+FLASH_SIZE = 128 * 1024     # PATTERN_BANK_FLASH_SIZE
+MAX_STEPS = 64              # PATTERN_BANK_MAX_STEPS
+STEPS_PER_BEAT = 4          # MODE_RHYTHM_STEPS_PER_BEAT in src/variables.h
+BUILTIN_BANKS = 12          # NUM_FIXED_BANKS: image bank 0 is Fixed bank 12
+MAX_NAME = 255
+
+JACKS = ["2A", "2B", "3A", "3B", "4A", "4B", "5A", "5B", "6A", "6B"]  # mode_rhythm_jacks order
+HIT, REST = set("xX1*"), set(".-0_")
+
+# General MIDI drum note -> track
+GM_DRUMS = {
+    36: "2A", 35: "2B",
+    38: "3A", 40: "3A", 37: "3B",
+    39: "4A", 41: "4B", 43: "4B", 45: "4B", 47: "4B", 48: "4B", 50: "4B",
+    46: "5A", 44: "5B",
+    42: "6A", 49: "6B", 51: "6B", 52: "6B", 53: "6B", 55: "6B", 57: "6B", 59: "6B",
+}
+
+
+class Bank:
+    def __init__(self, name):
+        self.name = name
+        self.steps = 0
+        self.tracks = {}    # jack -> list of bools
+
+    def finish(self, where):
+        longest = max((len(t) for t in self.tracks.values()), default=0)
+        steps = self.steps or -(-longest // STEPS_PER_BEAT) * STEPS_PER_BEAT
+        if steps <= 0 or steps > MAX_STEPS or steps % STEPS_PER_BEAT:
+            raise ValueError("%s: bank '%s' has %d steps (need a multiple of %d up to %d)"
+                             % (where, self.name, steps, STEPS_PER_BEAT, MAX_STEPS))
+        self.steps = steps
+        for jack, t in self.tracks.items():
+            if len(t) > steps:
+                raise ValueError("%s: bank '%s' track %s is longer than %d steps"
+                                 % (where, self.name, jack, steps))
+            self.tracks[jack] = [t[s % len(t)] for s in range(steps)] if t else [False] * steps
+        return self
+
+
+def parse_text(path):
+    banks, bank = [], None
+    with open(path, encoding="utf-8") as fh:
+        for n, raw in enumerate(fh, 1):
+            where = "%s:%d" % (path, n)
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+            word, _, rest = line.partition(" ")
+            key = word.upper()
+            if word.lower() == "bank":
+                if bank:
+                    banks.append(bank.finish(where))
+                bank = Bank(rest.strip() or "%s %d" % (os.path.basename(path), len(banks)))
+            elif bank is None:
+                raise ValueError("%s: expected 'bank' first" % where)
+            elif word.lower() == "steps":
+                bank.steps = int(rest)
+            elif key in JACKS:
+                cells = []
+                for c in rest:
+                    if c in HIT:
+                        cells.append(True)
+                    elif c in REST:
+                        cells.append(False)
+                    elif c not in " \t|":
+                        raise ValueError("%s: bad step character %r" % (where, c))
+                bank.tracks[key] = cells
+            else:
+                raise ValueError("%s: unknown jack or keyword '%s'" % (where, word))
+    if bank:
+        banks.append(bank.finish(path))
+    return banks
+
+
+def read_varlen(data, pos):
+    value = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value = (value << 7) | (b & 0x7F)
+        if not b & 0x80:
+            return value, pos
+
+
+def midi_hits(path, channel):
+    """(ticks per quarter, [(tick, note)]) for note-ons on `channel` across all tracks."""
+    with open(path, "rb") as fh:
+        data = fh.read()
+    if data[:4] != b"MThd":
+        raise ValueError("%s: not a Standard MIDI File" % path)
+    hlen, _fmt, ntracks, division = struct.unpack(">IHHH", data[4:14])
+    if division & 0x8000:
+        raise ValueError("%s: SMPTE time division is not supported" % path)
+    pos, hits = 8 + hlen, []
+    for _ in range(ntracks):
+        if data[pos:pos + 4] != b"MTrk":
+            raise ValueError("%s: missing track chunk" % path)
+        tlen = struct.unpack(">I", data[pos + 4:pos + 8])[0]
+        pos, end, tick, status = pos + 8, pos + 8 + tlen, 0, 0
+        while pos < end:
+            delta, pos = read_varlen(data, pos)
+            tick += delta
+            if data[pos] & 0x80:
+                status = data[pos]
+                pos += 1
+            if status == 0xFF:                      # Meta event
+                pos += 1
+                length, pos = read_varlen(data, pos)
+                pos += length
+            elif status in (0xF0, 0xF7):            # SysEx
+                length, pos = read_varlen(data, pos)
+                pos += length
+            else:
+                kind, ch = status & 0xF0, status & 0x0F
+                size = 1 if kind in (0xC0, 0xD0) else 2
+                if kind == 0x90 and ch == channel and data[pos + 1] > 0:
+                    hits.append((tick, data[pos]))
+                pos += size
+        pos = end
+    return division, hits
+
+
+def parse_midi(path, steps, channel):
+    division, hits = midi_hits(path, channel)
+    per_step = division / float(STEPS_PER_BEAT)
+    banks = {}
+    for tick, note in hits:
+        jack = GM_DRUMS.get(note)
+        if jack is None:
+            continue
+        step = int(round(tick / per_step))
+        index, s = divmod(step, steps)
+        bank = banks.setdefault(index, {})
+        bank.setdefault(jack, [False] * steps)[s] = True
+    stem = os.path.splitext(os.path.basename(path))[0]
+    out = []
+    for index in sorted(banks):
+        b = Bank("%s %d" % (stem, index + 1))
+        b.steps, b.tracks = steps, banks[index]
+        out.append(b.finish(path))
+    return out
+
+
+def encode(banks):
+    records = []
+    for b in banks:
+        name = b.name.encode("utf-8")[:MAX_NAME]
+        used = [j for j in JACKS if any(b.tracks.get(j, []))]
+        count = JACKS.index(used[-1]) + 1 if used else 0   # Trailing silent tracks are dropped
+        rec = bytearray(struct.pack("<BBBB", b.steps, count, len(name), 0))
+        for jack in JACKS[:count]:
+            bits = 0
+            for s, on in enumerate(b.tracks.get(jack, [])):
+                if on:
+                    bits |= 1 << s
+            rec += bits.to_bytes((b.steps + 7) // 8, "little")
+        rec += name
+        records.append(bytes(rec))
+
+    header_size = 16
+    offset = header_size + 4 * len(records)
+    table, body = bytearray(), bytearray()
+    for rec in records:
+        table += struct.pack("<I", offset + len(body))
+        body += rec
+    payload = bytes(table + body)
+    size = header_size + len(payload)
+    if size > FLASH_SIZE:
+        raise ValueError("image is %d bytes; the bank region holds %d" % (size, FLASH_SIZE))
+    if len(records) > 0xFFFF:
+        raise ValueError("too many banks (%d)" % len(records))
+    header = struct.pack("<IHHII", MAGIC, VERSION, len(records), size, sum(payload) & 0xFFFFFFFF)
+    return header + payload
+
+
+def dump(path):
+    with open(path, "rb") as fh:
+        img = fh.read()
+    magic, version, count, size, checksum = struct.unpack("<IHHII", img[:16])
+    ok = magic == MAGIC and version == VERSION and size == len(img) and \
+        (sum(img[16:]) & 0xFFFFFFFF) == checksum
+    print("%s: %d banks, %d bytes, %s" % (path, count, size, "valid" if ok else "INVALID"))
+    for i in range(count):
+        off = struct.unpack("<I", img[16 + 4 * i:20 + 4 * i])[0]
+        steps, tracks, name_len, _ = img[off:off + 4]
+        nbytes = (steps + 7) // 8
+        name = img[off + 4 + tracks * nbytes:off + 4 + tracks * nbytes + name_len].decode("utf-8", "replace")
+        print("  bank %d (Fixed %d): %s, %d steps" % (i, i + BUILTIN_BANKS, name, steps))
+        for t in range(tracks):
+            bits = int.from_bytes(img[off + 4 + t * nbytes:off + 4 + (t + 1) * nbytes], "little")
+            print("    %s %s" % (JACKS[t], "".join("x" if bits >> s & 1 else "." for s in range(steps))))
+    return 0 if ok else 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build a Krono pattern-bank image for DFU upload.")
+    ap.add_argument("inputs", nargs="*", help="text pattern files and/or .mid files")
+    ap.add_argument("-o", "--output", default="banks.bin", help="image to write (default banks.bin)")
+    ap.add_argument("--steps", type=int, default=16, help="steps per bank for MIDI input (default 16)")
+    ap.add_argument("--channel", type=int, default=10, help="MIDI drum channel, 1-16 (default 10)")
+    ap.add_argument("--dump", metavar="IMAGE", help="print the banks of an existing image and exit")
+    args = ap.parse_args()
+
+    if args.dump:
+        return dump(args.dump)
+    if not args.inputs:
+        ap.error("no input files")
+    banks = []
+    try:
+        for path in args.inputs:
+            if path.lower().endswith((".mid", ".midi")):
+                banks += parse_midi(path, args.steps, args.channel - 1)
+            else:
+                banks += parse_text(path)
+        image = encode(banks)
+    except (OSError, ValueError) as e:
+        print("error: %s" % e, file=sys.stderr)
+        return 1
+    with open(args.output, "wb") as fh:
+        fh.write(image)
+    print("wrote %s: %d banks, %d of %d bytes" % (args.output, len(banks), len(image), FLASH_SIZE))
+    print("upload: dfu-util -a 0 -s 0x%08X -D %s" % (FLASH_ADDR, args.output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
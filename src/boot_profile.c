@@ -0,0 +1,41 @@
+#include "boot_profile.h"
+#include "util/cycle_counter.h"
+
+#include <libopencm3/stm32/rcc.h>
+
+volatile boot_profile_t g_boot_profile;
+
+static uint32_t last_mark_cycles = 0;
+static uint32_t elapsed_us = 0;
+static uint32_t cycles_per_us = 16; // Core clock of the running segment (HSI at reset)
+
+// Fold the cycles since the last mark into elapsed_us at the clock they ran at
+static void accumulate(void) {
+    uint32_t now = cycle_counter_now();
+    elapsed_us += (now - last_mark_cycles) / cycles_per_us;
+    last_mark_cycles = now;
+}
+
+void boot_profile_start(void) {
+    cycle_counter_enable();
+    last_mark_cycles = cycle_counter_now();
+    elapsed_us = 0;
+    cycles_per_us = rcc_ahb_frequency / 1000000u;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+}
+
+void boot_profile_clock_switched(void) {
+    accumulate();
+    cycles_per_us = rcc_ahb_frequency / 1000000u;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+}
+
+void boot_profile_mark(boot_stage_t stage) {
+    if (stage >= NUM_BOOT_STAGES) return;
+
+    accumulate();
+    g_boot_profile.stage_us[stage] = elapsed_us;
+    if (stage == BOOT_STAGE_FIRST_F1) {
+        g_boot_profile.time_to_first_f1_us = elapsed_us;
+    }
+}
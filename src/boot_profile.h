@@ -0,0 +1,47 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <stdint.h>
+
+/** Boot checkpoints, in the order system_init()/main() reach them. */
+typedef enum {
+    BOOT_STAGE_CLOCKS = 0,  // PLL + SysTick running
+    BOOT_STAGE_OUTPUTS,     // Output GPIO + pulse timer ready
+    BOOT_STAGE_STATE,       // Flash log + backup registers loaded, clock manager primed
+    BOOT_STAGE_INPUTS,      // Tap / MOD / ext clock armed
+    BOOT_STAGE_FIRST_F1,    // First clock_manager_update() returned (first beat emitted)
+    BOOT_STAGE_DEFERRED,    // Pull-ups, status LED and PVD configured
+    NUM_BOOT_STAGES
+} boot_stage_t;
+
+/**
+ * @brief Boot timing, in microseconds since boot_profile_start().
+ * @details Kept in RAM for inspection with a debugger (`print g_boot_profile`).
+ */
+typedef struct {
+    uint32_t stage_us[NUM_BOOT_STAGES];
+    uint32_t time_to_first_f1_us;
+} boot_profile_t;
+
+extern volatile boot_profile_t g_boot_profile;
+
+/**
+ * @brief Starts the DWT cycle counter; call first thing in main().
+ */
+void boot_profile_start(void);
+
+/**
+ * @brief Call right after the core clock changes (the PLL switch): the cycles counted so far are
+ *        converted at the old clock, later ones at rcc_ahb_frequency.
+ * @details rcc_clock_setup_pll() spends nearly all its time on HSI (HSE start-up, PLL lock), so
+ *          the whole call is counted at 16 MHz.
+ */
+void boot_profile_clock_switched(void);
+
+/**
+ * @brief Records the time at which @p stage completed.
+ * @details Each segment is converted at the core clock it ran at (see boot_profile_clock_switched()).
+ */
+void boot_profile_mark(boot_stage_t stage);
+
+#endif // BOOT_PROFILE_H
@@ -1,26 +1,16 @@
 #include "clock_manager.h"
 #include "drivers/io.h"
 #include "drivers/ext_clock.h" // Include external clock driver
-#include "modes/modes.h"     // Includes mode types and specific update functions
-// Include all specific mode headers that define the update functions
-#include "modes/mode_default.h"
-#include "modes/mode_euclidean.h"
-#include "modes/mode_musical.h"
-#include "modes/mode_probabilistic.h"
-#include "modes/mode_sequential.h"
-#include "modes/mode_swing.h"
-#include "modes/mode_polyrhythm.h"
-#include "modes/mode_phasing.h"
-#include "modes/mode_chaos.h"
-#include "modes/mode_fixed.h"
+#include "modes/modes.h"     // Mode types and the mode descriptor table
 
 #include "main_constants.h"  // For DEFAULT_PULSE_DURATION_MS
 #include "util/delay.h"      // For millis()
-#include <stddef.h>          // For NULL
+#include "util/cycle_profile.h"
 
 // --- Module State ---
 static mode_context_t current_mode_context;
 static operational_mode_t current_op_mode = MODE_DEFAULT;
+static const mode_descriptor_t *current_mode = &mode_descriptors[MODE_DEFAULT]; // Descriptor of current_op_mode
 
 // Tempo & Timing (Internal state)
 static uint32_t active_tempo_interval_ms = DEFAULT_TEMPO_INTERVAL;
@@ -33,70 +23,91 @@ static bool calc_mode_just_changed = false; // Flag for mode calc switch
 static bool pending_tap_quadruple_boundary = false;
 static uint32_t pending_tap_quadruple_interval_ms = 0;
 static uint32_t pending_tap_quadruple_t0_ms = 0;
+static bool tap_quadruple_applied = false; // Armed tempo took effect; cleared by clock_manager_take_applied_tap_tempo
+
+// External lock: once locked (and through holdover), new external anchors are slewed in, not snapped
+static bool external_phase_locked = false;
+static int32_t phase_slew_ms = 0; // Remaining beat phase correction, applied a bounded step per beat
+
+static mode_timing_t timing; // Derived from active_tempo_interval_ms; see rebuild_timing()
 
 // --- Helper Functions ---
 
-static void generate_f1_pulse(void) {
-    if (!MODE_SKIPS_AUTO_F1_CLOCK_ON_1AB(current_op_mode)) {
-        set_output_high_for_duration(JACK_OUT_1A, DEFAULT_PULSE_DURATION_MS);
-        set_output_high_for_duration(JACK_OUT_1B, DEFAULT_PULSE_DURATION_MS);
+// Recompute every tempo-derived value the modes read. Runs on tempo changes only.
+static void rebuild_timing(uint32_t interval_ms) {
+    uint32_t clamped = interval_ms;
+    if (clamped < MIN_INTERVAL) clamped = MIN_INTERVAL;
+    if (clamped > MAX_INTERVAL) clamped = MAX_INTERVAL;
+
+    timing.interval_ms = interval_ms;
+    timing.interval_us = interval_ms * 1000u;
+    timing.generation = (timing.generation + 1u) ? (timing.generation + 1u) : 1u;
+    timing.valid = (interval_ms >= MIN_INTERVAL && interval_ms <= MAX_INTERVAL);
+    timing.clamped_ms = clamped;
+    timing.half_ms = (clamped / 2u < MIN_INTERVAL) ? MIN_INTERVAL : clamped / 2u;
+    timing.double_ms = (clamped * 2u > MAX_INTERVAL) ? MAX_INTERVAL : clamped * 2u;
+    for (uint32_t p = 0u; p < MODE_TIMING_SWING_STEPS; p++) {
+        timing.swing_offset_ms[p] = p * interval_ms / 100u;
     }
 }
 
-// Array of function pointers for mode update functions
-static void (*mode_update_functions[NUM_OPERATIONAL_MODES])(const mode_context_t*) = {
-    [MODE_DEFAULT]       = mode_default_update,
-    [MODE_EUCLIDEAN]     = mode_euclidean_update,
-    [MODE_MUSICAL]       = mode_musical_update,
-    [MODE_PROBABILISTIC] = mode_probabilistic_update,
-    [MODE_SEQUENTIAL]    = mode_sequential_update,
-    [MODE_SWING]         = mode_swing_update,
-    [MODE_POLYRHYTHM]    = mode_polyrhythm_update,
-    [MODE_LOGIC]         = mode_logic_update,
-    [MODE_PHASING]       = mode_phasing_update,
-    [MODE_CHAOS]         = mode_chaos_update,
-    [MODE_FIXED]         = mode_fixed_update,
-    [MODE_DRIFT]         = mode_drift_update,
-    [MODE_FILL]          = mode_fill_update,
-    [MODE_SKIP]          = mode_skip_update,
-    [MODE_STUTTER]       = mode_stutter_update,
-    [MODE_MORPH]         = mode_morph_update,
-    [MODE_MUTE]          = mode_mute_update,
-    [MODE_DENSITY]       = mode_density_update,
-    [MODE_SONG]          = mode_song_update,
-    [MODE_ACCUMULATE]    = mode_accumulate_update,
-    [MODE_GAMMA_SEQUENTIAL_RESET] = mode_gamma_sequential_reset_update,
-    [MODE_GAMMA_SEQUENTIAL_FREEZE] = mode_gamma_sequential_freeze_update,
-    [MODE_GAMMA_SEQUENTIAL_TRIP] = mode_gamma_sequential_trip_update,
-    [MODE_GAMMA_SEQUENTIAL_FIRE] = mode_gamma_sequential_fire_update,
-    [MODE_GAMMA_SEQUENTIAL_BOUNCE] = mode_gamma_sequential_bounce_update,
-    [MODE_GAMMA_PORTALS] = mode_gamma_portals_update,
-    [MODE_GAMMA_COIN_TOSS] = mode_gamma_coin_toss_update,
-    [MODE_GAMMA_RATCHET] = mode_gamma_ratchet_update,
-    [MODE_GAMMA_ANTI_RATCHET] = mode_gamma_anti_ratchet_update,
-    [MODE_GAMMA_START_STOP] = mode_gamma_start_stop_update
-};
+// Switch tempo and remap everything already scheduled on the old one: the pulse timer's running
+// bursts and the active mode's pending deadlines, so the next subdivision follows the new tempo.
+static void apply_tempo_interval(uint32_t interval_ms, uint32_t now) {
+    uint32_t old_interval = active_tempo_interval_ms;
+    if (old_interval == interval_ms) {
+        return;
+    }
+    active_tempo_interval_ms = interval_ms;
+    rebuild_timing(interval_ms);
+    if (old_interval == 0u) {
+        return;
+    }
+    io_burst_rescale(old_interval, interval_ms);
+    if (interval_ms != 0u) {
+        current_mode->on_tempo_change(now, old_interval, interval_ms);
+    }
+}
+
+static void generate_f1_pulse(void) {
+    if (!(current_mode->flags & MODE_FLAG_OWNS_1AB)) {
+        if (F1_OUTPUT_PPQN > 1u) {
+            // Whole beat of PPQN clocks handed to the pulse timer: no main-loop work per edge
+            uint32_t span_us = active_tempo_interval_ms * 1000u;
+            io_burst(JACK_OUT_1A, F1_OUTPUT_PPQN, span_us);
+            io_burst(JACK_OUT_1B, F1_OUTPUT_PPQN, span_us);
+        } else {
+            io_trigger(JACK_OUT_1A);
+            io_trigger(JACK_OUT_1B);
+        }
+    }
+}
 
 // --- Public Function Implementations ---
 
 void clock_manager_init(operational_mode_t initial_op_mode, uint32_t initial_tempo_interval) {
     current_op_mode = initial_op_mode;
-    mode_init_current(current_op_mode); // Use the correct init function
+    current_mode = mode_descriptor(current_op_mode);
+    current_mode->init();
     active_tempo_interval_ms = initial_tempo_interval;
-    last_f1_pulse_time_ms = millis(); // Initialize to prevent immediate pulse
+    rebuild_timing(initial_tempo_interval);
+    // Restored tempo starts at beat phase 0: the first update fires F1 immediately
+    // instead of waiting a full interval after power-on.
+    last_f1_pulse_time_ms = millis() - initial_tempo_interval;
     f1_tick_counter = 0;
 
     // Initialize context (some parts will be updated each cycle)
     current_mode_context.f1_rising_edge = false;
-    current_mode_context.current_time_ms = last_f1_pulse_time_ms;
+    current_mode_context.current_time_ms = millis();
     current_mode_context.current_tempo_interval_ms = initial_tempo_interval; // Use parameter
+    current_mode_context.timing = &timing;
     current_mode_context.calc_mode = CALC_MODE_NORMAL; // Will be updated by main
     current_mode_context.f1_counter = f1_tick_counter;
     current_mode_context.calc_mode_changed = false;
     current_mode_context.sync_request = false;
     current_mode_context.ms_since_last_call = 0;
     current_mode_context.bypass_first_update = false; // <<< ADDED BACK: Initialize flag
-    last_update_time_ms = last_f1_pulse_time_ms;
+    last_update_time_ms = current_mode_context.current_time_ms;
 }
 
 void clock_manager_arm_tap_quadruple_boundary(uint32_t interval_ms, uint32_t event_timestamp_ms) {
@@ -114,7 +125,7 @@ void clock_manager_set_internal_tempo(uint32_t interval_ms, bool is_external_clo
         if (t0 == 0u || t0 > now) {
             t0 = now;
         }
-        active_tempo_interval_ms = interval_ms;
+        apply_tempo_interval(interval_ms, now);
         /*
          * External clock: snap last_f1 <= now on the t0-aligned grid.
          * Tap tempo uses clock_manager_arm_tap_quadruple_boundary for clicks 4/8/…; this path is
@@ -122,10 +133,26 @@ void clock_manager_set_internal_tempo(uint32_t interval_ms, bool is_external_clo
          */
         if (!is_external_clock) {
             last_f1_pulse_time_ms = t0;
+            external_phase_locked = false;
+            phase_slew_ms = 0;
         } else {
             uint32_t late = now - t0;
             uint32_t k = late / interval_ms;
-            last_f1_pulse_time_ms = t0 + k * interval_ms;
+            uint32_t target = t0 + k * interval_ms;
+            if (external_phase_locked) {
+                // Shortest signed distance from our grid to the clock's grid, in (-T/2, T/2]
+                int32_t err = (int32_t)(target - last_f1_pulse_time_ms) % (int32_t)interval_ms;
+                if (err > (int32_t)interval_ms / 2) {
+                    err -= (int32_t)interval_ms;
+                } else if (err <= -(int32_t)interval_ms / 2) {
+                    err += (int32_t)interval_ms;
+                }
+                phase_slew_ms = err;
+            } else {
+                last_f1_pulse_time_ms = target;
+                phase_slew_ms = 0;
+            }
+            external_phase_locked = true;
         }
     }
 }
@@ -134,23 +161,33 @@ uint32_t clock_manager_get_current_tempo_interval(void) {
     return active_tempo_interval_ms;
 }
 
+bool clock_manager_take_applied_tap_tempo(uint32_t *interval_ms) {
+    if (!tap_quadruple_applied) {
+        return false;
+    }
+    tap_quadruple_applied = false;
+    *interval_ms = active_tempo_interval_ms;
+    return true;
+}
+
 void clock_manager_set_operational_mode(operational_mode_t new_mode) {
     if (new_mode != current_op_mode) {
-        mode_reset_current(current_op_mode); // Reset the old mode
+        current_mode->reset(); // Reset the old mode
         current_op_mode = new_mode;
-        mode_init_current(current_op_mode); // Initialize the new mode
+        current_mode = mode_descriptor(new_mode);
+        current_mode->init(); // Initialize the new mode
         f1_tick_counter = 0; // Reset counter on mode change
 
-        // <<< ADDED BACK: Set flag to bypass first update for specific modes >>>
-        if (new_mode == MODE_MUSICAL || new_mode == MODE_POLYRHYTHM) {
-            current_mode_context.bypass_first_update = true;
-        } else {
-            current_mode_context.bypass_first_update = false;
-        }
+        // Some modes need one pass before their first update
+        current_mode_context.bypass_first_update = (current_mode->flags & MODE_FLAG_SKIP_FIRST_UPDATE) != 0u;
     }
 }
 
-void clock_manager_update(void) {
+// SRAM: the scheduler itself; mode update functions stay in flash (ART-cached). It still calls
+// rebuild_timing(), generate_f1_pulse(), the mode hooks and libopencm3 helpers from flash, so it
+// saves wait states but does not run during a flash erase.
+KRONO_RAMFUNC void clock_manager_update(void) {
+    CYCLE_PROFILE_BEGIN(CYCLE_PROFILE_CLOCK_MANAGER_UPDATE);
     uint32_t now = millis();
     bool f1_tick_this_cycle = false;
     uint32_t ms_since_last_update = now - last_update_time_ms;
@@ -161,8 +198,11 @@ void clock_manager_update(void) {
         if (t0 == 0u || t0 > now) {
             t0 = now;
         }
-        active_tempo_interval_ms = pending_tap_quadruple_interval_ms;
+        apply_tempo_interval(pending_tap_quadruple_interval_ms, now);
+        tap_quadruple_applied = true;
         last_f1_pulse_time_ms = t0;
+        external_phase_locked = false;
+        phase_slew_ms = 0;
         generate_f1_pulse();
         f1_tick_counter += 1u;
         f1_tick_this_cycle = true;
@@ -173,6 +213,14 @@ void clock_manager_update(void) {
             n = 1;
         }
         last_f1_pulse_time_ms += n * active_tempo_interval_ms;
+        if (phase_slew_ms != 0) {
+            int32_t max_step = (int32_t)(active_tempo_interval_ms / EXT_CLOCK_PHASE_SLEW_DIVISOR);
+            int32_t step = phase_slew_ms;
+            if (step > max_step) step = max_step;
+            if (step < -max_step) step = -max_step;
+            last_f1_pulse_time_ms += (uint32_t)step;
+            phase_slew_ms -= step;
+        }
         generate_f1_pulse();
         f1_tick_this_cycle = true;
         f1_tick_counter += n;
@@ -189,12 +237,14 @@ void clock_manager_update(void) {
     current_mode_context.sync_request = sync_requested; // Pass flag
 
     // --- Call Active Mode Update (or bypass if flagged) ---
+    // Between F1 edges a mode is only called once its wake time has come.
     if (current_mode_context.bypass_first_update) {
         current_mode_context.bypass_first_update = false; // Reset flag and skip update this cycle
-    } else {
-        if (mode_update_functions[current_op_mode] != NULL) {
-            mode_update_functions[current_op_mode](&current_mode_context);
-        }
+    } else if (f1_tick_this_cycle || calc_mode_just_changed || sync_requested ||
+               current_mode->next_wake_us(io_now_us()) == MODE_WAKE_NOW) {
+        CYCLE_PROFILE_BEGIN(CYCLE_PROFILE_MODE_UPDATE);
+        current_mode->update(&current_mode_context);
+        CYCLE_PROFILE_END(CYCLE_PROFILE_MODE_UPDATE);
     }
 
     // Reset sync/calc mode flags after they have been processed (or bypassed)
@@ -203,6 +253,7 @@ void clock_manager_update(void) {
 
     // Update time for next cycle
     last_update_time_ms = now;
+    CYCLE_PROFILE_END(CYCLE_PROFILE_CLOCK_MANAGER_UPDATE);
 }
 
 // This is the old simple sync, now replaced by the one below
@@ -227,6 +278,7 @@ void clock_manager_sync_flags(bool is_calc_mode_change) {
 void clock_manager_restart_beat_phase_now(void) {
     uint32_t now = millis();
     last_f1_pulse_time_ms = now;
+    phase_slew_ms = 0;
     f1_tick_counter = 0;
     sync_requested = true;
     calc_mode_just_changed = false;
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "modes/modes.h" // Includes modes types (operational_mode_t, calculation_mode_t, mode_context_t)
+#include "util/ramfunc.h"
 
 /**
  * @brief Initializes the Clock Manager module.
@@ -37,11 +38,18 @@ void clock_manager_arm_tap_quadruple_boundary(uint32_t interval_ms, uint32_t eve
  */
 uint32_t clock_manager_get_current_tempo_interval(void);
 
+/**
+ * @brief Reports, once, that a tempo armed by clock_manager_arm_tap_quadruple_boundary took effect.
+ * @param interval_ms Receives the applied interval (ms) when true is returned.
+ * @return true if the armed tempo was applied since the last call.
+ */
+bool clock_manager_take_applied_tap_tempo(uint32_t *interval_ms);
+
 /**
  * @brief Updates the clock manager state, generates F1 clock, and calls the active mode's update.
  *        This should be called periodically from the main loop.
  */
-void clock_manager_update(void);
+KRONO_RAMFUNC void clock_manager_update(void);
 
 /**
  * @brief Changes the currently active operational mode.
@@ -1,156 +1,192 @@
 #include "drivers/ext_clock.h"
-#include "main_constants.h" // For millis declaration and timing constants like MAX_INTERVAL_DIFFERENCE, EXT_CLOCK_TIMEOUT_MS
+#include "main_constants.h" // For millis declaration and EXT_CLOCK_TIMEOUT_MS
 #include "variables.h"      // For timing constants like MIN_INTERVAL, MAX_INTERVAL
 
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
-#include <libopencm3/stm32/exti.h>
+#include <libopencm3/stm32/timer.h>
 #include <libopencm3/cm3/nvic.h>
-#include <libopencm3/stm32/syscfg.h> // Required for SYSCFG clock enable (F4)
 #include <stdint.h>
 #include <stdbool.h>
-#include <limits.h> // For UINT32_MAX
+#include "util/ramfunc.h"
+#include "util/cycle_profile.h"
 
 // --- Configuration ---
 #define EXT_CLOCK_PORT GPIOB
 #define EXT_CLOCK_PIN GPIO3
-#define EXT_CLOCK_EXTI EXTI3
-#define EXT_CLOCK_NVIC_IRQ NVIC_EXTI3_IRQ // EXTI3 has its own IRQ
+#define EXT_CLOCK_TIMER TIM2              // PB3 = TIM2_CH2 (AF1), 32-bit capture timebase
+#define EXT_CLOCK_TIMER_RCC RCC_TIM2
+#define EXT_CLOCK_TIMER_RST RST_TIM2
+#define EXT_CLOCK_NVIC_IRQ NVIC_TIM2_IRQ
 
 // Define min/max intervals (for basic validation)
-// Using MIN_INTERVAL and MAX_INTERVAL from main_constants.h for consistency
-// #define MIN_EXT_CLOCK_INTERVAL_MS 20 // Use MIN_INTERVAL from variables.h
-// #define MAX_EXT_CLOCK_INTERVAL_MS 3000 // Use MAX_INTERVAL from variables.h
+// Using MIN_INTERVAL and MAX_INTERVAL from main_constants.h, divided by the input PPQN per edge
 
 // Validation settings
-#define NUM_EXT_INTERVALS_FOR_VALIDATION 3 // Number of stable intervals needed
-// Use MAX_INTERVAL_DIFFERENCE from main_constants.h for stability threshold
-#define EXT_CLOCK_DEBOUNCE_MS 5 // Debounce time in ms
+#define NUM_EXT_INTERVALS_FOR_VALIDATION 3 // Edges needed before the first tempo estimate
+#define EXT_CLOCK_MAX_WINDOW 48            // Edge intervals averaged: one beat at the highest PPQN
 
 // --- Internal State ---
-static volatile uint32_t last_pulse_time_ms = 0; // Time of the last valid pulse start (after debounce)
-static volatile uint32_t last_isr_time_ms = 0;   // Time of the last ISR execution (after debounce)
-static volatile uint32_t validated_interval_ms = 0; // Last validated stable interval
-static volatile uint32_t last_validated_event_time_ms = 0; // Timestamp of the validating pulse
+static volatile uint32_t last_isr_time_ms = 0;   // Time of the last accepted edge (ms)
+static volatile uint32_t validated_interval_ms = 0; // Last validated stable interval (per beat)
+static volatile uint32_t last_validated_event_time_ms = 0; // Beat edge anchoring the last validation
 static volatile bool g_ext_clock_validated_interval_ready = false; // Flag for input_handler to check
+static volatile uint32_t tracked_edge_interval_us = 0; // Mean edge spacing at the last estimate (loss timeout)
+static bool estimate_reported = false; // First estimate after a window restart is always reported
 
-// Validation buffer state
-static uint32_t ext_intervals[NUM_EXT_INTERVALS_FOR_VALIDATION] = {0};
-static uint8_t ext_interval_index = 0;
+// Edge tracking (capture timestamps in us)
+static uint32_t last_edge_us = 0;
+static bool have_last_edge = false;
+static uint8_t edge_phase = 0;          // Edge index within the beat; 0 = beat (F1) edge
+static uint32_t last_beat_edge_ms = 0;
 
+// Rolling window of edge intervals
+static uint32_t edge_intervals[EXT_CLOCK_MAX_WINDOW];
+// Edges averaged per estimate: one beat, and at least NUM_EXT_INTERVALS_FOR_VALIDATION
+#define EXT_CLOCK_EDGE_WINDOW ((EXT_CLOCK_INPUT_PPQN < NUM_EXT_INTERVALS_FOR_VALIDATION) \
+                               ? NUM_EXT_INTERVALS_FOR_VALIDATION : EXT_CLOCK_INPUT_PPQN)
+static uint8_t edge_index = 0;
+static uint8_t edge_filled = 0;
+static uint32_t edge_sum_us = 0;
 
-// ISR for EXTI3 (this file handles its own ISR)
-void exti3_isr(void) {
-    if (exti_get_flag_status(EXT_CLOCK_EXTI)) {
-        ext_clock_handle_irq(); // Call the handler
-        exti_reset_request(EXT_CLOCK_EXTI); // Clear the interrupt flag
+// TIM2 capture ISR (this file handles its own ISR). SRAM, direct register access only.
+KRONO_RAMFUNC void tim2_isr(void) {
+    if (TIM_SR(EXT_CLOCK_TIMER) & TIM_SR_CC2IF) {
+        ext_clock_handle_irq(); // Reading CCR2 clears CC2IF
     }
 }
 
-// Reset helper for validation buffer
-static void reset_ext_clock_validation_buffer(void) {
-    ext_interval_index = 0;
-    for (int i = 0; i < NUM_EXT_INTERVALS_FOR_VALIDATION; i++) {
-        ext_intervals[i] = 0;
-    }
+// Reset helper for the edge window
+static KRONO_RAMFUNC void reset_ext_clock_validation_buffer(void) {
+    edge_index = 0;
+    edge_filled = 0;
+    edge_sum_us = 0;
+    estimate_reported = false;
     // Don't reset validated_interval_ms here; keep the last known good one until a new one is found.
 }
 
-
 /**
- * @brief Actual handler logic called by the ISR. Handles debounce and validation.
+ * @brief Actual handler logic called by the ISR: glitch filter, PPQN division, tempo estimate.
+ *        Constant time per edge (running sum), so 48 PPQN at the fastest tempo stays cheap.
  */
-void ext_clock_handle_irq(void) {
-    uint32_t now = millis();
+KRONO_RAMFUNC void ext_clock_handle_irq(void) {
+    CYCLE_PROFILE_BEGIN(CYCLE_PROFILE_EXT_CLOCK_IRQ);
+    uint32_t edge_us = TIM_CCR2(EXT_CLOCK_TIMER);
+    TIM_SR(EXT_CLOCK_TIMER) = ~TIM_SR_CC2OF; // An overcapture only means we were late; the latest edge wins
+    uint32_t now_ms = millis() - (TIM_CNT(EXT_CLOCK_TIMER) - edge_us) / 1000u;
+    const uint8_t ppqn = EXT_CLOCK_INPUT_PPQN;
+
+    if (!have_last_edge) {
+        have_last_edge = true;
+        last_edge_us = edge_us;
+        last_isr_time_ms = now_ms;
+        edge_phase = 0;
+        last_beat_edge_ms = now_ms;
+        CYCLE_PROFILE_END(CYCLE_PROFILE_EXT_CLOCK_IRQ);
+        return;
+    }
+
+    uint32_t dt = edge_us - last_edge_us;
+    // Glitch filter: edges closer than this are ringing, not clock
+    if (dt < EXT_CLOCK_GLITCH_US) {
+        CYCLE_PROFILE_END(CYCLE_PROFILE_EXT_CLOCK_IRQ);
+        return;
+    }
+    last_edge_us = edge_us;
+    last_isr_time_ms = now_ms;
 
-    // Basic Debounce: Ignore if interrupt happens too quickly after the last one.
-    if (now - last_isr_time_ms < EXT_CLOCK_DEBOUNCE_MS) {
-        return; // Ignore bounce
+    // Basic per-edge range check (beat range divided by the PPQN)
+    if (dt < (MIN_INTERVAL * 1000u) / ppqn || dt > (MAX_INTERVAL * 1000u) / ppqn) {
+        // Out of range (e.g. clock restarted): re-phase so this edge is the beat
+        reset_ext_clock_validation_buffer();
+        edge_phase = 0;
+        last_beat_edge_ms = now_ms;
+        CYCLE_PROFILE_END(CYCLE_PROFILE_EXT_CLOCK_IRQ);
+        return;
     }
-    // Record time of this (debounced) ISR execution *before* checking pin state
-    last_isr_time_ms = now; 
-
-    // Only process RISING edges (check pin state AFTER debounce period)
-    if (gpio_get(EXT_CLOCK_PORT, EXT_CLOCK_PIN)) {
-        
-        if (last_pulse_time_ms != 0) {
-            // Calculate interval from the *start* of the last valid pulse
-            uint32_t interval = now - last_pulse_time_ms;
-
-            // Basic interval range check (using defines from variables.h)
-            if (interval >= MIN_INTERVAL && interval <= MAX_INTERVAL) {
-                // Store valid interval in the buffer
-                ext_intervals[ext_interval_index++] = interval;
-
-                // Check if buffer is full
-                if (ext_interval_index >= NUM_EXT_INTERVALS_FOR_VALIDATION) {
-                    // Buffer full, check for stability
-                    uint64_t interval_sum = 0;
-                    uint32_t min_val = UINT32_MAX, max_val = 0;
-                    for (int i = 0; i < NUM_EXT_INTERVALS_FOR_VALIDATION; i++) {
-                        interval_sum += ext_intervals[i];
-                        if (ext_intervals[i] < min_val) min_val = ext_intervals[i];
-                        if (ext_intervals[i] > max_val) max_val = ext_intervals[i];
-                    }
-
-                    // Use MAX_INTERVAL_DIFFERENCE from main_constants.h for stability check
-                    if ((max_val - min_val) <= MAX_INTERVAL_DIFFERENCE) {
-                        // Intervals are stable, calculate average
-                        uint32_t avg_interval = (uint32_t)(interval_sum / NUM_EXT_INTERVALS_FOR_VALIDATION);
-
-                        // Sanity check average against absolute min/max
-                        if (avg_interval < MIN_INTERVAL) avg_interval = MIN_INTERVAL;
-                        if (avg_interval > MAX_INTERVAL) avg_interval = MAX_INTERVAL;
-
-                        // Atomically update the validated interval and set the flag
-                        // Check if the new validated interval is actually different from the current one
-                        // to avoid unnecessary signaling.
-                        if (avg_interval != validated_interval_ms) {
-                             nvic_disable_irq(EXT_CLOCK_NVIC_IRQ); // Protect access
-                             validated_interval_ms = avg_interval;
-                             last_validated_event_time_ms = now; // Store timestamp of the validating pulse
-                             g_ext_clock_validated_interval_ready = true; // Signal input_handler
-                             nvic_enable_irq(EXT_CLOCK_NVIC_IRQ);
-                        }
-                    }
-                    // Reset buffer regardless of stability to start collecting next set
-                    reset_ext_clock_validation_buffer();
-                }
-            } else {
-                // Interval out of range, reset validation process
-                reset_ext_clock_validation_buffer();
-                // Consider resetting validated_interval_ms to 0? Or keep last good one? Keep last good for now.
-            }
+
+    // Divide down to F1 with phase tracking
+    edge_phase = (uint8_t)(edge_phase + 1u);
+    if (edge_phase >= ppqn) {
+        edge_phase = 0;
+        last_beat_edge_ms = now_ms;
+    }
+
+    // A jump away from the running mean is a tempo change: restart the window for a fast relock
+    if (edge_filled > 0) {
+        uint32_t mean = edge_sum_us / edge_filled;
+        uint32_t dev = (dt > mean) ? dt - mean : mean - dt;
+        if (dev * 100u > mean * EXT_CLOCK_MAX_EDGE_DEVIATION_PERCENT) {
+            reset_ext_clock_validation_buffer();
         }
-        // Record the time of this valid pulse start *after* processing interval
-        last_pulse_time_ms = now;
     }
-    // Ignore FALLING edges
+
+    if (edge_filled == EXT_CLOCK_EDGE_WINDOW) {
+        edge_sum_us -= edge_intervals[edge_index];
+    } else {
+        edge_filled++;
+    }
+    edge_intervals[edge_index] = dt;
+    edge_sum_us += dt;
+    edge_index = (uint8_t)(edge_index + 1u);
+    if (edge_index >= EXT_CLOCK_EDGE_WINDOW) edge_index = 0;
+
+    if (edge_filled >= NUM_EXT_INTERVALS_FOR_VALIDATION) {
+        // sum <= window * MAX_INTERVAL*1000/ppqn, so sum * ppqn stays well inside 32 bits
+        uint32_t avg_interval = ((edge_sum_us * ppqn) / edge_filled + 500u) / 1000u;
+
+        // Sanity check average against absolute min/max
+        if (avg_interval < MIN_INTERVAL) avg_interval = MIN_INTERVAL;
+        if (avg_interval > MAX_INTERVAL) avg_interval = MAX_INTERVAL;
+
+        tracked_edge_interval_us = edge_sum_us / edge_filled;
+
+        // Already in the TIM2 handler: nothing else writes these, no masking needed.
+        // A restarted window (clock back after a stop, tempo jump) reports even at the same tempo.
+        if (avg_interval != validated_interval_ms || !estimate_reported) {
+            estimate_reported = true;
+            validated_interval_ms = avg_interval;
+            last_validated_event_time_ms = last_beat_edge_ms; // Beat phase anchor, not the sub-beat edge
+            g_ext_clock_validated_interval_ready = true; // Signal input_handler
+        }
+    }
+    CYCLE_PROFILE_END(CYCLE_PROFILE_EXT_CLOCK_IRQ);
 }
 
 
 /**
- * @brief Initializes the External Clock input pin (PB3) and EXTI settings.
+ * @brief Initializes the External Clock input pin (PB3) as TIM2_CH2 rising-edge input capture.
  */
 void ext_clock_init(void) {
     rcc_periph_clock_enable(RCC_GPIOB); // Clock for GPIOB
-    rcc_periph_clock_enable(RCC_SYSCFG); // Clock for SYSCFG (needed for EXTI config on F4)
+    rcc_periph_clock_enable(EXT_CLOCK_TIMER_RCC);
+    rcc_periph_reset_pulse(EXT_CLOCK_TIMER_RST);
 
-    gpio_mode_setup(EXT_CLOCK_PORT, GPIO_MODE_INPUT, GPIO_PUPD_NONE, EXT_CLOCK_PIN); // Configure PB3 as input, no pull
+    gpio_mode_setup(EXT_CLOCK_PORT, GPIO_MODE_AF, GPIO_PUPD_NONE, EXT_CLOCK_PIN); // PB3 → TIM2_CH2, no pull
+    gpio_set_af(EXT_CLOCK_PORT, GPIO_AF1, EXT_CLOCK_PIN);
 
-    nvic_enable_irq(EXT_CLOCK_NVIC_IRQ);
-    exti_select_source(EXT_CLOCK_EXTI, EXT_CLOCK_PORT); // Map EXTI3 to GPIOB
-    // Trigger on RISING edge only
-    exti_set_trigger(EXT_CLOCK_EXTI, EXTI_TRIGGER_RISING);
-    exti_enable_request(EXT_CLOCK_EXTI);
+    timer_set_mode(EXT_CLOCK_TIMER, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+    timer_set_prescaler(EXT_CLOCK_TIMER, (rcc_get_timer_clk_freq(EXT_CLOCK_TIMER) / 1000000) - 1); // 1 MHz
+    timer_set_period(EXT_CLOCK_TIMER, 0xFFFFFFFFu);
+    // CC2 = input on TI2, hardware filter (fDTS/32, N = 8: ~3 us), rising edge only
+    TIM_CCMR1(EXT_CLOCK_TIMER) = TIM_CCMR1_CC2S_IN_TI2 | TIM_CCMR1_IC2F_DTF_DIV_32_N_8;
+    TIM_CCER(EXT_CLOCK_TIMER) = TIM_CCER_CC2E;
+    timer_generate_event(EXT_CLOCK_TIMER, TIM_EGR_UG);
+    TIM_SR(EXT_CLOCK_TIMER) = 0;
+    TIM_DIER(EXT_CLOCK_TIMER) = TIM_DIER_CC2IE;
 
     // Reset state
-    last_pulse_time_ms = 0;
     last_isr_time_ms = 0;
     validated_interval_ms = 0;
     last_validated_event_time_ms = 0;
     g_ext_clock_validated_interval_ready = false;
+    tracked_edge_interval_us = 0;
+    have_last_edge = false;
+    edge_phase = 0;
     reset_ext_clock_validation_buffer();
+
+    nvic_enable_irq(EXT_CLOCK_NVIC_IRQ);
+    timer_enable_counter(EXT_CLOCK_TIMER);
 }
 
 
@@ -208,17 +244,20 @@ uint32_t ext_clock_get_last_validated_event_time(void) {
 
 /**
  * @brief Checks if the external clock has stopped sending pulses (timed out).
- *        Timeout is based on the last *raw* ISR execution time (after debounce),
- *        as this indicates the last known activity.
+ *        Timeout is based on the last accepted edge (after the glitch filter), as this
+ *        indicates the last known activity. Once a tempo is tracked the limit adapts to it:
+ *        EXT_CLOCK_LOSS_MISSED_PERIODS input periods, capped at EXT_CLOCK_TIMEOUT_MS.
  *
  * @param current_time_ms The current system time.
  * @return true If the time since the last detected pulse exceeds EXT_CLOCK_TIMEOUT_MS, false otherwise.
  */
 bool ext_clock_has_timed_out(uint32_t current_time_ms) {
     uint32_t last_activity;
+    uint32_t edge_us;
     nvic_disable_irq(EXT_CLOCK_NVIC_IRQ);
     // Use last_isr_time_ms for timeout, as it reflects the last time we *knew* the clock was active
     last_activity = last_isr_time_ms;
+    edge_us = tracked_edge_interval_us;
     nvic_enable_irq(EXT_CLOCK_NVIC_IRQ);
 
     // Handle potential initial state before any ISR has run
@@ -226,6 +265,10 @@ bool ext_clock_has_timed_out(uint32_t current_time_ms) {
         return true; // Assume timed out if no pulse ever detected
     }
 
-    // Use EXT_CLOCK_TIMEOUT_MS from main_constants.h
-    return (current_time_ms > last_activity + EXT_CLOCK_TIMEOUT_MS); 
+    uint32_t timeout_ms = EXT_CLOCK_TIMEOUT_MS; // Nothing tracked yet
+    if (edge_us != 0) {
+        uint32_t adaptive_ms = (edge_us * EXT_CLOCK_LOSS_MISSED_PERIODS) / 1000u + EXT_CLOCK_LOSS_MARGIN_MS;
+        if (adaptive_ms < timeout_ms) timeout_ms = adaptive_ms;
+    }
+    return (current_time_ms - last_activity) > timeout_ms;
 }
@@ -5,14 +5,13 @@
 #include <stdbool.h>
 
 /**
- * @brief Initializes the External Clock input pin (PB3) and associated EXTI interrupt.
+ * @brief Initializes the External Clock input pin (PB3) as TIM2_CH2 input capture (1 us timestamps).
  */
 void ext_clock_init(void);
 
 /**
- * @brief Interrupt handler function for the external clock input (EXTI3).
- *        This function should be called from the corresponding ISR (e.g., exti3_isr).
- *        It handles debounce and interval validation.
+ * @brief Interrupt handler function for the external clock input (TIM2 CC2).
+ *        Called from tim2_isr. Handles the glitch filter, PPQN division and tempo estimation.
  */
 void ext_clock_handle_irq(void);
 
@@ -35,8 +34,8 @@ bool ext_clock_has_new_validated_interval(void);
 uint32_t ext_clock_get_validated_interval(void);
 
 /**
- * @brief Gets the timestamp (in ms) of the rising edge of the external clock pulse
- *        that completed the most recent interval validation.
+ * @brief Gets the timestamp (in ms) of the beat edge (edge 0 of the PPQN group)
+ *        at the most recent interval validation.
  *
  * @return uint32_t The timestamp of the validating event, or 0 if no interval
  *                  has been validated yet or if the clock has timed out.
@@ -50,7 +49,8 @@ uint32_t ext_clock_get_last_validated_event_time(void);
  *
  * @param current_time_ms The current system time (e.g., from millis()).
  * @return true If the time since the last known clock activity exceeds
- *              EXT_CLOCK_TIMEOUT_MS (defined in main_constants.h), false otherwise.
+ *              EXT_CLOCK_LOSS_MISSED_PERIODS measured input periods (or EXT_CLOCK_TIMEOUT_MS
+ *              before any tempo is tracked), false otherwise.
  */
 bool ext_clock_has_timed_out(uint32_t current_time_ms);
 
@@ -1,9 +1,11 @@
 #include "io.h"
 #include "tap.h" // Needed for tap_detected() wrapper
 #include "../main_constants.h" // Needed for millis() declaration and JACK_... enums
+#include "../util/ramfunc.h"
+#include "../util/cycle_profile.h"
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
-#include <libopencm3/stm32/timer.h> // Added for TIM3
+#include <libopencm3/stm32/timer.h> // Pulse timebase (TIM5)
 #include <libopencm3/cm3/nvic.h>    // Added for NVIC
 // #include <libopencm3/stm32/common/timer_common_all.h> // timer_reset seems missing in link stage
 #include <limits.h> // For UINT32_MAX
@@ -13,8 +15,9 @@
 // Pin definitions (Internal verification/reference - the jack_output_map is the source of truth)
 // ... (pin mapping comments as before) ...
 
-// Complete mapping of output pins defined in io.h enum
-static const struct {
+// Complete mapping of output pins defined in io.h enum.
+// Not const: kept in .data (SRAM) so the RAM-resident ISR never reads flash.
+static struct {
     uint32_t port;
     uint16_t pin;
 } jack_output_map[NUM_JACK_OUTPUTS] = { // Size based on enum definition in io.h
@@ -46,14 +49,80 @@ static const struct {
 static bool output_protection_enabled = false;
 
 // --- Pulse Timer Mechanism ---
+// TIM5 (32-bit) free-runs at 1 MHz as the output timebase. Pending pin changes sit in a
+// deadline-sorted queue; CC1 is armed to the head, so the ISR runs only when an edge is due
+// and stays silent (CC1IE off) while no pulse is active.
+#define PULSE_TIMER TIM5
+#define PULSE_TIMER_RCC RCC_TIM5
+#define PULSE_TIMER_RST RST_TIM5
+#define PULSE_TIMER_IRQ NVIC_TIM5_IRQ
+
 typedef struct {
-    uint32_t end_time_ms; // Time when the pulse should end
+    uint32_t end_time_us; // Timebase tick at which the pulse ends
     bool active;          // Is a pulse currently active on this pin?
 } pulse_timer_t;
 
+typedef struct {
+    uint32_t at_us;
+    uint8_t jack;
+    bool level;
+} io_event_t;
+
 // This state is managed by the timer ISR
 // IMPORTANT: Size is now NUM_JACK_OUTPUTS but timer logic only applies to Group A/B
 static volatile pulse_timer_t pulse_timers[NUM_JACK_OUTPUTS];
+static volatile io_event_t event_queue[IO_EVENT_QUEUE_SIZE]; // Sorted by at_us (wrap-safe)
+static volatile uint8_t event_count = 0;
+static volatile uint32_t rise_pending_mask = 0; // Jacks with a queued rise (retrigger gap or scheduled trigger)
+volatile uint32_t g_io_dropped_triggers = 0; // Read with a debugger (io.h)
+
+// Timer-driven bursts: pulse k rises at start + k*span/count. The ISR queues the next pulse when
+// the previous one falls, so each bursting jack holds at most two queue entries.
+typedef struct {
+    uint32_t start_us;
+    uint32_t span_us;
+    uint32_t width_us;
+    uint16_t count;
+    uint16_t next; // Index of the next pulse to schedule
+} io_burst_t;
+
+static volatile io_burst_t bursts[NUM_JACK_OUTPUTS];
+static volatile uint32_t burst_mask = 0;
+
+// --- Hardware One-Pulse Outputs ---
+// Jacks whose pin carries CH1 of a timer with a counter of its own. The timer runs at 1 MHz in
+// one-pulse PWM2 mode with CCR1 = 1, so the pin goes high one tick after CEN and low again at the
+// ARR update: width is ARR ticks with no CPU work after the trigger. The pin is handed to the timer
+// on trigger and taken back as plain GPIO by set_output(), or by the TIM5 ISR when an io_trigger_at()
+// rise follows the pulse. Widths beyond the 16-bit counter use the queue.
+// The rest stay on the TIM5 queue: 1A/2A/5A (PB0/PB1/PB5) are TIM3 channels sharing one counter,
+// 1B/2B/4A (PB14/PB13/PB15) TIM1 complementary channels sharing one counter, 6B (PB10) is TIM2_CH3
+// and TIM2 is the ext-clock capture timebase, and 3B (PB12) has no timer channel.
+#define OPM_MAX_WIDTH_US 0xFFFFu
+
+static const struct {
+    jack_output_t jack;
+    uint32_t timer;
+    enum rcc_periph_clken rcc;
+    enum rcc_periph_rst rst;
+    uint8_t af;
+} opm_channels[] = {
+    {JACK_OUT_3A, TIM9,  RCC_TIM9,  RST_TIM9,  GPIO_AF3}, // PA2
+    {JACK_OUT_6A, TIM4,  RCC_TIM4,  RST_TIM4,  GPIO_AF2}, // PB6
+    {JACK_OUT_4B, TIM10, RCC_TIM10, RST_TIM10, GPIO_AF3}, // PB8
+    {JACK_OUT_5B, TIM11, RCC_TIM11, RST_TIM11, GPIO_AF3}, // PB9
+};
+#define NUM_OPM_CHANNELS (sizeof(opm_channels) / sizeof(opm_channels[0]))
+
+// Per-jack timer base (0 = software timed). Not const: read by the RAM-resident set_output().
+static uint32_t opm_timer_of[NUM_JACK_OUTPUTS];
+static volatile uint32_t opm_af_mask = 0; // Jacks handed to their timer since the last set_output()
+
+// --- Per-Output Pulse Width ---
+static uint32_t pulse_width_us[NUM_JACK_OUTPUTS];
+static uint8_t pulse_duty_percent[NUM_JACK_OUTPUTS];
+static uint32_t last_trigger_us[NUM_JACK_OUTPUTS];
+static uint32_t has_last_trigger_mask = 0;
 
 // --- Public Function Implementations ---
 
@@ -101,57 +170,181 @@ void io_init(void) {
     }
 }
 
-// Initialize the hardware timer (TIM3) for pulse management
+// Initialize the hardware timer (TIM5) used as the output event timebase
 void pulse_timer_init(void) {
      // Initialize pulse timers state
     for (int i = 0; i < NUM_JACK_OUTPUTS; i++) {
         pulse_timers[i].active = false;
-        pulse_timers[i].end_time_ms = 0;
+        pulse_timers[i].end_time_us = 0;
+    }
+    event_count = 0;
+    static const uint32_t jack_width_us[JACK_OUT_6B + 1] = JACK_PULSE_WIDTH_US;
+    static const uint8_t jack_duty_percent[JACK_OUT_6B + 1] = JACK_PULSE_DUTY_PERCENT;
+    for (int i = 0; i < NUM_JACK_OUTPUTS; i++) {
+        pulse_width_us[i] = DEFAULT_PULSE_WIDTH_US;
+        pulse_duty_percent[i] = DEFAULT_PULSE_DUTY_PERCENT;
     }
+    for (int i = JACK_OUT_1A; i <= JACK_OUT_6B; i++) { // Per-jack table from variables.h
+        io_set_pulse_width_us((jack_output_t)i, jack_width_us[i]);
+        io_set_pulse_duty((jack_output_t)i, jack_duty_percent[i]);
+    }
+    has_last_trigger_mask = 0;
+
+    rcc_periph_clock_enable(PULSE_TIMER_RCC);
+
+    // Reset timer registers to default state before configuration
+    rcc_periph_reset_pulse(PULSE_TIMER_RST);
+
+    uint32_t timer_clock_freq = rcc_get_timer_clk_freq(PULSE_TIMER); // Get actual timer frequency
+    uint32_t prescaler = (timer_clock_freq / 1000000) - 1; // 1 MHz count frequency
+
+    timer_set_mode(PULSE_TIMER, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+    timer_set_prescaler(PULSE_TIMER, prescaler);
+    timer_set_period(PULSE_TIMER, 0xFFFFFFFFu); // Free-running, wraps every ~71 min
+    timer_generate_event(PULSE_TIMER, TIM_EGR_UG); // Load prescaler now
+    TIM_SR(PULSE_TIMER) = 0;
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+    timer_enable_counter(PULSE_TIMER);
+
+    for (unsigned c = 0; c < NUM_OPM_CHANNELS; c++) {
+        uint32_t tim = opm_channels[c].timer;
+        jack_output_t j = opm_channels[c].jack;
+
+        rcc_periph_clock_enable(opm_channels[c].rcc);
+        rcc_periph_reset_pulse(opm_channels[c].rst);
+        timer_set_mode(tim, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+        timer_one_shot_mode(tim);
+        timer_set_prescaler(tim, (rcc_get_timer_clk_freq(tim) / 1000000) - 1);
+        timer_set_period(tim, DEFAULT_PULSE_WIDTH_US <= OPM_MAX_WIDTH_US ? DEFAULT_PULSE_WIDTH_US : OPM_MAX_WIDTH_US);
+        timer_set_oc_mode(tim, TIM_OC1, TIM_OCM_PWM2); // Inactive while CNT < CCR1, so idle LOW at CNT = 0
+        timer_set_oc_value(tim, TIM_OC1, 1);
+        timer_set_oc_polarity_high(tim, TIM_OC1);
+        timer_enable_oc_output(tim, TIM_OC1);
+        timer_generate_event(tim, TIM_EGR_UG); // Load prescaler; CEN stays clear
+
+        gpio_set_af(jack_output_map[j].port, opm_channels[c].af, jack_output_map[j].pin);
+        opm_timer_of[j] = tim;
+    }
+    opm_af_mask = 0; // Pins stay GPIO until the first hardware trigger
+}
 
-    rcc_periph_clock_enable(RCC_TIM3); // Enable TIM3 clock
+KRONO_RAMFUNC uint32_t io_now_us(void) {
+    return TIM_CNT(PULSE_TIMER);
+}
 
-    // Reset TIM3 registers to default state before configuration
-    rcc_periph_reset_pulse(RST_TIM3);
+// Arm CC1 to the queue head, or stop interrupting when the queue is empty.
+// Caller holds the TIM5 IRQ masked or runs inside the ISR.
+static KRONO_RAMFUNC void arm_next_event(void) {
+    if (event_count == 0) {
+        TIM_DIER(PULSE_TIMER) &= ~TIM_DIER_CC1IE;
+        return;
+    }
+    TIM_CCR1(PULSE_TIMER) = event_queue[0].at_us;
+    TIM_SR(PULSE_TIMER) = ~TIM_SR_CC1IF;
+    TIM_DIER(PULSE_TIMER) |= TIM_DIER_CC1IE;
+    // Deadline already passed (or passes while arming): the compare would only match after a
+    // full wrap, so raise the CC1 event by software instead.
+    if ((int32_t)(event_queue[0].at_us - TIM_CNT(PULSE_TIMER)) <= 0) {
+        TIM_EGR(PULSE_TIMER) = TIM_EGR_CC1G;
+    }
+}
 
-    // Configure TIM3 for 1ms interrupts.
-    uint32_t timer_clock_freq = rcc_get_timer_clk_freq(TIM3); // Get actual timer frequency
-    uint32_t prescaler = (timer_clock_freq / 1000000) - 1; // For 1MHz count frequency
-    uint32_t period = 1000 - 1; // Count to 1000 for 1ms period (1MHz / 1000 = 1kHz)
+// Drop every pending event for one jack. Caller masks the TIM5 IRQ.
+static void event_queue_remove(jack_output_t jack) {
+    uint8_t out = 0;
+    for (uint8_t i = 0; i < event_count; i++) {
+        if (event_queue[i].jack != (uint8_t)jack) {
+            event_queue[out++] = event_queue[i];
+        }
+    }
+    event_count = out;
+}
 
-    timer_set_mode(TIM3, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
-    timer_set_prescaler(TIM3, prescaler);
-    timer_set_period(TIM3, period);
-    timer_enable_preload(TIM3);
-    timer_enable_irq(TIM3, TIM_DIER_UIE);
-    nvic_enable_irq(NVIC_TIM3_IRQ);
-    timer_enable_counter(TIM3);
+// Drop one entry by index. Caller masks the TIM5 IRQ.
+static void event_queue_remove_at(uint8_t index) {
+    for (uint8_t i = index + 1u; i < event_count; i++) {
+        event_queue[i - 1u] = event_queue[i];
+    }
+    event_count--;
 }
 
-// Hardware Timer 3 Interrupt Service Routine
-void tim3_isr(void) {
-    if (timer_get_flag(TIM3, TIM_SR_UIF)) {
-        timer_clear_flag(TIM3, TIM_SR_UIF);
+// Insert keeping the queue sorted. Returns false if full. Caller masks the TIM5 IRQ.
+static KRONO_RAMFUNC bool event_queue_insert(uint32_t at_us, jack_output_t jack, bool level) {
+    if (event_count >= IO_EVENT_QUEUE_SIZE) return false;
+    uint8_t i = event_count;
+    while (i > 0 && (int32_t)(event_queue[i - 1].at_us - at_us) > 0) {
+        event_queue[i] = event_queue[i - 1];
+        i--;
+    }
+    event_queue[i].at_us = at_us;
+    event_queue[i].jack = (uint8_t)jack;
+    event_queue[i].level = level;
+    event_count++;
+    return true;
+}
+
+// Queue the next pulse of a burst (rise + fall), or finish it. Caller masks the TIM5 IRQ or is the ISR.
+static KRONO_RAMFUNC void burst_schedule_next(uint8_t j) {
+    volatile io_burst_t *b = &bursts[j];
+    if (b->next >= b->count) {
+        burst_mask &= ~(1u << j);
+        return;
+    }
+    if (event_count + 2u > IO_EVENT_QUEUE_SIZE) {
+        burst_mask &= ~(1u << j);
+        g_io_dropped_triggers += (uint32_t)(b->count - b->next);
+        return;
+    }
+    // count <= IO_BURST_MAX_COUNT and span <= IO_BURST_MAX_SPAN_US keep this product in 32 bits
+    uint32_t rise = b->start_us + ((uint32_t)b->next * b->span_us) / b->count;
+    b->next++;
+    event_queue_insert(rise, (jack_output_t)j, true);
+    event_queue_insert(rise + b->width_us, (jack_output_t)j, false);
+}
 
-        uint32_t current_time_ms = millis();
+// Two-bit MODER field for a single-pin mask
+static inline KRONO_RAMFUNC void pin_set_mode(uint32_t port, uint16_t pin, uint32_t mode) {
+    uint32_t shift = 2u * (uint32_t)__builtin_ctz(pin);
+    GPIO_MODER(port) = (GPIO_MODER(port) & ~(3u << shift)) | (mode << shift);
+}
 
-        // Iterate ONLY over outputs managed by this timer (Group A/B)
-        for (jack_output_t j = JACK_OUT_1A; j <= JACK_OUT_6B; j++) {
-            // Skip the gap between groups if enums aren't contiguous
-            if (j > JACK_OUT_6A && j < JACK_OUT_1B) continue;
+static inline KRONO_RAMFUNC bool pin_is_af(uint32_t port, uint16_t pin) {
+    uint32_t shift = 2u * (uint32_t)__builtin_ctz(pin);
+    return ((GPIO_MODER(port) >> shift) & 3u) == GPIO_MODE_AF;
+}
 
-            if (((volatile pulse_timer_t*)&pulse_timers[j])->active) {
-                 uint32_t end_time = ((volatile pulse_timer_t*)&pulse_timers[j])->end_time_ms;
+// TIM5 compare ISR: apply every due event, re-arm for the next (SRAM, direct register access only)
+KRONO_RAMFUNC void tim5_isr(void) {
+    CYCLE_PROFILE_BEGIN(CYCLE_PROFILE_PULSE_TIMER_ISR);
+    TIM_SR(PULSE_TIMER) = ~TIM_SR_CC1IF; // rc_w0
 
-                 if ((int32_t)(current_time_ms - end_time) >= 0) {
-                    if (jack_output_map[j].port != 0) {
-                        gpio_clear(jack_output_map[j].port, jack_output_map[j].pin);
-                    }
-                    ((volatile pulse_timer_t*)&pulse_timers[j])->active = false;
-                }
+    while (event_count > 0 && (int32_t)(event_queue[0].at_us - TIM_CNT(PULSE_TIMER)) <= 0) {
+        uint8_t j = event_queue[0].jack;
+        bool level = event_queue[0].level;
+        for (uint8_t i = 1; i < event_count; i++) {
+            event_queue[i - 1] = event_queue[i];
+        }
+        event_count--;
+
+        GPIO_BSRR(jack_output_map[j].port) = level ? jack_output_map[j].pin
+                                                   : (uint32_t)jack_output_map[j].pin << 16;
+        if (level) {
+            // Scheduled behind a one-pulse pulse (now over): take the pin back from the timer.
+            // opm_af_mask is left to the main loop; opm_pulse() re-checks MODER.
+            if (opm_af_mask & (1u << j)) {
+                pin_set_mode(jack_output_map[j].port, jack_output_map[j].pin, GPIO_MODE_OUTPUT);
+            }
+            rise_pending_mask &= ~(1u << j);
+            ((volatile pulse_timer_t*)&pulse_timers[j])->active = true;
+        } else {
+            ((volatile pulse_timer_t*)&pulse_timers[j])->active = false;
+            if (burst_mask & (1u << j)) {
+                burst_schedule_next(j);
             }
         }
     }
+    arm_next_event();
+    CYCLE_PROFILE_END(CYCLE_PROFILE_PULSE_TIMER_ISR);
 }
 
 // Read digital input state
@@ -186,7 +379,7 @@ void io_set_protections(bool enable) {
 }
 
 // Set the state (HIGH/LOW) of a specific output jack
-void set_output(jack_output_t jack, bool state) {
+KRONO_RAMFUNC void set_output(jack_output_t jack, bool state) {
     if (jack >= NUM_JACK_OUTPUTS || jack_output_map[jack].port == 0) return;
 
      // Apply only to defined active outputs (including Aux LED now)
@@ -197,48 +390,381 @@ void set_output(jack_output_t jack, bool state) {
 
     if (!is_active_output) return;
 
-    if (state) { gpio_set(jack_output_map[jack].port, jack_output_map[jack].pin); }
-    else { gpio_clear(jack_output_map[jack].port, jack_output_map[jack].pin); }
+    // BSRR: low half sets, high half resets (single store, no read-modify-write)
+    GPIO_BSRR(jack_output_map[jack].port) = state ? jack_output_map[jack].pin
+                                                  : (uint32_t)jack_output_map[jack].pin << 16;
+
+    // Take the pin back from its one-pulse timer (ODR already holds the requested level)
+    if (opm_af_mask & (1u << jack)) {
+        uint32_t tim = opm_timer_of[jack];
+        TIM_CR1(tim) &= ~TIM_CR1_CEN;
+        TIM_CNT(tim) = 0;
+        pin_set_mode(jack_output_map[jack].port, jack_output_map[jack].pin, GPIO_MODE_OUTPUT);
+        opm_af_mask &= ~(1u << jack);
+    }
+}
+
+static bool jack_is_pulsable(jack_output_t jack) {
+    return (jack <= JACK_OUT_6A) ||                     // Group A
+           (jack >= JACK_OUT_1B && jack <= JACK_OUT_6B); // Group B
+}
+
+// Hardware one-pulse: preload delay + width, hand the pin to the timer, start. A trigger landing
+// while the previous pulse is still HIGH forces the pin LOW and rises again after the minimum gap.
+static void opm_pulse(jack_output_t jack, uint32_t width_us) {
+    uint32_t tim = opm_timer_of[jack];
+    uint32_t delay = 1;
+
+    if (TIM_CR1(tim) & TIM_CR1_CEN) {
+        if (TIM_CNT(tim) < TIM_CCR1(tim)) { // Previous retrigger still waiting out its gap
+            g_io_dropped_triggers++;
+            return;
+        }
+        TIM_CCMR1(tim) = (TIM_CCMR1(tim) & ~TIM_CCMR1_OC1M_MASK) | TIM_CCMR1_OC1M_FORCE_LOW;
+        delay = PULSE_MIN_LOW_GAP_US;
+    }
+
+    TIM_CCR1(tim) = delay;
+    TIM_ARR(tim) = delay + width_us - 1u;
+    TIM_CNT(tim) = 0;
+    TIM_CCMR1(tim) = (TIM_CCMR1(tim) & ~TIM_CCMR1_OC1M_MASK) | TIM_CCMR1_OC1M_PWM2;
+    if (!pin_is_af(jack_output_map[jack].port, jack_output_map[jack].pin)) {
+        GPIO_BSRR(jack_output_map[jack].port) = (uint32_t)jack_output_map[jack].pin << 16;
+        pin_set_mode(jack_output_map[jack].port, jack_output_map[jack].pin, GPIO_MODE_AF);
+    }
+    opm_af_mask |= 1u << jack;
+    TIM_CR1(tim) |= TIM_CR1_CEN; // OPM clears CEN at the update event
+}
+
+// Software pulse on the TIM5 queue. If the jack is still HIGH, its pending fall is replaced:
+// the pin drops now, the rise is queued after the minimum gap, then the new fall.
+static void queued_pulse(jack_output_t jack, uint32_t width_us) {
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+
+    uint32_t bit = 1u << jack;
+    bool opm_busy = opm_timer_of[jack] != 0 && (TIM_CR1(opm_timer_of[jack]) & TIM_CR1_CEN);
+    bool still_high = pulse_timers[jack].active || opm_busy;
+
+    if (rise_pending_mask & bit) {
+        g_io_dropped_triggers++; // Previous retrigger still waiting out its gap
+    } else if (event_count + (still_high ? 2u : 1u) > IO_EVENT_QUEUE_SIZE) {
+        g_io_dropped_triggers++;
+    } else {
+        uint32_t rise_time = io_now_us();
+        if (still_high) {
+            event_queue_remove(jack);
+            set_output(jack, false); // Also stops a running one-pulse timer
+            rise_time += PULSE_MIN_LOW_GAP_US;
+            event_queue_insert(rise_time, jack, true);
+            rise_pending_mask |= bit;
+        } else {
+            set_output(jack, true); // Use basic set_output (also reclaims an AF pin)
+        }
+        uint32_t end_time = rise_time + width_us;
+        event_queue_insert(end_time, jack, false);
+        ((volatile pulse_timer_t*)&pulse_timers[jack])->end_time_us = end_time;
+        ((volatile pulse_timer_t*)&pulse_timers[jack])->active = true;
+        arm_next_event();
+    }
+
+    nvic_enable_irq(PULSE_TIMER_IRQ);
 }
 
-// Set output high for a duration using the hardware timer mechanism (Revised)
-// This now ONLY handles Group A and Group B outputs.
+// A single trigger takes the jack over from a running burst
+static void burst_cancel(jack_output_t jack) {
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+    if (burst_mask & (1u << jack)) {
+        event_queue_remove(jack);
+        burst_mask &= ~(1u << jack);
+        arm_next_event();
+    }
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+}
+
+static void output_pulse_us(jack_output_t jack, uint32_t width_us) {
+    if (width_us == 0) width_us = 1;
+    if (burst_mask & (1u << jack)) burst_cancel(jack);
+    if (opm_timer_of[jack] != 0 && !pulse_timers[jack].active && !(rise_pending_mask & (1u << jack)) &&
+        width_us <= OPM_MAX_WIDTH_US - PULSE_MIN_LOW_GAP_US) {
+        opm_pulse(jack, width_us);
+    } else {
+        queued_pulse(jack, width_us);
+    }
+}
+
+// Set output high for a duration (Group A/B only).
 // Aux LED must be pulsed manually or with a different mechanism.
 void set_output_high_for_duration(jack_output_t jack, uint32_t duration_ms) {
     if (jack >= NUM_JACK_OUTPUTS || duration_ms == 0 || jack_output_map[jack].port == 0) {
         return;
     }
+    if (!jack_is_pulsable(jack)) return;
 
-    // Define which outputs are managed by the hardware pulse timer
-    bool is_pulsable_output = (jack <= JACK_OUT_6A) ||                     // Group A
-                              (jack >= JACK_OUT_1B && jack <= JACK_OUT_6B); // Group B
+    output_pulse_us(jack, duration_ms * 1000u);
+}
 
-    // If it's not an output type handled by this timer mechanism, simply return.
-    if (!is_pulsable_output) {
-        return;
+// Width for a trigger at `at_us`, fitted inside this jack's own period; records the trigger time
+static uint32_t trigger_width_us(jack_output_t jack, uint32_t at_us) {
+    uint32_t width = pulse_width_us[jack];
+    uint8_t duty = pulse_duty_percent[jack];
+
+    // Fit the pulse inside this jack's own period so every trigger still gets a rising edge
+    if (has_last_trigger_mask & (1u << jack)) {
+        uint32_t interval = at_us - last_trigger_us[jack];
+        if (interval <= IO_DUTY_MAX_INTERVAL_US) {
+            if (duty != 0) {
+                width = (uint32_t)(((uint64_t)interval * duty) / 100u);
+            } else {
+                uint32_t cap = (uint32_t)(((uint64_t)interval * PULSE_MAX_PERIOD_PERCENT) / 100u);
+                if (width > cap) width = cap;
+            }
+            if (interval > PULSE_MIN_LOW_GAP_US && width > interval - PULSE_MIN_LOW_GAP_US) {
+                width = interval - PULSE_MIN_LOW_GAP_US;
+            }
+        }
     }
+    last_trigger_us[jack] = at_us;
+    has_last_trigger_mask |= 1u << jack;
+    return width;
+}
 
-    // --- Proceed only if it IS a pulsable output (Groups A/B) ---
+void io_trigger(jack_output_t jack) {
+    if (jack >= NUM_JACK_OUTPUTS || !jack_is_pulsable(jack)) return;
 
-    nvic_disable_irq(NVIC_TIM3_IRQ);
+    output_pulse_us(jack, trigger_width_us(jack, io_now_us()));
+}
 
-    if (!pulse_timers[jack].active) {
-        set_output(jack, true); // Use basic set_output
-        uint32_t current_time = millis();
-        ((volatile pulse_timer_t*)&pulse_timers[jack])->end_time_ms = current_time + duration_ms;
+// Group A/B jacks (JACK_OUT_1A..JACK_OUT_6B) as a jack_output_t bit mask
+#define IO_PULSABLE_MASK 0x0FFFu
+
+void io_trigger_mask(uint32_t jack_mask) {
+    uint32_t width[JACK_OUT_6B + 1];
+    uint32_t slow_mask = 0;
+    uint32_t set_a = 0, set_b = 0;
+    uint32_t now = io_now_us();
+
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+    for (uint32_t m = jack_mask & IO_PULSABLE_MASK; m != 0; m &= m - 1u) {
+        jack_output_t jack = (jack_output_t)__builtin_ctz(m);
+        uint32_t bit = 1u << jack;
+        width[jack] = trigger_width_us(jack, now);
+        if (width[jack] == 0) width[jack] = 1;
+        // Only idle software-timed jacks are batched; the rest need the retrigger/one-pulse logic
+        if (opm_timer_of[jack] != 0 || (burst_mask & bit) || (rise_pending_mask & bit) ||
+            pulse_timers[jack].active || event_count >= IO_EVENT_QUEUE_SIZE) {
+            slow_mask |= bit;
+            continue;
+        }
+        event_queue_insert(now + width[jack], jack, false);
+        ((volatile pulse_timer_t*)&pulse_timers[jack])->end_time_us = now + width[jack];
         ((volatile pulse_timer_t*)&pulse_timers[jack])->active = true;
+        if (jack_output_map[jack].port == GPIOA) {
+            set_a |= jack_output_map[jack].pin;
+        } else {
+            set_b |= jack_output_map[jack].pin;
+        }
+    }
+    // One store per port: every idle jack in the step rises on the same bus cycle
+    if (set_b != 0) GPIO_BSRR(GPIOB) = set_b;
+    if (set_a != 0) GPIO_BSRR(GPIOA) = set_a;
+    arm_next_event();
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+
+    for (; slow_mask != 0; slow_mask &= slow_mask - 1u) {
+        jack_output_t jack = (jack_output_t)__builtin_ctz(slow_mask);
+        output_pulse_us(jack, width[jack]);
     }
+}
+
+void io_trigger_at(jack_output_t jack, uint32_t at_us) {
+    if (jack >= NUM_JACK_OUTPUTS || !jack_is_pulsable(jack)) return;
+
+    uint32_t bit = 1u << jack;
+    // Already due: fire through the normal path
+    if ((int32_t)(at_us - io_now_us()) <= 0) {
+        io_trigger(jack);
+        return;
+    }
+    if (burst_mask & bit) burst_cancel(jack);
+
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+    if ((rise_pending_mask & bit) || event_count + 2u > IO_EVENT_QUEUE_SIZE) {
+        g_io_dropped_triggers++; // An earlier rise on this jack is still pending
+    } else {
+        uint32_t tim = opm_timer_of[jack];
+        bool opm_busy = tim != 0 && (TIM_CR1(tim) & TIM_CR1_CEN);
+        // Never rise before the current pulse has ended and rested for the minimum gap. A running
+        // one-pulse pulse ends at its update event; the ISR takes the pin back at the rise.
+        bool busy = pulse_timers[jack].active || opm_busy;
+        uint32_t pulse_end = opm_busy ? io_now_us() + (TIM_ARR(tim) - TIM_CNT(tim)) + 1u
+                                      : pulse_timers[jack].end_time_us;
+        if (busy && (int32_t)(at_us - (pulse_end + PULSE_MIN_LOW_GAP_US)) < 0) {
+            at_us = pulse_end + PULSE_MIN_LOW_GAP_US;
+        }
+        uint32_t width = trigger_width_us(jack, at_us);
+        if ((opm_af_mask & bit) && !opm_busy) set_output(jack, false); // Idle one-pulse pin back to GPIO
+        event_queue_insert(at_us, jack, true);
+        event_queue_insert(at_us + width, jack, false);
+        rise_pending_mask |= bit;
+        ((volatile pulse_timer_t*)&pulse_timers[jack])->end_time_us = at_us + width;
+        arm_next_event();
+    }
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+}
+
+bool io_trigger_pending(jack_output_t jack) {
+    if (jack >= NUM_JACK_OUTPUTS) return false;
+    return (rise_pending_mask & (1u << jack)) != 0;
+}
+
+void io_trigger_at_rescale(uint32_t jack_mask, uint32_t old_interval, uint32_t new_interval) {
+    if (old_interval == 0 || new_interval == 0 || old_interval == new_interval) return;
+
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+    uint32_t now = io_now_us();
+    uint32_t mask = jack_mask & rise_pending_mask & ~burst_mask;
+    for (uint8_t j = 0; j < NUM_JACK_OUTPUTS && mask != 0; j++) {
+        uint32_t bit = 1u << j;
+        if (!(mask & bit)) continue;
+        mask &= ~bit;
+
+        // Pending rise, the fall that ends it, and the fall of a pulse still high before it
+        int16_t rise_i = -1, fall_i = -1, prev_fall_i = -1;
+        for (uint8_t i = 0; i < event_count; i++) {
+            if (event_queue[i].jack != j) continue;
+            if (event_queue[i].level) {
+                rise_i = (int16_t)i;
+            } else if (rise_i < 0) {
+                prev_fall_i = (int16_t)i;
+            } else {
+                fall_i = (int16_t)i;
+                break;
+            }
+        }
+        if (rise_i < 0 || fall_i < 0) continue;
+        uint32_t rise = event_queue[rise_i].at_us;
+        uint32_t width = event_queue[fall_i].at_us - rise;
+        int32_t left = (int32_t)(rise - now);
+        if (left <= (int32_t)PULSE_MIN_LOW_GAP_US) continue; // Retrigger gap, or rising now
+
+        uint64_t scaled = ((uint64_t)(uint32_t)left * new_interval) / old_interval;
+        if (scaled > IO_BURST_MAX_SPAN_US) scaled = IO_BURST_MAX_SPAN_US;
+        uint32_t new_rise = now + (uint32_t)scaled;
+        if (prev_fall_i >= 0 &&
+            (int32_t)(new_rise - (event_queue[prev_fall_i].at_us + PULSE_MIN_LOW_GAP_US)) < 0) {
+            new_rise = event_queue[prev_fall_i].at_us + PULSE_MIN_LOW_GAP_US;
+        }
+        event_queue_remove_at((uint8_t)fall_i);
+        event_queue_remove_at((uint8_t)rise_i);
+        event_queue_insert(new_rise, (jack_output_t)j, true);
+        event_queue_insert(new_rise + width, (jack_output_t)j, false);
+        ((volatile pulse_timer_t*)&pulse_timers[j])->end_time_us = new_rise + width;
+    }
+    arm_next_event();
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+}
+
+// Pulse width for one burst period: the jack's duty or fixed width, leaving the minimum LOW gap
+static uint32_t burst_width_us(jack_output_t jack, uint32_t period) {
+    uint32_t width;
+    if (pulse_duty_percent[jack] != 0) {
+        width = (uint32_t)(((uint64_t)period * pulse_duty_percent[jack]) / 100u);
+    } else {
+        width = pulse_width_us[jack];
+        uint32_t cap = (uint32_t)(((uint64_t)period * PULSE_MAX_PERIOD_PERCENT) / 100u);
+        if (width > cap) width = cap;
+    }
+    if (period > PULSE_MIN_LOW_GAP_US && width > period - PULSE_MIN_LOW_GAP_US) {
+        width = period - PULSE_MIN_LOW_GAP_US;
+    }
+    return width == 0 ? 1 : width;
+}
+
+void io_burst(jack_output_t jack, uint16_t count, uint32_t span_us) {
+    if (jack >= NUM_JACK_OUTPUTS || !jack_is_pulsable(jack) || count == 0 || span_us == 0) return;
+    if (count > IO_BURST_MAX_COUNT) count = IO_BURST_MAX_COUNT;
+    if (span_us > IO_BURST_MAX_SPAN_US) span_us = IO_BURST_MAX_SPAN_US;
+
+    uint32_t width = burst_width_us(jack, span_us / count);
+
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+
+    uint32_t now = io_now_us();
+    bool was_high = pulse_timers[jack].active ||
+                    (opm_timer_of[jack] != 0 && (TIM_CR1(opm_timer_of[jack]) & TIM_CR1_CEN));
+    event_queue_remove(jack);
+    rise_pending_mask &= ~(1u << jack);
+    set_output(jack, false); // Also stops a running one-pulse timer
+    ((volatile pulse_timer_t*)&pulse_timers[jack])->active = false;
+
+    volatile io_burst_t *b = &bursts[jack];
+    b->start_us = was_high ? now + PULSE_MIN_LOW_GAP_US : now;
+    b->span_us = span_us;
+    b->width_us = width;
+    b->count = count;
+    b->next = 0;
+    burst_mask |= 1u << jack;
+    burst_schedule_next((uint8_t)jack); // Pulse 0 is due now: arm_next_event() raises it at once
+    arm_next_event();
+
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+
+    last_trigger_us[jack] = now;
+    has_last_trigger_mask |= 1u << jack;
+}
+
+void io_burst_rescale(uint32_t old_interval, uint32_t new_interval) {
+    if (old_interval == 0 || new_interval == 0 || old_interval == new_interval) return;
+
+    nvic_disable_irq(PULSE_TIMER_IRQ);
+    uint32_t now = io_now_us();
+    for (uint8_t j = 0; j < NUM_JACK_OUTPUTS; j++) {
+        if (!(burst_mask & (1u << j))) continue;
+        volatile io_burst_t *b = &bursts[j];
+
+        // Keep the fraction of the burst already played; the rest runs at the new rate
+        int32_t elapsed = (int32_t)(now - b->start_us);
+        int64_t scaled = ((int64_t)elapsed * new_interval) / old_interval;
+        uint64_t span = ((uint64_t)b->span_us * new_interval) / old_interval;
+        if (span > IO_BURST_MAX_SPAN_US) span = IO_BURST_MAX_SPAN_US;
+        if (span < b->count) span = b->count;
+        b->start_us = now - (uint32_t)(int32_t)scaled;
+        b->span_us = (uint32_t)span;
+        b->width_us = burst_width_us((jack_output_t)j, b->span_us / b->count);
+
+        // Jack LOW: its queued pulse was timed on the old grid, so queue it again.
+        // Jack HIGH: the pending fall stands and the ISR times the next pulse on the new grid.
+        if (!pulse_timers[j].active && b->next > 0) {
+            event_queue_remove((jack_output_t)j);
+            b->next--;
+            burst_schedule_next(j);
+        }
+    }
+    arm_next_event();
+    nvic_enable_irq(PULSE_TIMER_IRQ);
+}
+
+void io_set_pulse_width_us(jack_output_t jack, uint32_t width_us) {
+    if (jack >= NUM_JACK_OUTPUTS || width_us == 0) return;
+    pulse_width_us[jack] = width_us;
+}
 
-    nvic_enable_irq(NVIC_TIM3_IRQ);
+void io_set_pulse_duty(jack_output_t jack, uint8_t percent) {
+    if (jack >= NUM_JACK_OUTPUTS) return;
+    pulse_duty_percent[jack] = percent > IO_DUTY_MAX_PERCENT ? IO_DUTY_MAX_PERCENT : percent;
 }
 
 
 /**
  * @brief Forcibly stops all active timed pulses (Group A/B only) and sets outputs LOW.
- * Disables and re-enables TIM3 IRQ internally for safety.
+ * Disables and re-enables the pulse timer IRQ internally for safety.
  */
 void io_cancel_all_timed_pulses(void) {
-    nvic_disable_irq(NVIC_TIM3_IRQ); // Enter critical section
+    nvic_disable_irq(PULSE_TIMER_IRQ); // Enter critical section
+    event_count = 0;
+    rise_pending_mask = 0;
+    burst_mask = 0;
+    arm_next_event();
 
     // Iterate ONLY over Group A/B outputs
     for (jack_output_t j = JACK_OUT_1A; j <= JACK_OUT_6B; j++) {
@@ -249,13 +775,13 @@ void io_cancel_all_timed_pulses(void) {
                                    (j >= JACK_OUT_1B && j <= JACK_OUT_6B);
 
         if (is_pulsable_output && jack_output_map[j].port != 0) {
-            gpio_clear(jack_output_map[j].port, jack_output_map[j].pin);
+            set_output(j, false); // Also stops a running one-pulse timer
             ((volatile pulse_timer_t*)&pulse_timers[j])->active = false;
-            ((volatile pulse_timer_t*)&pulse_timers[j])->end_time_ms = 0;
+            ((volatile pulse_timer_t*)&pulse_timers[j])->end_time_us = 0;
         }
     }
 
-    nvic_enable_irq(NVIC_TIM3_IRQ); // Exit critical section
+    nvic_enable_irq(PULSE_TIMER_IRQ); // Exit critical section
 }
 
 
@@ -272,7 +798,7 @@ void io_all_outputs_off(void) {
                                   (j >= JACK_OUT_1B && j <= JACK_OUT_6B);
 
         if (is_group_ab_output && jack_output_map[j].port != 0) {
-            gpio_clear(jack_output_map[j].port, jack_output_map[j].pin);
+            set_output(j, false); // Also stops a running one-pulse timer
         }
     }
 }
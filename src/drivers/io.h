@@ -2,6 +2,7 @@
 #include <libopencm3/stm32/gpio.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include "../util/ramfunc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -61,31 +62,124 @@ typedef enum {
  */
 void io_init(void);
 
+/**
+ * @brief Capacity of the pending output-edge queue (one entry per scheduled pin change).
+ * A jack with a scheduled trigger behind a running pulse holds three (fall, rise, fall),
+ * so all twelve outputs can have one io_trigger_at() outstanding.
+ */
+#define IO_EVENT_QUEUE_SIZE 40
+
 /**
  * @brief Initialize the hardware timer based pulse management system.
+ * TIM5 free-runs at 1 MHz; pulse ends are compare events, so there is no periodic interrupt.
  * Must be called after system clocks are configured.
  */
 void pulse_timer_init(void);
 
+/**
+ * @brief Output timebase (TIM5 counter) in microseconds. Wraps every ~71 minutes;
+ * compare with signed differences.
+ */
+KRONO_RAMFUNC uint32_t io_now_us(void);
+
 /**
  * @brief Set output state for a specific jack
  * @param output Output jack enum to configure
  * @param state true = HIGH, false = LOW
  */
-void set_output(jack_output_t output, bool state);
+KRONO_RAMFUNC void set_output(jack_output_t output, bool state);
 
 /**
  * @brief Set an output HIGH for a specific duration in milliseconds.
  * The pin will automatically be set LOW after the duration expires.
- * Uses a hardware timer (TIM3) interrupt for accurate timing.
+ * The pulse end is a TIM5 compare event: exact to the 1 us tick.
  * @param output Output jack enum to pulse.
  * @param duration_ms Duration of the pulse in milliseconds.
  */
 void set_output_high_for_duration(jack_output_t output, uint32_t duration_ms);
 
+/** @brief Duty ceiling so a duty-based gate always leaves a low gap before the next trigger. */
+#define IO_DUTY_MAX_PERCENT 95
+/** @brief Intervals longer than this (us) are treated as a restart: the fixed width is used instead. */
+#define IO_DUTY_MAX_INTERVAL_US 10000000u
+
+/**
+ * @brief Fire a trigger on a Group A/B output using its configured width.
+ * 3A (TIM9), 6A (TIM4), 4B (TIM10) and 5B (TIM11) run in hardware one-pulse mode up to 65 ms;
+ * every other output, and longer widths, fall back to the TIM5 queue. Fixed widths are shortened
+ * to PULSE_MAX_PERIOD_PERCENT of the jack's trigger interval. A trigger arriving while the
+ * previous pulse is still high forces the pin low and rises again after PULSE_MIN_LOW_GAP_US.
+ */
+void io_trigger(jack_output_t output);
+
+/**
+ * @brief io_trigger() on every Group A/B jack in `jack_mask` (bit per jack_output_t) at one instant.
+ * Idle software-timed jacks rise together with a single BSRR store per port; one-pulse, bursting
+ * or still-high jacks take the io_trigger() path right after.
+ */
+void io_trigger_mask(uint32_t jack_mask);
+
+/**
+ * @brief io_trigger() at a future io_now_us() time, rising exactly then from the TIM5 queue.
+ * Due or past times trigger at once. Behind a pulse still running on the jack (queued or one-pulse)
+ * the rise waits for its end plus PULSE_MIN_LOW_GAP_US.
+ * A second scheduled trigger on the jack before the first one rises is dropped.
+ */
+void io_trigger_at(jack_output_t output, uint32_t at_us);
+
+/**
+ * @brief True while a trigger queued by io_trigger_at() (or a retrigger gap) has not risen yet.
+ * Modes chaining triggers on a jack queue the next one once this clears.
+ */
+bool io_trigger_pending(jack_output_t output);
+
+/**
+ * @brief Stretch the time left to each pending io_trigger_at() rise on the jacks in `jack_mask`
+ * (bit per jack_output_t) by new_interval/old_interval, for triggers placed on the tempo grid.
+ */
+void io_trigger_at_rescale(uint32_t jack_mask, uint32_t old_interval, uint32_t new_interval);
+
+/** @brief Longest burst accepted by io_burst(); with IO_BURST_MAX_SPAN_US keeps k*span in 32 bits. */
+#define IO_BURST_MAX_COUNT 255u
+/** @brief Longest burst span (us). */
+#define IO_BURST_MAX_SPAN_US 16000000u
+
+/**
+ * @brief Emit `count` evenly spaced pulses over `span_us`, the first one now.
+ * Fully timer-driven: the TIM5 ISR queues each next pulse, so there is no main-loop work per edge
+ * and rates reach the audio range. Width follows the output's setting, fitted to span/count.
+ * Replaces a burst still running on the jack; io_trigger() on the jack cancels the burst.
+ */
+void io_burst(jack_output_t output, uint16_t count, uint32_t span_us);
+
+/**
+ * @brief Stretch every running burst by new_interval/old_interval around now.
+ * The played fraction is kept, so the remaining pulses land on the new tempo grid at once.
+ */
+void io_burst_rescale(uint32_t old_interval, uint32_t new_interval);
+
+/**
+ * @brief Fixed pulse width for io_trigger() on this output, in microseconds.
+ */
+void io_set_pulse_width_us(jack_output_t output, uint32_t width_us);
+
+/**
+ * @brief Pulse width as a percentage of the output's own trigger-to-trigger interval (gate mode).
+ * 0 selects the fixed width; values are capped at IO_DUTY_MAX_PERCENT. The first trigger after
+ * a pause uses the fixed width.
+ */
+void io_set_pulse_duty(jack_output_t output, uint8_t percent);
+
+/**
+ * @brief Triggers that could not get their own rising edge (retrigger during the minimum gap,
+ * or queue full). Stays 0 while every scheduled event produces a pulse.
+ * Read it with a debugger (`print g_io_dropped_triggers`), like g_boot_profile.
+ */
+extern volatile uint32_t g_io_dropped_triggers;
+
 /**
  * @brief Forcibly stops all active timed pulses and sets outputs LOW.
- * Disables and re-enables TIM3 IRQ internally for safety.
+ * Disables and re-enables the pulse timer IRQ internally for safety.
  */
 void io_cancel_all_timed_pulses(void);
 
@@ -94,7 +188,7 @@ void io_cancel_all_timed_pulses(void);
  */
 void io_all_outputs_off(void);
 
-/* Function io_update_pulse_timers removed as logic moved to TIM3 ISR */
+/* Function io_update_pulse_timers removed as logic moved to the pulse timer ISR */
 
 /**
  * @brief Read digital input state
@@ -0,0 +1,88 @@
+#include "pattern_bank.h"
+#include "variables.h"
+#include "modes/mode_rhythm_shared.h" // For MODE_RHYTHM_NUM_OUTPUTS
+
+#include <stddef.h>
+
+// Flash image layout from the libopencm3 linker script: .text ends at _etext, then the load image
+// of .data (initialized data plus the KRONO_RAMFUNC code) sits at _data_loadaddr.
+extern const uint32_t _etext, _data_loadaddr, _data, _edata;
+
+static const uint8_t *const region = (const uint8_t *)PATTERN_BANK_FLASH_ADDR;
+static int32_t valid_banks = -1; // -1 until the image has been checked
+
+static const pattern_bank_header_t *header(void) {
+    return (const pattern_bank_header_t *)region;
+}
+
+static uint32_t record_offset(uint16_t index) {
+    const uint32_t *offsets = (const uint32_t *)(region + sizeof(pattern_bank_header_t));
+    return offsets[index];
+}
+
+static bool record_fits(uint32_t offset, uint32_t image_size) {
+    if (offset < sizeof(pattern_bank_header_t) || offset + sizeof(pattern_bank_record_t) > image_size) {
+        return false;
+    }
+    const pattern_bank_record_t *rec = (const pattern_bank_record_t *)(region + offset);
+    if (rec->steps == 0u || rec->steps > PATTERN_BANK_MAX_STEPS ||
+        (rec->steps % MODE_RHYTHM_STEPS_PER_BEAT) != 0u || rec->track_count > MODE_RHYTHM_NUM_OUTPUTS) {
+        return false;
+    }
+    uint32_t body = (uint32_t)rec->track_count * ((rec->steps + 7u) / 8u) + rec->name_len;
+    return offset + sizeof(pattern_bank_record_t) + body <= image_size;
+}
+
+static uint16_t validate(void) {
+    uintptr_t image_end = (uintptr_t)&_data_loadaddr + ((uintptr_t)&_edata - (uintptr_t)&_data);
+    if ((uintptr_t)&_etext > PATTERN_BANK_FLASH_ADDR || image_end > PATTERN_BANK_FLASH_ADDR) {
+        return 0; // Firmware has grown into the bank sector (flash_limit.ld fails such a link)
+    }
+    const pattern_bank_header_t *h = header();
+    if (h->magic != PATTERN_BANK_MAGIC || h->version != PATTERN_BANK_VERSION ||
+        h->image_size > PATTERN_BANK_FLASH_SIZE ||
+        h->image_size < sizeof(pattern_bank_header_t) + (uint32_t)h->bank_count * sizeof(uint32_t)) {
+        return 0;
+    }
+    uint32_t sum = 0;
+    for (uint32_t i = sizeof(pattern_bank_header_t); i < h->image_size; i++) {
+        sum += region[i];
+    }
+    if (sum != h->checksum) {
+        return 0;
+    }
+    for (uint16_t b = 0; b < h->bank_count; b++) {
+        if (!record_fits(record_offset(b), h->image_size)) {
+            return 0;
+        }
+    }
+    return h->bank_count;
+}
+
+uint16_t pattern_bank_count(void) {
+    if (valid_banks < 0) {
+        valid_banks = validate();
+    }
+    return (uint16_t)valid_banks;
+}
+
+bool pattern_bank_read(uint16_t index, uint64_t *tracks, uint8_t *steps) {
+    if (index >= pattern_bank_count()) {
+        return false;
+    }
+    const pattern_bank_record_t *rec = (const pattern_bank_record_t *)(region + record_offset(index));
+    const uint8_t *hits = (const uint8_t *)(rec + 1);
+    uint8_t track_bytes = (uint8_t)((rec->steps + 7u) / 8u);
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        uint64_t t = 0;
+        if (i < rec->track_count) {
+            for (uint8_t k = 0; k < track_bytes; k++) {
+                t |= (uint64_t)hits[k] << (8u * k);
+            }
+            hits += track_bytes;
+        }
+        tracks[i] = t;
+    }
+    *steps = rec->steps;
+    return true;
+}
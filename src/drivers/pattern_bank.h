@@ -0,0 +1,46 @@
+#ifndef PATTERN_BANK_H
+#define PATTERN_BANK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// User pattern banks live in flash sector 6, written by DFU from an image built with
+// scripts/krono_bank_compiler.py. They are read in place: nothing is copied to RAM.
+#define PATTERN_BANK_FLASH_ADDR 0x08040000
+#define PATTERN_BANK_FLASH_SIZE (128u * 1024u)
+
+#define PATTERN_BANK_MAGIC 0x4B4E424Bu // "KBNK"
+#define PATTERN_BANK_VERSION 1u
+#define PATTERN_BANK_MAX_STEPS 64u
+
+// --- Image format (little endian, every offset from the image start) ---
+// header, then bank_count uint32_t record offsets, then the records.
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t bank_count;
+    uint32_t image_size; // Bytes, header included
+    uint32_t checksum;   // Byte sum of the image after the header
+} pattern_bank_header_t;
+
+// One bank: track_count tracks of (steps + 7) / 8 bytes each, bit s = step s (LSB of the first
+// byte is step 0), in 2A,2B,3A,...,6B order; then name_len bytes of name (not terminated).
+typedef struct {
+    uint8_t steps;       // 4..PATTERN_BANK_MAX_STEPS, a multiple of MODE_RHYTHM_STEPS_PER_BEAT
+    uint8_t track_count; // Up to MODE_RHYTHM_NUM_OUTPUTS; missing tracks are silent
+    uint8_t name_len;
+    uint8_t reserved;
+} pattern_bank_record_t;
+
+/** Banks in the flash image; 0 when the region is blank or fails validation (checked once). */
+uint16_t pattern_bank_count(void);
+
+/**
+ * @brief Decode bank `index` straight from flash.
+ * @param tracks Receives MODE_RHYTHM_NUM_OUTPUTS step sets.
+ * @param steps Receives the bank length.
+ * @return false if there is no such bank.
+ */
+bool pattern_bank_read(uint16_t index, uint64_t *tracks, uint8_t *steps);
+
+#endif // PATTERN_BANK_H
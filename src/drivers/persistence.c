@@ -1,8 +1,9 @@
 #include "persistence.h"
+#include "rtc.h"
 #include "main_constants.h"
+#include "variables.h"
 #include "modes/mode_chaos.h" // For CHAOS_DIVISOR_DEFAULT, CHAOS_DIVISOR_MIN, CHAOS_DIVISOR_STEP
 #include "modes/mode_swing.h" // For NUM_SWING_PROFILES 
-#include "modes/mode_fixed.h" // For NUM_FIXED_BANKS
 #include "modes/mode_rhythm_shared.h" // For MODE_RHYTHM_NUM_OUTPUTS
 
 #include <libopencm3/stm32/flash.h>
@@ -23,8 +24,8 @@ static krono_state_t get_default_krono_state(void) {
     default_state.swing_profile_index_A = 3; // Default to Medium swing for Group A
     default_state.swing_profile_index_B = 3; // Default to Medium swing for Group B
     default_state.chaos_mode_divisor = CHAOS_DIVISOR_DEFAULT;
-    default_state.fixed_bank = 0;
-    default_state.fixed_sequence = 0;
+    default_state.chaos_engine = CHAOS_ENGINE_LIVE_LORENZ;
+    persistence_set_fixed_bank(&default_state, 0);
     default_state.drift_active = false;
     default_state.drift_probability = 0;
     default_state.drift_ramp_up = true;
@@ -68,8 +69,109 @@ static krono_state_t get_default_krono_state(void) {
     return default_state;
 }
 
+// --- Flash slot log (sector 7) ---
+// Each save appends a full record to the next blank slot; the newest valid record wins.
+// One blank slot is always kept in reserve so the PVD emergency save never has to erase.
+
+static int32_t last_valid_slot = -1;    // Newest record with valid magic + checksum
+static uint32_t next_free_slot = 0;     // First blank slot (PERSISTENCE_NUM_SLOTS = log full)
+static volatile bool flash_write_in_progress = false; // Main-context write the PVD ISR must not interleave with
+
+static uint32_t slot_addr(uint32_t slot) {
+    return PERSISTENCE_FLASH_STORAGE_ADDR + slot * PERSISTENCE_SLOT_STRIDE;
+}
+
+static bool slot_is_blank(uint32_t slot) {
+    const uint32_t *p = (const uint32_t *)slot_addr(slot);
+    for (size_t i = 0; i < PERSISTENCE_SLOT_STRIDE / sizeof(uint32_t); i++) {
+        if (p[i] != 0xFFFFFFFFu) return false;
+    }
+    return true;
+}
+
+static bool slot_is_valid(uint32_t slot) {
+    const krono_state_t *rec = (const krono_state_t *)slot_addr(slot);
+    return rec->magic_number == PERSISTENCE_MAGIC_NUMBER
+        && rec->checksum == persistence_calculate_checksum(rec);
+}
+
+static void log_scan(void) {
+    // Records are appended in order: the first non-blank slot from the end bounds the log.
+    uint32_t used = PERSISTENCE_NUM_SLOTS;
+    while (used > 0 && slot_is_blank(used - 1)) {
+        used--;
+    }
+    next_free_slot = used;
+    last_valid_slot = -1;
+    for (uint32_t i = used; i > 0; i--) {
+        if (slot_is_valid(i - 1)) {
+            last_valid_slot = (int32_t)(i - 1);
+            break;
+        }
+    }
+}
+
+static uint32_t flash_wait_idle(void) {
+    uint32_t flash_sr_status;
+    do {
+        flash_sr_status = FLASH_SR;
+    } while ((flash_sr_status & FLASH_SR_BSY));
+    return flash_sr_status & (FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_WRPERR);
+}
+
+static bool log_erase(void) {
+    flash_unlock();
+    // Sector 7 (0x08060000 - 0x0807FFFF for STM32F411CE), voltage range index 2 (PSIZE x32)
+    flash_erase_sector(PERSISTENCE_FLASH_SECTOR, 2);
+    bool ok = (flash_wait_idle() == 0);
+    flash_lock();
+    last_valid_slot = -1;
+    next_free_slot = 0;
+    return ok;
+}
+
+// Programs one record. The magic word goes last so a write torn by power loss never validates.
+static bool program_slot(uint32_t slot, const krono_state_t *state_to_write) {
+    const uint32_t *p_src = (const uint32_t *)state_to_write;
+    uint32_t flash_addr = slot_addr(slot);
+    size_t num_words = (sizeof(krono_state_t) + sizeof(uint32_t) - 1) / sizeof(uint32_t); // Ceiling division
+    bool ok = true;
+
+    flash_unlock();
+    for (size_t n = 1; n <= num_words && ok; ++n) {
+        size_t i = n % num_words; // 1, 2, ..., num_words - 1, then 0 (magic)
+        flash_program_word(flash_addr + (i * sizeof(uint32_t)), p_src[i]);
+        ok = (flash_wait_idle() == 0);
+    }
+    FLASH_CR &= ~FLASH_CR_PG;
+    flash_lock();
+
+    next_free_slot = slot + 1; // Consumed even if torn
+    return ok;
+}
+
+static krono_state_t with_checksum(const krono_state_t *state) {
+    krono_state_t state_to_write = *state;
+    state_to_write.checksum = 0; // Zero out checksum field before calculating
+    state_to_write.checksum = persistence_calculate_checksum(&state_to_write);
+    return state_to_write;
+}
+
 void persistence_init(void) {
-    // No specific initialization needed for now.
+    rtc_bkp_init(); // Backup registers hold the hot fields
+    log_scan();
+
+    // Compact while nothing is playing yet, so saves during performance never erase.
+    if (PERSISTENCE_NUM_SLOTS - next_free_slot < PERSISTENCE_MIN_FREE_SLOTS_AT_BOOT) {
+        krono_state_t newest;
+        bool have_newest = (last_valid_slot >= 0);
+        if (have_newest) {
+            memcpy(&newest, (const void *)slot_addr((uint32_t)last_valid_slot), sizeof(krono_state_t));
+        }
+        if (log_erase() && have_newest && program_slot(0, &newest)) {
+            last_valid_slot = 0;
+        }
+    }
 }
 
 uint32_t persistence_calculate_checksum(const krono_state_t *state) {
@@ -84,22 +186,15 @@ uint32_t persistence_calculate_checksum(const krono_state_t *state) {
 bool persistence_load_state(krono_state_t *state) {
     if (!state) return false;
 
-    const krono_state_t *flash_state = (const krono_state_t *)PERSISTENCE_FLASH_STORAGE_ADDR;
-
-    if (flash_state->magic_number != PERSISTENCE_MAGIC_NUMBER) {
-        *state = get_default_krono_state();
-        return false; 
-    }
-
-    uint32_t calculated_checksum = persistence_calculate_checksum(flash_state);
-    if (flash_state->checksum != calculated_checksum) {
+    if (last_valid_slot < 0) {
         *state = get_default_krono_state();
         return false; 
     }
+    const krono_state_t *flash_state = (const krono_state_t *)slot_addr((uint32_t)last_valid_slot);
 
     memcpy(state, flash_state, sizeof(krono_state_t));
     
-    if (state->op_mode >= NUM_OPERATIONAL_MODES) state->op_mode = MODE_DEFAULT;
+    if (!mode_is_enabled(state->op_mode)) state->op_mode = MODE_DEFAULT;
     if (state->tempo_interval < MIN_INTERVAL || state->tempo_interval > MAX_INTERVAL) {
         state->tempo_interval = DEFAULT_TEMPO_INTERVAL;
     }
@@ -109,9 +204,10 @@ bool persistence_load_state(krono_state_t *state) {
         (state->chaos_mode_divisor % CHAOS_DIVISOR_STEP != 0)) {
         state->chaos_mode_divisor = CHAOS_DIVISOR_DEFAULT;
     }
+    if (state->chaos_engine >= NUM_CHAOS_ENGINES) state->chaos_engine = CHAOS_ENGINE_LIVE_LORENZ;
     if (state->swing_profile_index_A >= NUM_SWING_PROFILES) state->swing_profile_index_A = 3;
     if (state->swing_profile_index_B >= NUM_SWING_PROFILES) state->swing_profile_index_B = 3;
-    if (state->fixed_bank >= NUM_FIXED_BANKS) state->fixed_bank = 0;
+    // fixed_bank: checked by mode_fixed_set_bank() when Fixed is entered (bank count scans flash)
     if (state->drift_probability > 100) state->drift_probability = 0;
     if (state->fill_density > 50) state->fill_density = 0;
     if (state->skip_probability > 100) state->skip_probability = 0;
@@ -152,59 +248,122 @@ bool persistence_load_state(krono_state_t *state) {
     return true; 
 }
 
+bool persistence_save_needs_erase(void) {
+    return next_free_slot + 1 >= PERSISTENCE_NUM_SLOTS; // Would consume the emergency reserve
+}
+
 bool persistence_save_state(const krono_state_t *state) {
     if (!state) return false;
 
-    krono_state_t state_to_write = *state;
-    state_to_write.checksum = 0; // Zero out checksum field before calculating
-    state_to_write.checksum = persistence_calculate_checksum(&state_to_write);
+    krono_state_t state_to_write = with_checksum(state);
 
-    flash_unlock();
-    
-    // Erase sector 7 (0x08060000 - 0x0807FFFF for STM32F411CE)
-    // FLASH_PROGRAM_X32 for F4 is (2 << 8), for erase psize is not used this way in erase func
-    // flash_erase_sector takes sector number and voltage range (which implies psize for erase)
-    // Voltage range 3 (2.7-3.6V) => PSIZE = x32 for erase.
-    // The libopencm3 function `flash_erase_sector` for F4 takes (sector_idx, voltage_idx)
-    // where voltage_idx corresponds to PSIZE. For 2.7-3.6V, voltage_idx is 2 (FLASH_PSIZE_X32 for erase).
-    // Let's assume voltage range allows x32 parallelism. The erase func handles psize.
-    flash_erase_sector(7, 2); // Sector 7, Voltage range index 2 (PSIZE x32 for erase)
-    
-    uint32_t flash_sr_status;
-    do {
-        flash_sr_status = FLASH_SR;
-    } while ((flash_sr_status & FLASH_SR_BSY));
-
-    if (flash_sr_status & (FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_WRPERR)) {
-        flash_lock();
+    flash_write_in_progress = true;
+    if (persistence_save_needs_erase() && !log_erase()) {
+        flash_write_in_progress = false;
         return false; // Erase error
     }
-    FLASH_CR |= FLASH_CR_PG; // Enable programming
-
-    uint32_t *p_src = (uint32_t *)&state_to_write;
-    uint32_t flash_addr = PERSISTENCE_FLASH_STORAGE_ADDR;
-    size_t num_words = (sizeof(krono_state_t) + sizeof(uint32_t) - 1) / sizeof(uint32_t); // Ceiling division
-
-    for (size_t i = 0; i < num_words; ++i) {
-        flash_program_word(flash_addr + (i * sizeof(uint32_t)), p_src[i]);
-        do {
-            flash_sr_status = FLASH_SR;
-        } while ((flash_sr_status & FLASH_SR_BSY));
-        if (flash_sr_status & (FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_WRPERR)) {
-            FLASH_CR &= ~FLASH_CR_PG; // Disable programming on error
-            flash_lock();
-            return false; // Programming error
-        }
+    uint32_t slot = next_free_slot;
+    bool programmed = program_slot(slot, &state_to_write);
+    flash_write_in_progress = false;
+    if (!programmed) {
+        return false; // Programming error
     }
-    
-    FLASH_CR &= ~FLASH_CR_PG; // Disable programming after successful write
-    flash_lock();
 
-    krono_state_t verify_state;
-    memcpy(&verify_state, (const void *)PERSISTENCE_FLASH_STORAGE_ADDR, sizeof(krono_state_t));
-    if (memcmp(&state_to_write, &verify_state, sizeof(krono_state_t)) == 0) {
+    if (memcmp(&state_to_write, (const void *)slot_addr(slot), sizeof(krono_state_t)) == 0) {
+        last_valid_slot = (int32_t)slot;
         return true; 
     } else {
         return false; 
     }
 }
+
+bool persistence_emergency_save(const krono_state_t *state) {
+    if (!state || next_free_slot >= PERSISTENCE_NUM_SLOTS) return false;
+    if (flash_write_in_progress) return false; // The interrupted save carries the same state
+
+    krono_state_t state_to_write = with_checksum(state);
+    uint32_t slot = next_free_slot;
+    if (!program_slot(slot, &state_to_write)) {
+        return false;
+    }
+    last_valid_slot = (int32_t)slot;
+    return true;
+}
+
+// --- Hot fields (RTC backup registers) ---
+
+static uint16_t hot_checksum(const uint16_t *regs) {
+    uint16_t sum = 0xA5A5u;
+    for (int i = 0; i < PERSISTENCE_HOT_REG_CHECKSUM; i++) {
+        sum = (uint16_t)((sum << 1) | (sum >> 15)); // rotate so swapped registers don't cancel
+        sum ^= regs[i];
+    }
+    return sum;
+}
+
+void persistence_hot_save(const krono_state_t *state) {
+    if (!state) return;
+
+    uint16_t regs[PERSISTENCE_HOT_NUM_REGS];
+    regs[PERSISTENCE_HOT_REG_MAGIC] = PERSISTENCE_HOT_MAGIC;
+    regs[PERSISTENCE_HOT_REG_OP_MODE] = (uint16_t)state->op_mode;
+    regs[PERSISTENCE_HOT_REG_TEMPO] = (uint16_t)state->tempo_interval; // MAX_INTERVAL fits in 16 bits
+
+    uint32_t calc_bits = 0;
+#if SAVE_CALC_MODE_PER_OP_MODE
+    for (int i = 0; i < NUM_OPERATIONAL_MODES; i++) {
+        if (state->calc_mode_per_op_mode[i] == CALC_MODE_SWAPPED) {
+            calc_bits |= (1u << i);
+        }
+    }
+#endif
+    regs[PERSISTENCE_HOT_REG_CALC_LO] = (uint16_t)(calc_bits & 0xFFFFu);
+    regs[PERSISTENCE_HOT_REG_CALC_HI] = (uint16_t)(calc_bits >> 16);
+
+    uint16_t gamma = 0;
+    if (state->gamma_portals_div_on_a) gamma |= PERSISTENCE_HOT_GAMMA_PORTALS_DIV_ON_A;
+    if (state->gamma_coin_invert) gamma |= PERSISTENCE_HOT_GAMMA_COIN_INVERT;
+    if (state->gamma_ratchet_double) gamma |= PERSISTENCE_HOT_GAMMA_RATCHET_DOUBLE;
+    if (state->gamma_antiratchet_half) gamma |= PERSISTENCE_HOT_GAMMA_ANTIRATCHET_HALF;
+    if (state->gamma_startstop_muted) gamma |= PERSISTENCE_HOT_GAMMA_STARTSTOP_MUTED;
+    regs[PERSISTENCE_HOT_REG_GAMMA] = gamma;
+
+    regs[PERSISTENCE_HOT_REG_CHECKSUM] = hot_checksum(regs);
+
+    // Invalidate first so a reset mid-update never leaves a half-written record that passes.
+    rtc_bkp_write(PERSISTENCE_HOT_REG_MAGIC, 0);
+    for (int i = PERSISTENCE_HOT_NUM_REGS - 1; i >= 0; i--) {
+        rtc_bkp_write((uint8_t)i, regs[i]);
+    }
+}
+
+bool persistence_hot_load(krono_state_t *state) {
+    if (!state) return false;
+
+    uint16_t regs[PERSISTENCE_HOT_NUM_REGS];
+    for (int i = 0; i < PERSISTENCE_HOT_NUM_REGS; i++) {
+        regs[i] = rtc_bkp_read((uint8_t)i);
+    }
+    if (regs[PERSISTENCE_HOT_REG_MAGIC] != PERSISTENCE_HOT_MAGIC) return false;
+    if (regs[PERSISTENCE_HOT_REG_CHECKSUM] != hot_checksum(regs)) return false;
+    if (!mode_is_enabled((operational_mode_t)regs[PERSISTENCE_HOT_REG_OP_MODE])) return false;
+
+    state->op_mode = (operational_mode_t)regs[PERSISTENCE_HOT_REG_OP_MODE];
+    if (regs[PERSISTENCE_HOT_REG_TEMPO] >= MIN_INTERVAL && regs[PERSISTENCE_HOT_REG_TEMPO] <= MAX_INTERVAL) {
+        state->tempo_interval = regs[PERSISTENCE_HOT_REG_TEMPO];
+    }
+#if SAVE_CALC_MODE_PER_OP_MODE
+    uint32_t calc_bits = (uint32_t)regs[PERSISTENCE_HOT_REG_CALC_LO]
+                       | ((uint32_t)regs[PERSISTENCE_HOT_REG_CALC_HI] << 16);
+    for (int i = 0; i < NUM_OPERATIONAL_MODES; i++) {
+        state->calc_mode_per_op_mode[i] = (calc_bits & (1u << i)) ? CALC_MODE_SWAPPED : CALC_MODE_NORMAL;
+    }
+#endif
+    uint16_t gamma = regs[PERSISTENCE_HOT_REG_GAMMA];
+    state->gamma_portals_div_on_a = (gamma & PERSISTENCE_HOT_GAMMA_PORTALS_DIV_ON_A) != 0;
+    state->gamma_coin_invert = (gamma & PERSISTENCE_HOT_GAMMA_COIN_INVERT) != 0;
+    state->gamma_ratchet_double = (gamma & PERSISTENCE_HOT_GAMMA_RATCHET_DOUBLE) != 0;
+    state->gamma_antiratchet_half = (gamma & PERSISTENCE_HOT_GAMMA_ANTIRATCHET_HALF) != 0;
+    state->gamma_startstop_muted = (gamma & PERSISTENCE_HOT_GAMMA_STARTSTOP_MUTED) != 0;
+    return true;
+}
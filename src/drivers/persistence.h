@@ -10,9 +10,30 @@
 // --- Constants ---
 #define PERSISTENCE_MAGIC_NUMBER 0xDEADBEEF // Example magic number
 #define PERSISTENCE_FLASH_STORAGE_ADDR 0x08060000
+#define PERSISTENCE_FLASH_SECTOR 7
+#define PERSISTENCE_FLASH_SECTOR_SIZE (128u * 1024u)
+
+// Hot fields (op mode, calc swap, tempo, Gamma toggles) live in RTC backup registers:
+// rewritten on every change, no flash erase, overlaid on the flash state at boot.
+#define PERSISTENCE_HOT_MAGIC 0x4B52u // "KR"
+#define PERSISTENCE_HOT_REG_MAGIC 0
+#define PERSISTENCE_HOT_REG_OP_MODE 1
+#define PERSISTENCE_HOT_REG_TEMPO 2
+#define PERSISTENCE_HOT_REG_CALC_LO 3  // Calc swap bits, op modes 0..15
+#define PERSISTENCE_HOT_REG_CALC_HI 4  // Calc swap bits, op modes 16..31
+#define PERSISTENCE_HOT_REG_GAMMA 5
+#define PERSISTENCE_HOT_REG_CHECKSUM 6
+#define PERSISTENCE_HOT_NUM_REGS 7
+
+// Bits in PERSISTENCE_HOT_REG_GAMMA
+#define PERSISTENCE_HOT_GAMMA_PORTALS_DIV_ON_A (1u << 0)
+#define PERSISTENCE_HOT_GAMMA_COIN_INVERT      (1u << 1)
+#define PERSISTENCE_HOT_GAMMA_RATCHET_DOUBLE   (1u << 2)
+#define PERSISTENCE_HOT_GAMMA_ANTIRATCHET_HALF (1u << 3)
+#define PERSISTENCE_HOT_GAMMA_STARTSTOP_MUTED  (1u << 4)
 
 // --- Data Structure ---
-typedef struct {
+typedef struct krono_state_s {
     uint32_t magic_number;       // To validate data integrity
     operational_mode_t op_mode; // Last active operational mode
 #if SAVE_CALC_MODE_PER_OP_MODE
@@ -22,8 +43,8 @@ typedef struct {
     uint32_t chaos_mode_divisor; // Specific divisor setting for Chaos mode
     uint8_t swing_profile_index_A; // Active swing profile index for MODE_SWING Group A
     uint8_t swing_profile_index_B; // Active swing profile index for MODE_SWING Group B
-    uint8_t fixed_bank;            // Active bank for MODE_FIXED (0..9)
-    uint8_t fixed_sequence;        // Legacy sequence field for mode 11
+    uint8_t fixed_bank;            // Active bank for MODE_FIXED, low byte
+    uint8_t fixed_bank_hi;         // High byte (flash user banks); was the unused sequence field, always 0
     bool drift_active;
     uint8_t drift_probability;
     bool drift_ramp_up;
@@ -61,13 +82,38 @@ typedef struct {
     bool gamma_ratchet_double;
     bool gamma_antiratchet_half;
     bool gamma_startstop_muted;
+    // New fields go here, in the tail padding before checksum, so older records keep their layout;
+    // there they read the old padding (0 or garbage, range-checked on load).
+    uint8_t chaos_engine;          // Chaos mode trigger source (chaos_engine_t)
     uint32_t checksum;           // Simple checksum for validation
 } krono_state_t;
 
+// Sector 7 is an append-only log of krono_state_t records, one per slot.
+#define PERSISTENCE_SLOT_STRIDE ((sizeof(krono_state_t) + 31u) & ~31u)
+#define PERSISTENCE_NUM_SLOTS (PERSISTENCE_FLASH_SECTOR_SIZE / PERSISTENCE_SLOT_STRIDE)
+
+static inline uint16_t persistence_get_fixed_bank(const krono_state_t *state) {
+    return (uint16_t)(state->fixed_bank | ((uint16_t)state->fixed_bank_hi << 8));
+}
+
+static inline void persistence_set_fixed_bank(krono_state_t *state, uint16_t bank) {
+    state->fixed_bank = (uint8_t)bank;
+    state->fixed_bank_hi = (uint8_t)(bank >> 8);
+}
+
 // --- Function Prototypes ---
 void persistence_init(void);
 uint32_t persistence_calculate_checksum(const krono_state_t *state);
 bool persistence_load_state(krono_state_t *state);
 bool persistence_save_state(const krono_state_t *state);
+/** True if the next persistence_save_state() must erase the sector first (stalls the CPU). */
+bool persistence_save_needs_erase(void);
+/** Append @p state to the pre-erased reserve slot; never erases. Safe from the PVD interrupt. */
+bool persistence_emergency_save(const krono_state_t *state);
+
+/** Write the hot fields of @p state to the backup registers (cheap, call on every change). */
+void persistence_hot_save(const krono_state_t *state);
+/** Overlay valid hot fields from the backup registers onto @p state. Returns false if none. */
+bool persistence_hot_load(krono_state_t *state);
 
 #endif // PERSISTENCE_H
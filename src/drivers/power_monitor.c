@@ -0,0 +1,38 @@
+#include "drivers/power_monitor.h"
+#include "variables.h"
+
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/pwr.h>
+#include <libopencm3/stm32/exti.h>
+#include <libopencm3/cm3/nvic.h>
+#include <stddef.h>
+
+// --- Configuration ---
+#define POWER_MONITOR_EXTI EXTI16 // PVD output is wired to EXTI line 16
+#define POWER_MONITOR_NVIC_IRQ NVIC_PVD_IRQ
+
+static power_fail_callback_t power_fail_cb = NULL;
+
+void power_monitor_init(power_fail_callback_t cb) {
+    power_fail_cb = cb;
+
+    rcc_periph_clock_enable(RCC_PWR);
+    pwr_enable_power_voltage_detect((uint32_t)POWER_FAIL_PVD_PLS << PWR_CR_PLS_LSB);
+
+    // PVDO rises when VDD falls below the level. Rising-edge only: a supply that is
+    // already low at boot does not trigger a save of a state that was never loaded.
+    exti_set_trigger(POWER_MONITOR_EXTI, EXTI_TRIGGER_RISING);
+    exti_reset_request(POWER_MONITOR_EXTI);
+    exti_enable_request(POWER_MONITOR_EXTI);
+
+    nvic_set_priority(POWER_MONITOR_NVIC_IRQ, 0); // Preempts pulse timers and inputs
+    nvic_clear_pending_irq(POWER_MONITOR_NVIC_IRQ);
+    nvic_enable_irq(POWER_MONITOR_NVIC_IRQ);
+}
+
+void pvd_isr(void) {
+    exti_reset_request(POWER_MONITOR_EXTI);
+    if (power_fail_cb) {
+        power_fail_cb();
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback run from the PVD interrupt when the supply falls below the threshold.
+ * Runs at the highest interrupt priority with the hold-up capacitance as its only budget:
+ * keep it to output shutdown and a single pre-erased flash write.
+ */
+typedef void (*power_fail_callback_t)(void);
+
+/**
+ * @brief Arms the programmable voltage detector (PVD) on EXTI16.
+ * The callback fires once per supply dip (rising PVDO edge = VDD dropped below the level).
+ * @param cb Function to call from the PVD interrupt.
+ */
+void power_monitor_init(power_fail_callback_t cb);
+
+#ifdef __cplusplus
+}
+#endif
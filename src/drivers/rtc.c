@@ -16,12 +16,18 @@ void rtc_bkp_init(void) {
     pwr_disable_backup_domain_write_protect();
 
     // On F4, the backup domain needs the RTC clock to be enabled to access BKP registers.
-    // Enable LSE oscillator and wait for it to be ready.
-    rcc_osc_on(RCC_LSE);
-    rcc_wait_for_osc_ready(RCC_LSE);
+    // The backup domain survives a reset, so only configure it on a cold start.
+    // LSI rather than LSE: PC14/PC15 are parked as unused inputs (no 32 kHz crystal),
+    // so waiting for LSE would stall boot.
+    if (RCC_BDCR & RCC_BDCR_RTCEN) {
+        return;
+    }
+    rcc_osc_on(RCC_LSI);
+    rcc_wait_for_osc_ready(RCC_LSI);
 
-    // Select LSE as RTC clock source directly in Backup Domain Control Register (BDCR)
-    RCC_BDCR |= RCC_BDCR_RTCSEL_LSE; 
+    // Select LSI as RTC clock source directly in Backup Domain Control Register (BDCR)
+    RCC_BDCR = (RCC_BDCR & ~(RCC_BDCR_RTCSEL_MASK << RCC_BDCR_RTCSEL_SHIFT))
+             | (RCC_BDCR_RTCSEL_LSI << RCC_BDCR_RTCSEL_SHIFT);
 
     // Enable RTC clock directly in BDCR
     RCC_BDCR |= RCC_BDCR_RTCEN;
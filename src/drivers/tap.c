@@ -1,6 +1,8 @@
 #include "tap.h"
 #include "../main_constants.h"
 #include "../util/delay.h"
+#include "../util/cycle_counter.h"
+#include "../util/ramfunc.h"
 #include <libopencm3/cm3/common.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
@@ -10,34 +12,21 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-/* Cortex-M4 DWT cycle counter (sub-ms tap intervals). */
-#define SCB_DEMCR   MMIO32(0xE000EDFCUL)
-#define DWT_CTRL    MMIO32(0xE0001000UL)
-#define DWT_CYCCNT  MMIO32(0xE0001004UL)
-
-#define DEMCR_TRCENA (1UL << 24)
-#define DWT_CYCCNTENA (1UL << 0)
-
 static volatile uint32_t last_tap_time_ms = 0;
 static volatile uint32_t last_accept_cycles = 0;
 static volatile uint32_t tap_interval = 0;
 static volatile bool tap_detected_flag = false;
 static volatile bool first_tap_registered = false;
 
-static void tap_dwt_enable(void) {
-    SCB_DEMCR |= DEMCR_TRCENA;
-    DWT_CYCCNT = 0;
-    DWT_CTRL |= DWT_CYCCNTENA;
-}
-
-static uint32_t tap_cycles_now(void) {
-    return DWT_CYCCNT;
+/* DWT cycle counter (sub-ms tap intervals); shared, so only deltas are used. */
+static inline uint32_t tap_cycles_now(void) {
+    return cycle_counter_now();
 }
 
 /**
  * @brief Convert elapsed core cycles to milliseconds (rounded).
  */
-static uint32_t tap_cycles_to_ms_rounded(uint32_t delta_cycles) {
+static inline uint32_t tap_cycles_to_ms_rounded(uint32_t delta_cycles) {
     if (delta_cycles == 0) {
         return 0;
     }
@@ -49,7 +38,7 @@ void tap_init(void) {
     rcc_periph_clock_enable(RCC_GPIOA);
     rcc_periph_clock_enable(RCC_SYSCFG);
 
-    tap_dwt_enable();
+    cycle_counter_enable();
 
     gpio_mode_setup(GPIOA, GPIO_MODE_INPUT, GPIO_PUPD_PULLUP, GPIO0);
 
@@ -65,8 +54,8 @@ void tap_init(void) {
     first_tap_registered = false;
 }
 
-void exti0_isr(void) {
-    exti_reset_request(EXTI0);
+KRONO_RAMFUNC void exti0_isr(void) {
+    EXTI_PR = EXTI0; // Clear pending (write 1); SRAM path avoids the libopencm3 helper
 
     uint32_t now_ms = millis();
     uint32_t now_cyc = tap_cycles_now();
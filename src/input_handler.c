@@ -129,7 +129,7 @@ static void handle_button_calc_mode_swap(void) {
     bool current_op_mode_is_fixed = (last_known_main_op_mode == MODE_FIXED);
 
     /* Modes 12–20: short MOD only (same timing as calc swap elsewhere). No MOD+TAP — tap tempo stays live. */
-    if (MODE_USES_MOD_GESTURES(last_known_main_op_mode)) {
+    if (mode_has_flag(last_known_main_op_mode, MODE_FLAG_MOD_GESTURES)) {
         switch (current_calc_swap_sm_state) {
             case CALC_SWAP_SM_IDLE:
                 if (mod_is_pressed_raw && current_op_mode_sm_state == INPUT_SM_IDLE) {
@@ -453,18 +453,17 @@ void input_handler_update(void) {
     } else if (ext_clock_has_timed_out(now)) {
         if (external_clock_active) {
             external_clock_active = false;
-            if (tempo_change_cb) {
+            if (last_valid_external_clock_interval >= MIN_INTERVAL &&
+                last_valid_external_clock_interval <= MAX_INTERVAL) {
+                // Holdover: the clock manager keeps freewheeling at the last tracked tempo and
+                // phase; no new anchor, so nothing jumps. A returning clock relocks by slewing.
+                input_tempo_set_last_reported_interval(last_valid_external_clock_interval);
+            } else if (tempo_change_cb) {
+                // No usable external tempo to hold: last tap, else the default
                 uint32_t new_internal_tempo_to_set = DEFAULT_TEMPO_INTERVAL;
-
-                if (last_valid_external_clock_interval > 0 &&
-                    last_valid_external_clock_interval >= MIN_INTERVAL &&
-                    last_valid_external_clock_interval <= MAX_INTERVAL) {
-                    new_internal_tempo_to_set = last_valid_external_clock_interval;
-                } else {
-                    uint32_t last_tap = input_tempo_get_last_reported_interval();
-                    if (last_tap > 0 && last_tap >= MIN_INTERVAL && last_tap <= MAX_INTERVAL) {
-                        new_internal_tempo_to_set = last_tap;
-                    }
+                uint32_t last_tap = input_tempo_get_last_reported_interval();
+                if (last_tap >= MIN_INTERVAL && last_tap <= MAX_INTERVAL) {
+                    new_internal_tempo_to_set = last_tap;
                 }
 
                 input_tempo_set_last_reported_interval(new_internal_tempo_to_set);
@@ -484,7 +483,7 @@ void input_handler_update(void) {
     if (ext_gate_swap_requested) {
         /* PB4 CV gate: mirror MOD short-press for modes 12–20 and Gamma; else FIXED bank or calc swap. */
         if (calc_swap_cooldown_ok(now)) {
-            if (MODE_USES_MOD_GESTURES(last_known_main_op_mode)) {
+            if (mode_has_flag(last_known_main_op_mode, MODE_FLAG_MOD_GESTURES)) {
                 if (mod_press_cb) {
                     mod_press_cb(MOD_PRESS_EVENT_SINGLE, now);
                 }
@@ -506,11 +505,12 @@ void input_handler_update(void) {
     }
 }
 
-void exti4_isr(void) {
-    if (exti_get_flag_status(EXTI4)) {
+// SRAM, direct register access only (see util/ramfunc.h).
+KRONO_RAMFUNC void exti4_isr(void) {
+    if (EXTI_PR & EXTI4) {
         uint32_t now = millis();
         if (now - last_gate_swap_isr_time >= GATE_SWAP_DEBOUNCE_MS) {
-             if (gpio_get(GPIOB, GPIO4)) { // Check if PB4 (CV gate) is high
+             if (GPIO_IDR(GPIOB) & GPIO4) { // Check if PB4 (CV gate) is high
                  // Request CV swap if OpMode SM is IDLE and external clock is NOT active
                  // PA1 (MOD button) status is NOT checked here.
                  if (current_op_mode_sm_state == INPUT_SM_IDLE && !external_clock_active) {
@@ -519,6 +519,6 @@ void exti4_isr(void) {
                  last_gate_swap_isr_time = now; 
              }
         }
-        exti_reset_request(EXTI4); 
+        EXTI_PR = EXTI4; // Clear pending (write 1)
     }
 }
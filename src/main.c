@@ -4,6 +4,9 @@
 
 #include <libopencm3/cm3/nvic.h>
 #include <libopencm3/cm3/systick.h>
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/scb.h>
+#include <libopencm3/cm3/vector.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/flash.h>
@@ -12,6 +15,7 @@
 #include "drivers/persistence.h" 
 #include "drivers/ext_clock.h" 
 #include "drivers/tap.h"
+#include "drivers/power_monitor.h"
 #include "modes/modes.h" 
 #include "input_handler.h"
 #include "input_tempo.h"
@@ -21,8 +25,11 @@
 #include "main_constants.h"
 #include "mode_state.h"
 #include "krono_aux_led_pattern.h"
+#include "boot_profile.h"
+#include "util/ramfunc.h"
+
+#include <string.h>
 
-#include "modes/mode_fixed.h"
 
 // --- Global State (Static to this file) ---
 krono_state_t current_state; 
@@ -48,19 +55,20 @@ static void pa3_soft_blink_arm(void) {
 // --- SysTick ---
 volatile uint32_t system_millis = 0;
 
-void sys_tick_handler(void) {
+KRONO_RAMFUNC void sys_tick_handler(void) {
 	system_millis++;
 }
 
 #ifndef MILLIS_DEFINED
 #define MILLIS_DEFINED
-uint32_t millis(void) {
+KRONO_RAMFUNC uint32_t millis(void) {
 	return system_millis;
 }
 #endif
 
 // --- Helper Functions ---
 static void save_current_state(void);
+static void on_power_fail(void);
 
 // Input Handler Callbacks
 static void on_tap_tempo_change(uint32_t new_interval_ms, bool is_external_clock, uint32_t event_timestamp_ms,
@@ -75,26 +83,43 @@ static void on_mod_press(mod_press_event_t event, uint32_t timestamp_ms);
 
 // Forward Declarations
 static void system_init(void);
+static void system_init_deferred(void);
 static void configure_unused_pins(void);
 
 
+// Only a tap that moves the tempo is a state change
+static void record_tap_tempo(uint32_t interval_ms) {
+    if (interval_ms != current_state.tempo_interval) {
+        current_state.tempo_interval = interval_ms;
+        mode_state_mark_dirty();
+        persistence_hot_save(&current_state);
+    }
+}
+
 // --- Input Handler Callback Implementations ---
 static void on_tap_tempo_change(uint32_t new_interval_ms, bool is_external_clock, uint32_t event_timestamp_ms,
                                 bool tap_quadruple_boundary) {
     if (new_interval_ms > 0) {
         if (tap_quadruple_boundary) {
+            // Saved from the main loop once clock_manager_update() applies it
             clock_manager_arm_tap_quadruple_boundary(new_interval_ms, event_timestamp_ms);
         } else {
             clock_manager_set_internal_tempo(new_interval_ms, is_external_clock, event_timestamp_ms);
+            if (!is_external_clock) { // The external clock's tempo is not saved
+                record_tap_tempo(new_interval_ms);
+            }
         }
         pa3_soft_blink_arm();
     }
 }
 
 static void on_op_mode_change(uint8_t mode_clicks) {
-    if (mode_clicks > 0 && mode_clicks <= NUM_OPERATIONAL_MODES) {
+    if (mode_clicks > 0 && mode_is_enabled((operational_mode_t)(mode_clicks - 1))) {
         operational_mode_t desired_mode = (operational_mode_t)(mode_clicks - 1);
+        mode_state_capture(g_current_op_mode, &current_state); // Outgoing mode only
         g_current_op_mode = desired_mode;
+        current_state.op_mode = desired_mode;
+        mode_state_mark_dirty();
 
 #if SAVE_CALC_MODE_PER_OP_MODE
         if (g_current_op_mode < NUM_OPERATIONAL_MODES) {
@@ -115,9 +140,9 @@ static void on_op_mode_change(uint8_t mode_clicks) {
         status_led_set_mode(g_current_op_mode); 
         status_led_reset(); 
 
+        persistence_hot_save(&current_state); // Flash only on the explicit save gesture
+
         pa3_soft_blink_arm();
-        
-        state_changed_for_saving = true; 
     }
 }
 
@@ -133,6 +158,8 @@ static void on_calc_mode_change(void) {
         current_state.calc_mode_per_op_mode[g_current_op_mode] = g_current_calc_mode;
      }
 #endif
+    mode_state_mark_dirty();
+    persistence_hot_save(&current_state);
 
     pa3_soft_blink_arm();
 }
@@ -140,12 +167,8 @@ static void on_calc_mode_change(void) {
 static void on_fixed_bank_change(void) {
     // MOD press only cycles banks in FIXED mode
     if (g_current_op_mode == MODE_FIXED) {
-        uint8_t current_bank = mode_fixed_get_bank();
-        uint8_t next_bank = (current_bank + 1) % NUM_FIXED_BANKS;
-        
-        mode_fixed_set_bank(next_bank);
-        current_state.fixed_bank = next_bank;
-        
+        mode_dispatch_mod_press(MODE_FIXED, MOD_PRESS_EVENT_SINGLE, millis());
+        mode_state_capture(MODE_FIXED, &current_state); // Marks the state dirty
         pa3_soft_blink_arm();
     }
 }
@@ -165,9 +188,39 @@ static void on_gamma_arm_aux_pattern_from_input_handler(void) {
 static void on_mod_press(mod_press_event_t event, uint32_t timestamp_ms) {
     (void)event;
     mode_dispatch_mod_press(g_current_op_mode, MOD_PRESS_EVENT_SINGLE, timestamp_ms);
+    mode_state_capture(g_current_op_mode, &current_state);
+    persistence_hot_save(&current_state);
     pa3_soft_blink_arm();
 }
 
+// --- Flash / vector table ---
+
+#if KRONO_RAM_HOT_PATHS
+// VTOR needs the table aligned to its size rounded up to a power of two (< 512 bytes on F411).
+static vector_table_t ram_vector_table __attribute__((aligned(512)));
+
+// Exception entry then fetches the vector from SRAM, so RAM-resident ISRs are still
+// entered while the flash is busy erasing or programming.
+static void relocate_vector_table(void) {
+    memcpy(&ram_vector_table, &vector_table, sizeof(ram_vector_table));
+    __asm__ volatile ("dsb");
+    SCB_VTOR = (uint32_t)&ram_vector_table;
+    __asm__ volatile ("dsb");
+}
+#endif
+
+// ART accelerator: rcc_clock_setup_pll sets 2 wait states with I/D cache on, but no
+// prefetch. Caches must be disabled while reset, then re-enabled.
+static void configure_flash_accelerator(void) {
+    flash_icache_disable();
+    flash_dcache_disable();
+    flash_icache_reset();
+    flash_dcache_reset();
+    flash_icache_enable();
+    flash_dcache_enable();
+    flash_prefetch_enable();
+}
+
 // --- Pin Configuration ---
 static void configure_unused_pins(void) {
     rcc_periph_clock_enable(RCC_GPIOA);
@@ -188,18 +241,37 @@ static void configure_unused_pins(void) {
 
 // --- System Initialization ---
 
+// Critical path only: everything needed to emit the first beat. The rest waits for
+// system_init_deferred(), which runs right after the first clock_manager_update().
 static void system_init(void) {
+    boot_profile_start();
     rcc_clock_setup_pll(&rcc_hse_25mhz_3v3[RCC_CLOCK_3V3_84MHZ]);
+    boot_profile_clock_switched(); // Cycles so far ran on HSI
+    configure_flash_accelerator();
+#if KRONO_RAM_HOT_PATHS
+    relocate_vector_table();
+#endif
     systick_set_clocksource(STK_CSR_CLKSOURCE_AHB_DIV8);
     systick_set_reload(10499); 
     systick_interrupt_enable();
     systick_counter_enable();
-    configure_unused_pins();
+    boot_profile_mark(BOOT_STAGE_CLOCKS);
+
     io_init();
     pulse_timer_init();
+    boot_profile_mark(BOOT_STAGE_OUTPUTS);
+
     persistence_init();
 
-    if (persistence_load_state(&current_state)) {
+    bool flash_state_valid = persistence_load_state(&current_state);
+    krono_state_t flash_state;
+    memcpy(&flash_state, &current_state, sizeof(flash_state));
+    bool hot_state_valid = persistence_hot_load(&current_state); // Newer than flash when present
+    if (hot_state_valid && memcmp(&flash_state, &current_state, sizeof(flash_state)) != 0) {
+        mode_state_mark_dirty(); // Overlay changed something the flash record does not have yet
+    }
+
+    if (flash_state_valid || hot_state_valid) {
         g_current_op_mode = current_state.op_mode;
 #if SAVE_CALC_MODE_PER_OP_MODE
         if (g_current_op_mode < NUM_OPERATIONAL_MODES) {
@@ -241,6 +313,7 @@ static void system_init(void) {
 
         srand((unsigned int)millis() ^ 0xC001D00Du);
     }
+    boot_profile_mark(BOOT_STAGE_STATE);
 
     input_handler_init(
         on_tap_tempo_change,
@@ -254,45 +327,83 @@ static void system_init(void) {
     input_handler_update_main_op_mode(g_current_op_mode); 
 
     clock_manager_set_calc_mode(g_current_calc_mode);
+    boot_profile_mark(BOOT_STAGE_INPUTS);
+}
+
+static void system_init_deferred(void) {
+    configure_unused_pins();
     status_led_init(); 
     status_led_set_mode(g_current_op_mode); 
+    power_monitor_init(on_power_fail);
+    boot_profile_mark(BOOT_STAGE_DEFERRED);
 }
 
 // --- State Persistence ---
 
-static void save_current_state(void) {
-    io_all_outputs_off();
-    io_cancel_all_timed_pulses();
+// Returns the generation the snapshot corresponds to.
+static uint32_t capture_current_state(krono_state_t *out) {
+    // Inactive modes were captured when left; only the active one can have moved on.
+    krono_state_t state_to_save = current_state;
+    mode_state_capture(g_current_op_mode, &state_to_save);
 
-    krono_state_t state_to_save;
     state_to_save.magic_number = PERSISTENCE_MAGIC_NUMBER;
     state_to_save.tempo_interval = clock_manager_get_current_tempo_interval();
     state_to_save.op_mode = g_current_op_mode; 
 
 #if SAVE_CALC_MODE_PER_OP_MODE
-    for(int i=0; i < NUM_OPERATIONAL_MODES; ++i) {
-        state_to_save.calc_mode_per_op_mode[i] = current_state.calc_mode_per_op_mode[i]; 
-    }
     if (g_current_op_mode < NUM_OPERATIONAL_MODES) { 
         state_to_save.calc_mode_per_op_mode[g_current_op_mode] = g_current_calc_mode;
     }
 #endif
 
-    mode_state_capture_for_save(g_current_op_mode, &current_state, &state_to_save);
-    state_to_save.fixed_sequence = 0; // Not used anymore
-
     state_to_save.checksum = 0; 
     state_to_save.checksum = persistence_calculate_checksum(&state_to_save);
+    *out = state_to_save;
+    return mode_state_generation();
+}
+
+static void save_current_state(void) {
+    krono_state_t state_to_save;
+    uint32_t generation = capture_current_state(&state_to_save);
+    state_changed_for_saving = false; 
+    if (!mode_state_has_unsaved_changes()) {
+        return; // Newest flash record already matches
+    }
+
+    // Appending to the slot log leaves outputs running; only a sector erase stalls the core.
+    bool erasing = persistence_save_needs_erase();
+    if (erasing) {
+        io_all_outputs_off();
+        io_cancel_all_timed_pulses();
+    }
 
     bool save_successful = persistence_save_state(&state_to_save);
 
-    clock_manager_sync_flags(false); 
-    clock_manager_set_calc_mode(g_current_calc_mode); 
+    if (erasing) {
+        clock_manager_sync_flags(false); 
+        clock_manager_set_calc_mode(g_current_calc_mode); 
+    }
 
     if (save_successful) {
         current_state = state_to_save; 
+        mode_state_mark_saved(generation);
+        persistence_hot_save(&current_state);
     }
-    state_changed_for_saving = false; 
+}
+
+// PVD interrupt: supply is collapsing. Drop the output load and append one record.
+static void on_power_fail(void) {
+    cm_disable_interrupts();
+    io_all_outputs_off();
+
+    krono_state_t state_to_save;
+    uint32_t generation = capture_current_state(&state_to_save);
+    if (mode_state_has_unsaved_changes() && persistence_emergency_save(&state_to_save)) {
+        mode_state_mark_saved(generation);
+    }
+
+    // Brown-out that recovered: keep running (outputs resume on the next scheduled pulse).
+    cm_enable_interrupts();
 }
 
 
@@ -300,6 +411,7 @@ static void save_current_state(void) {
 
 int main(void) {
     system_init();
+    bool deferred_init_done = false;
 
     while (1) {
         uint32_t now = millis();
@@ -308,6 +420,15 @@ int main(void) {
         }
         input_handler_update();
         clock_manager_update(); 
+        uint32_t applied_tap_interval;
+        if (clock_manager_take_applied_tap_tempo(&applied_tap_interval)) {
+            record_tap_tempo(applied_tap_interval);
+        }
+        if (!deferred_init_done) {
+            boot_profile_mark(BOOT_STAGE_FIRST_F1);
+            system_init_deferred();
+            deferred_init_done = true;
+        }
         status_led_update(now); 
 
         krono_aux_led_pattern_pump(now);
@@ -3,6 +3,7 @@
 
 #include <stdint.h> // Needed for uint32_t
 #include "variables.h" // Include tunable parameters
+#include "util/ramfunc.h"
 
 /** Slowest tempo treated as in-spec (BPM). Beat period = 60000 / BPM (e.g. 20 -> 3000 ms). */
 #define KRONO_MIN_BPM_SUPPORTED 20u
@@ -21,8 +22,6 @@
 #define TAP_QUAD_BLEND_LEADING_NUM 30u
 #define TAP_QUAD_BLEND_TRAILING_NUM 70u
 #define TAP_QUAD_BLEND_DENOM 100u
-/** External clock stability (ms); tap tempo no longer uses spread/median lock. */
-#define MAX_INTERVAL_DIFFERENCE 4000
 /** No tap for this long resets the quadruple click counter (fresh 1–4 cycle). */
 #define TAP_PATTERN_IDLE_RESET_MS 5000u
 #define MIN_INTERVAL 33       // ~1818 BPM upper bound (60000/33)
@@ -31,7 +30,7 @@
 #if MAX_INTERVAL < KRONO_MS_AT_MIN_BPM
 #error "MAX_INTERVAL must be >= KRONO_MS_AT_MIN_BPM (20 BPM)"
 #endif
-#define MIN_CLOCK_INTERVAL 10 // Minimum interval for generated clocks (affects max frequency)
+#define MIN_CLOCK_INTERVAL (MIN_INTERVAL / 6) // Floor for generated clocks; x6 at the fastest tempo stays unclamped
 #define DEFAULT_TEMPO_BPM 70
 #define DEFAULT_TEMPO_INTERVAL (60000 / DEFAULT_TEMPO_BPM) // ~857ms
 
@@ -69,7 +68,7 @@
  * Defined in main.c, based on SysTick.
  * @return Current system time in milliseconds.
  */
-uint32_t millis(void); // Declared here, defined in main.c
+KRONO_RAMFUNC uint32_t millis(void); // Declared here, defined in main.c (SRAM: called from ISRs)
 
 
 #endif // MAIN_CONSTANTS_H
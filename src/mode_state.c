@@ -1,8 +1,9 @@
 #include "mode_state.h"
 
+#include <string.h>
+
 #include "modes/mode_chaos.h"
 #include "modes/mode_swing.h"
-#include "modes/mode_fixed.h"
 #include "modes/mode_rhythm_shared.h"
 
 void mode_state_validate(krono_state_t *state) {
@@ -11,15 +12,17 @@ void mode_state_validate(krono_state_t *state) {
         (state->chaos_mode_divisor % CHAOS_DIVISOR_STEP != 0)) {
         state->chaos_mode_divisor = CHAOS_DIVISOR_DEFAULT;
     }
+    if (state->chaos_engine >= NUM_CHAOS_ENGINES) {
+        state->chaos_engine = CHAOS_ENGINE_LIVE_LORENZ;
+    }
     if (state->swing_profile_index_A >= NUM_SWING_PROFILES) {
         state->swing_profile_index_A = 3;
     }
     if (state->swing_profile_index_B >= NUM_SWING_PROFILES) {
         state->swing_profile_index_B = 3;
     }
-    if (state->fixed_bank >= NUM_FIXED_BANKS) {
-        state->fixed_bank = 0;
-    }
+    // fixed_bank is range-checked when Fixed applies it: counting flash user banks checksums the
+    // whole bank sector, which stays off the boot path unless Fixed is the mode being entered.
     if (state->drift_probability > 100) state->drift_probability = 0;
     if (state->fill_density > 50) state->fill_density = 0;
     if (state->skip_probability > 100) state->skip_probability = 0;
@@ -39,99 +42,43 @@ void mode_state_validate(krono_state_t *state) {
     }
 }
 
-void mode_state_apply_runtime(operational_mode_t op_mode, const krono_state_t *state) {
-    if (op_mode == MODE_CHAOS) {
-        mode_chaos_set_divisor(state->chaos_mode_divisor);
-    }
-    if (op_mode == MODE_SWING) {
-        mode_swing_set_profile_indices(state->swing_profile_index_A, state->swing_profile_index_B);
-    }
-    if (op_mode == MODE_FIXED) {
-        mode_fixed_set_bank(state->fixed_bank);
-    }
-    mode_drift_set_state(state->drift_active, state->drift_probability, state->drift_ramp_up);
-    mode_fill_set_state(state->fill_density, state->fill_ramp_up);
-    mode_skip_set_state(state->skip_active, state->skip_probability, state->skip_ramp_up);
-    mode_stutter_set_state(state->stutter_active, state->stutter_length, state->stutter_ramp_up, state->stutter_variation_mask);
-    mode_morph_set_state(state->morph_frozen, state->morph_generation, state->morph_patterns);
-    mode_mute_set_state(state->mute_mask, state->mute_count, state->mute_ramp_up, state->mute_variation_mask);
-    mode_density_set_state(state->density_pct, state->density_ramp_up);
-    mode_song_set_state(state->song_variation_seed, state->song_variation_pending);
-    mode_accumulate_set_state(state->accumulate_active_count, state->accumulate_add_pending,
-                              state->accumulate_active_mask, state->accumulate_phase_offsets,
-                              state->accumulate_variation_masks);
-    mode_gamma_sequential_freeze_set_state(state->gamma_seq_freeze_frozen, state->gamma_seq_freeze_step);
-    mode_gamma_sequential_trip_set_state(state->gamma_seq_trip_pattern, state->gamma_seq_trip_step);
-    mode_gamma_portals_set_state(state->gamma_portals_div_on_a);
-    mode_gamma_coin_toss_set_state(state->gamma_coin_invert);
-    mode_gamma_ratchet_set_state(state->gamma_ratchet_double);
-    mode_gamma_anti_ratchet_set_state(state->gamma_antiratchet_half);
-    mode_gamma_start_stop_set_state(state->gamma_startstop_muted);
+// --- Dirty tracking ---
+// current_state is the authoritative copy of every inactive mode's state; only the active mode's
+// runtime can diverge from it. Modes are captured on leave/save and hydrated on enter, one at a time.
+
+static uint32_t state_generation = 0;  // Bumped on every recorded change
+static uint32_t saved_generation = 0;  // Generation of the last flash record
+
+void mode_state_mark_dirty(void) {
+    state_generation++;
 }
 
-void mode_state_capture_for_save(operational_mode_t op_mode,
-                                 const krono_state_t *current_state,
-                                 krono_state_t *state_to_save) {
-    if (op_mode == MODE_CHAOS) {
-        state_to_save->chaos_mode_divisor = mode_chaos_get_divisor();
-    } else {
-        state_to_save->chaos_mode_divisor = current_state->chaos_mode_divisor;
-    }
+uint32_t mode_state_generation(void) {
+    return state_generation;
+}
 
-    if (op_mode == MODE_SWING) {
-        mode_swing_get_profile_indices(&state_to_save->swing_profile_index_A, &state_to_save->swing_profile_index_B);
-    } else {
-        state_to_save->swing_profile_index_A = current_state->swing_profile_index_A;
-        state_to_save->swing_profile_index_B = current_state->swing_profile_index_B;
-    }
+bool mode_state_has_unsaved_changes(void) {
+    return state_generation != saved_generation;
+}
 
-    if (op_mode == MODE_FIXED) {
-        state_to_save->fixed_bank = mode_fixed_get_bank();
-    } else {
-        state_to_save->fixed_bank = current_state->fixed_bank;
-    }
+void mode_state_mark_saved(uint32_t generation) {
+    saved_generation = generation;
+}
 
-    mode_drift_get_state(&state_to_save->drift_active, &state_to_save->drift_probability, &state_to_save->drift_ramp_up);
-    mode_fill_get_state(&state_to_save->fill_density, &state_to_save->fill_ramp_up);
-    mode_skip_get_state(&state_to_save->skip_active, &state_to_save->skip_probability, &state_to_save->skip_ramp_up);
-    mode_stutter_get_state(&state_to_save->stutter_active, &state_to_save->stutter_length,
-                           &state_to_save->stutter_ramp_up, state_to_save->stutter_variation_mask);
-    mode_morph_get_state(&state_to_save->morph_frozen, &state_to_save->morph_generation, state_to_save->morph_patterns);
-    mode_mute_get_state(&state_to_save->mute_mask, &state_to_save->mute_count,
-                        &state_to_save->mute_ramp_up, state_to_save->mute_variation_mask);
-    mode_density_get_state(&state_to_save->density_pct, &state_to_save->density_ramp_up);
-    mode_song_get_state(&state_to_save->song_variation_seed, &state_to_save->song_variation_pending);
-    mode_accumulate_get_state(&state_to_save->accumulate_active_count, &state_to_save->accumulate_add_pending,
-                              &state_to_save->accumulate_active_mask, state_to_save->accumulate_phase_offsets,
-                              state_to_save->accumulate_variation_masks);
-    mode_gamma_sequential_freeze_get_state(&state_to_save->gamma_seq_freeze_frozen,
-                                           &state_to_save->gamma_seq_freeze_step);
-    mode_gamma_sequential_trip_get_state(&state_to_save->gamma_seq_trip_pattern,
-                                          &state_to_save->gamma_seq_trip_step);
+void mode_state_apply_runtime(operational_mode_t op_mode, const krono_state_t *state) {
+    mode_descriptor(op_mode)->apply_state(state);
+}
 
-    if (op_mode == MODE_GAMMA_PORTALS) {
-        mode_gamma_portals_get_state(&state_to_save->gamma_portals_div_on_a);
-    } else {
-        state_to_save->gamma_portals_div_on_a = current_state->gamma_portals_div_on_a;
-    }
-    if (op_mode == MODE_GAMMA_COIN_TOSS) {
-        mode_gamma_coin_toss_get_state(&state_to_save->gamma_coin_invert);
-    } else {
-        state_to_save->gamma_coin_invert = current_state->gamma_coin_invert;
-    }
-    if (op_mode == MODE_GAMMA_RATCHET) {
-        mode_gamma_ratchet_get_state(&state_to_save->gamma_ratchet_double);
-    } else {
-        state_to_save->gamma_ratchet_double = current_state->gamma_ratchet_double;
-    }
-    if (op_mode == MODE_GAMMA_ANTI_RATCHET) {
-        mode_gamma_anti_ratchet_get_state(&state_to_save->gamma_antiratchet_half);
-    } else {
-        state_to_save->gamma_antiratchet_half = current_state->gamma_antiratchet_half;
-    }
-    if (op_mode == MODE_GAMMA_START_STOP) {
-        mode_gamma_start_stop_get_state(&state_to_save->gamma_startstop_muted);
-    } else {
-        state_to_save->gamma_startstop_muted = current_state->gamma_startstop_muted;
-    }
+bool mode_state_capture(operational_mode_t op_mode, krono_state_t *state) {
+    krono_state_t before = *state;
+    mode_descriptor(op_mode)->capture_state(state);
+    if (memcmp(&before, state, sizeof before) != 0) {
+        mode_state_mark_dirty();
+        return true;
+    }
+    return false;
+}
+
+void mode_state_capture_hot(operational_mode_t op_mode, krono_state_t *state) {
+    mode_descriptor(op_mode)->capture_hot(state);
 }
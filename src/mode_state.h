@@ -4,10 +4,22 @@
 #include "modes/modes.h"
 #include "drivers/persistence.h"
 
+#include <stdbool.h>
+#include <stdint.h>
+
 void mode_state_validate(krono_state_t *state);
+/** Hydrate only @p op_mode's runtime from @p state (call after the mode's init/reset). */
 void mode_state_apply_runtime(operational_mode_t op_mode, const krono_state_t *state);
-void mode_state_capture_for_save(operational_mode_t op_mode,
-                                 const krono_state_t *current_state,
-                                 krono_state_t *state_to_save);
+/** Copy @p op_mode's runtime into @p state; marks the state dirty and returns true if anything changed. */
+bool mode_state_capture(operational_mode_t op_mode, krono_state_t *state);
+
+/** Record a change to the persisted state (bumps the generation compared on save). */
+void mode_state_mark_dirty(void);
+uint32_t mode_state_generation(void);
+bool mode_state_has_unsaved_changes(void);
+/** Record that the state as of @p generation reached flash. */
+void mode_state_mark_saved(uint32_t generation);
+/** Copy the active mode's hot Gamma toggle (if any) from the runtime into @p state. */
+void mode_state_capture_hot(operational_mode_t op_mode, krono_state_t *state);
 
 #endif
@@ -12,12 +12,35 @@ static uint8_t active_count;
 static uint32_t accum_step;
 static bool add_pending; /* Persisted as freeze flag */
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
 static bool active_flags[MODE_RHYTHM_NUM_OUTPUTS];
 static uint8_t phase_offsets[MODE_RHYTHM_NUM_OUTPUTS];
 static uint16_t variation_masks[MODE_RHYTHM_NUM_OUTPUTS];
 static uint8_t bars_since_change;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
+
+/* Base XOR variation, rotated by each track's phase, inactive tracks cleared. */
+static void build_bar(void) {
+    uint16_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    uint16_t inactive = 0;
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        tracks[i] = mode_rhythm_base_pattern(s_calc, i);
+        if (!active_flags[i]) {
+            inactive |= (uint16_t)(1u << i);
+        }
+    }
+    const mode_rhythm_xf_t stages[] = {
+        { MODE_RHYTHM_XF_XOR, 0, MODE_RHYTHM_ALL_TRACKS, variation_masks, NULL },
+        { MODE_RHYTHM_XF_ROTATE, 0, MODE_RHYTHM_ALL_TRACKS, NULL, phase_offsets },
+        { MODE_RHYTHM_XF_CLEAR, 0, inactive, NULL, NULL },
+    };
+    mode_rhythm_xf_apply(tracks, stages, 3);
+    mode_rhythm_bar_build(&bar, tracks);
+    mode_step_clock_follow(&step_clock, &bar);
+    bar_dirty = false;
+}
 
 static void accumulate_activate_random(void) {
     int candidates[MODE_RHYTHM_NUM_OUTPUTS];
@@ -37,6 +60,7 @@ static void accumulate_activate_random(void) {
     uint8_t b1 = (uint8_t)(rand() % 16);
     uint8_t b2 = (uint8_t)(rand() % 16);
     variation_masks[idx] ^= (uint16_t)((1u << b1) | (1u << b2));
+    bar_dirty = true;
 }
 
 static void accumulate_reset_to_minimum(void) {
@@ -51,7 +75,6 @@ static void accumulate_reset_to_minimum(void) {
 
 void mode_accumulate_init(void) {
     mode_accumulate_reset();
-    next_step_time = 0;
 }
 
 void mode_accumulate_reset(void) {
@@ -59,7 +82,7 @@ void mode_accumulate_reset(void) {
     accum_step = 0;
     add_pending = false;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     bars_since_change = 0;
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         active_flags[i] = false;
@@ -74,6 +97,11 @@ void mode_accumulate_reset(void) {
 
 void mode_accumulate_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_accumulate_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_accumulate_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -104,6 +132,7 @@ void mode_accumulate_set_state(uint8_t count, bool pending, uint16_t active_mask
         active_flags[0] = true;
     }
     bars_since_change = 0;
+    bar_dirty = true;
 }
 
 void mode_accumulate_get_state(uint8_t *count, bool *pending, uint16_t *active_mask,
@@ -132,28 +161,18 @@ void mode_accumulate_update(const mode_context_t *context) {
     if (context->sync_request) {
         mode_accumulate_reset_step();
     }
-
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
+    if (context->calc_mode_changed) {
+        bar_dirty = true;
     }
 
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
         return;
     }
-
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
+    current_step = (uint8_t)step;
 
     accum_step++;
-    if (current_step == 0) {
+    if (step_clock.bar_start) {
         if (!add_pending) {
             bars_since_change++;
             if (bars_since_change >= active_count) {
@@ -169,19 +188,13 @@ void mode_accumulate_update(const mode_context_t *context) {
         }
     }
 
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        if (!active_flags[i]) {
-            continue;
-        }
-        uint16_t base = mode_rhythm_base_pattern(s_calc, i) ^ variation_masks[i];
-        uint8_t pos = (uint8_t)((current_step + phase_offsets[i]) & 0x0Fu);
-        if ((base >> pos) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
-        }
+    if (bar_dirty) {
+        build_bar();
     }
+    mode_rhythm_bar_play(&bar, current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
-    }
+uint32_t mode_accumulate_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -1,9 +1,8 @@
 #include "mode_chaos.h"
-#include "drivers/io.h"          // For set_output, jack_output_t, NUM_JACK_OUTPUTS
-#include "main_constants.h"    // For DEFAULT_PULSE_DURATION_MS
-#include "util/delay.h"        // Contains millis()
-#include <math.h>             // For fabsf if needed, maybe not
-#include <stdlib.h>           // For abs if needed, maybe not
+#include "mode_chaos_tables.h"
+#include "drivers/io.h"          // For io_trigger_at, io_now_us, jack_output_t
+#include "main_constants.h"
+#include "variables.h"         // For CHAOS_STEP_US, CHAOS_LOOKAHEAD_US
 #include <stddef.h>           // For NULL
 #include <stdbool.h>          // For true/false
 
@@ -17,13 +16,12 @@ static float lorenz_x = 0.1f;
 static float lorenz_y = 0.0f;
 static float lorenz_z = 0.0f;
 
-// Previous state for crossing detection
-static float prev_lorenz_x = 0.1f;
-static float prev_lorenz_y = 0.0f;
-static float prev_lorenz_z = 0.0f;
+// Simulation time step: one RK4 step of LORENZ_DT per CHAOS_STEP_US of output time
+static const float LORENZ_DT = 0.01f;
 
-// Simulation time step
-static const float LORENZ_DT = 0.01f; // Integration time step
+// Integrator clock: output time (io_now_us) at which the next step starts
+static uint32_t next_step_us = 0;
+static bool integrator_running = false;
 
 // Number of variable outputs (Outputs 2-6 for each group A/B)
 #define MODE_CHAOS_NUM_VAR_OUTPUTS 5 // Outputs 2-6
@@ -33,9 +31,6 @@ static const float X_THRESHOLDS[MODE_CHAOS_NUM_VAR_OUTPUTS] = { 5.0f, 10.0f, 15.
 static const float YZ_THRESHOLDS[MODE_CHAOS_NUM_VAR_OUTPUTS] = { 10.0f, 20.0f, -10.0f, 30.0f, 10.0f }; // Used for Group B
 static const bool YZ_USE_Y[MODE_CHAOS_NUM_VAR_OUTPUTS] = { true, false, true, false, false }; // Maps YZ_THRESHOLDS to y or z for Group B
 
-// Output pulse timing state
-static uint32_t trigger_start_time_ms[NUM_JACK_OUTPUTS] = {0}; // 0 means inactive
-
 // Crossing counters for divide-by-N logic
 static uint32_t x_crossing_counter[MODE_CHAOS_NUM_VAR_OUTPUTS] = {0};
 static uint32_t yz_crossing_counter[MODE_CHAOS_NUM_VAR_OUTPUTS] = {0};
@@ -43,6 +38,21 @@ static uint32_t yz_crossing_counter[MODE_CHAOS_NUM_VAR_OUTPUTS] = {0};
 // Divisor state (modified by Calc Swap button in this mode)
 // Constants defined in mode_chaos.h
 static uint32_t chaos_current_divisor = CHAOS_DIVISOR_DEFAULT;
+static uint8_t chaos_engine = CHAOS_ENGINE_LIVE_LORENZ;
+
+// Table playback: orbit position in substeps, advanced by elapsed output time at the tempo rate
+typedef struct {
+    const uint8_t *cursor; // Next varint delta
+    uint16_t index;        // Crossings consumed in this pass over the orbit
+    uint32_t origin;       // Substep at which this stream's current pass started
+    uint32_t next_pos;     // Substep of the next crossing
+} chaos_stream_state_t;
+
+static chaos_stream_state_t table_streams[CHAOS_TABLE_NUM_STREAMS];
+static uint32_t play_pos = 0;     // Current orbit position (substeps)
+static uint32_t play_rem = 0;     // Sub-substep remainder, in units of 1/tempo_us
+static uint32_t last_play_us = 0;
+static bool playback_running = false;
 
 // --- Helper Functions ---
 
@@ -56,26 +66,174 @@ static bool crossed_threshold(float current, float previous, float threshold) {
     if (threshold < 0 && previous > threshold && current <= threshold) {
          return true;
     }
-    // Check positive crossing for negative thresholds might also be useful depending on desired trigger
-    // if (threshold < 0 && previous < threshold && current >= threshold) return true;
-
     // Check negative crossing for positive thresholds
     if (threshold >= 0 && previous > threshold && current <= threshold) {
-         return true; // Trigger on down-crossing too? Let's try yes for now.
+         return true;
     }
     return false;
 }
 
+// Time within the step at which the straight line previous→current meets the threshold
+static uint32_t crossing_offset_us(float current, float previous, float threshold) {
+    float span = current - previous;
+    float f = (span != 0.0f) ? (threshold - previous) / span : 1.0f;
+    if (f < 0.0f) f = 0.0f;
+    if (f > 1.0f) f = 1.0f;
+    return (uint32_t)(f * (float)CHAOS_STEP_US);
+}
 
-// Set output trigger
-static void trigger_output(jack_output_t output_index) {
-    // is_pulsable_output >= JACK_OUT_1A is always true for unsigned types
-    bool is_pulsable_output = (output_index <= JACK_OUT_6A) ||
-                              (output_index >= JACK_OUT_1B && output_index <= JACK_OUT_6B);
+static void lorenz_derivative(float x, float y, float z, float *dx, float *dy, float *dz) {
+    *dx = LORENZ_SIGMA * (y - x);
+    *dy = x * (LORENZ_RHO - z) - y;
+    *dz = x * y - LORENZ_BETA * z;
+}
 
-    if (is_pulsable_output) {
-        set_output(output_index, true); // true for HIGH
-        trigger_start_time_ms[output_index] = millis();
+// One classic RK4 step: fixed cost, and the trajectory depends only on the step count
+static void lorenz_step_rk4(void) {
+    const float h = LORENZ_DT;
+    float k1x, k1y, k1z, k2x, k2y, k2z, k3x, k3y, k3z, k4x, k4y, k4z;
+
+    lorenz_derivative(lorenz_x, lorenz_y, lorenz_z, &k1x, &k1y, &k1z);
+    lorenz_derivative(lorenz_x + 0.5f * h * k1x, lorenz_y + 0.5f * h * k1y, lorenz_z + 0.5f * h * k1z,
+                      &k2x, &k2y, &k2z);
+    lorenz_derivative(lorenz_x + 0.5f * h * k2x, lorenz_y + 0.5f * h * k2y, lorenz_z + 0.5f * h * k2z,
+                      &k3x, &k3y, &k3z);
+    lorenz_derivative(lorenz_x + h * k3x, lorenz_y + h * k3y, lorenz_z + h * k3z,
+                      &k4x, &k4y, &k4z);
+
+    lorenz_x += (h / 6.0f) * (k1x + 2.0f * k2x + 2.0f * k3x + k4x);
+    lorenz_y += (h / 6.0f) * (k1y + 2.0f * k2y + 2.0f * k3y + k4y);
+    lorenz_z += (h / 6.0f) * (k1z + 2.0f * k2z + 2.0f * k3z + k4z);
+}
+
+// Count a crossing and, every `divisor` crossings, schedule the trigger at its interpolated time
+static void handle_crossing(uint32_t *counter, jack_output_t output, uint32_t at_us) {
+    (*counter)++;
+    if (*counter % chaos_current_divisor == 0) {
+        io_trigger_at(output, at_us);
+    }
+}
+
+// Advance one step starting at step_start_us and fire the crossings that fall inside it
+static void integrate_step(uint32_t step_start_us) {
+    float prev_x = lorenz_x;
+    float prev_y = lorenz_y;
+    float prev_z = lorenz_z;
+
+    lorenz_step_rk4();
+
+    // Threshold assignments are FIXED: Group A=X, Group B=Y/Z
+    for (int i = 0; i < MODE_CHAOS_NUM_VAR_OUTPUTS; ++i) {
+        float threshold = X_THRESHOLDS[i];
+        if (crossed_threshold(lorenz_x, prev_x, threshold)) {
+            handle_crossing(&x_crossing_counter[i], (jack_output_t)(JACK_OUT_2A + i),
+                            step_start_us + crossing_offset_us(lorenz_x, prev_x, threshold));
+        }
+    }
+    for (int i = 0; i < MODE_CHAOS_NUM_VAR_OUTPUTS; ++i) {
+        float threshold = YZ_THRESHOLDS[i];
+        float current_val = YZ_USE_Y[i] ? lorenz_y : lorenz_z;
+        float prev_val = YZ_USE_Y[i] ? prev_y : prev_z;
+        if (crossed_threshold(current_val, prev_val, threshold)) {
+            handle_crossing(&yz_crossing_counter[i], (jack_output_t)(JACK_OUT_2B + i),
+                            step_start_us + crossing_offset_us(current_val, prev_val, threshold));
+        }
+    }
+}
+
+// Decode one LEB128 varint and move the cursor past it
+static uint32_t read_varint(const uint8_t **p) {
+    uint32_t v = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+    do {
+        b = *(*p)++;
+        v |= (uint32_t)(b & 0x7Fu) << shift;
+        shift = (uint8_t)(shift + 7u);
+    } while ((b & 0x80u) && shift < 32u);
+    return v;
+}
+
+// Step a stream to its next crossing, wrapping to the start of the next orbit pass
+static void stream_advance(chaos_stream_state_t *st, const chaos_table_stream_t *src, uint32_t orbit) {
+    if (st->index >= src->count) {
+        st->origin += orbit;
+        st->cursor = src->data;
+        st->index = 0;
+        st->next_pos = st->origin;
+    }
+    st->next_pos += read_varint(&st->cursor);
+    st->index++;
+}
+
+static void playback_start(void) {
+    const chaos_table_t *t = &chaos_tables[chaos_engine - CHAOS_ENGINE_TABLE_LORENZ];
+    play_pos = 0;
+    play_rem = 0;
+    last_play_us = io_now_us();
+    for (int i = 0; i < CHAOS_TABLE_NUM_STREAMS; i++) {
+        table_streams[i].cursor = t->streams[i].data;
+        table_streams[i].index = 0;
+        table_streams[i].origin = 0;
+        table_streams[i].next_pos = 0;
+        if (t->streams[i].count != 0) {
+            stream_advance(&table_streams[i], &t->streams[i], t->orbit_substeps);
+        } else {
+            table_streams[i].next_pos = UINT32_MAX;
+        }
+    }
+    playback_running = true;
+}
+
+// Stream the selected table: steps_per_beat steps per tempo interval, crossings scheduled ahead
+static void playback_update(uint32_t tempo_interval_ms) {
+    const chaos_table_t *t = &chaos_tables[chaos_engine - CHAOS_ENGINE_TABLE_LORENZ];
+    if (!playback_running) {
+        playback_start();
+    }
+    uint32_t now_us = io_now_us();
+    uint32_t tempo_us = tempo_interval_ms * 1000u;
+    uint32_t rate = (uint32_t)t->steps_per_beat * CHAOS_TABLE_SUBSTEPS; // Substeps per beat
+
+    uint32_t elapsed_us = now_us - last_play_us;
+    if (elapsed_us > CHAOS_MAX_CATCHUP_STEPS * CHAOS_STEP_US) {
+        elapsed_us = CHAOS_MAX_CATCHUP_STEPS * CHAOS_STEP_US; // Stalled: resume rather than burst
+    }
+    last_play_us = now_us;
+    uint64_t acc = (uint64_t)elapsed_us * rate + play_rem;
+    play_pos += (uint32_t)(acc / tempo_us);
+    play_rem = (uint32_t)(acc % tempo_us);
+
+    uint32_t horizon = play_pos + (uint32_t)(((uint64_t)CHAOS_LOOKAHEAD_US * rate) / tempo_us);
+    for (int i = 0; i < CHAOS_TABLE_NUM_STREAMS; i++) {
+        chaos_stream_state_t *st = &table_streams[i];
+        const chaos_table_stream_t *src = &t->streams[i];
+        if (src->count == 0) {
+            continue;
+        }
+        while ((int32_t)(horizon - st->next_pos) >= 0) {
+            uint32_t at_us = now_us;
+            if ((int32_t)(st->next_pos - play_pos) > 0) {
+                at_us += (uint32_t)(((uint64_t)(st->next_pos - play_pos) * tempo_us) / rate);
+            }
+            jack_output_t output = (jack_output_t)((i < MODE_CHAOS_NUM_VAR_OUTPUTS) ? (JACK_OUT_2A + i)
+                                                   : (JACK_OUT_2B + i - MODE_CHAOS_NUM_VAR_OUTPUTS));
+            uint32_t *counter = (i < MODE_CHAOS_NUM_VAR_OUTPUTS) ? &x_crossing_counter[i]
+                                                                : &yz_crossing_counter[i - MODE_CHAOS_NUM_VAR_OUTPUTS];
+            handle_crossing(counter, output, at_us);
+            stream_advance(st, src, t->orbit_substeps);
+        }
+    }
+
+    // Keep positions small: every stream is past the horizon, so one orbit can come off all of them
+    if (play_pos >= t->orbit_substeps) {
+        play_pos -= t->orbit_substeps;
+        for (int i = 0; i < CHAOS_TABLE_NUM_STREAMS; i++) {
+            if (t->streams[i].count != 0) {
+                table_streams[i].origin -= t->orbit_substeps;
+                table_streams[i].next_pos -= t->orbit_substeps;
+            }
+        }
     }
 }
 
@@ -86,15 +244,13 @@ void mode_chaos_init(void) {
     lorenz_x = 0.1f;
     lorenz_y = 0.0f;
     lorenz_z = 0.0f;
-    prev_lorenz_x = lorenz_x;
-    prev_lorenz_y = lorenz_y;
-    prev_lorenz_z = lorenz_z;
+    integrator_running = false;
+    playback_running = false;
 
-    // Reset trigger timers and outputs
+    // Reset outputs
     for (jack_output_t i = JACK_OUT_1A; i <= JACK_OUT_6B; ++i) {
          bool is_group_b_output = (i >= JACK_OUT_1B && i <= JACK_OUT_6B);
          if (i > JACK_OUT_6A && !is_group_b_output) continue;
-         trigger_start_time_ms[i] = 0;
          set_output(i, false);
     }
 
@@ -113,7 +269,6 @@ void mode_chaos_reset(void) {
          bool is_group_b_output = (i >= JACK_OUT_2B && i <= JACK_OUT_6B);
          if (i > JACK_OUT_6A && !is_group_b_output) continue;
          set_output(i, false);
-         trigger_start_time_ms[i] = 0;
     }
 
     // Reset crossing counters
@@ -123,98 +278,52 @@ void mode_chaos_reset(void) {
     }
     // Reset divisor to default
     chaos_current_divisor = CHAOS_DIVISOR_DEFAULT;
-    // Don't reset simulation state here
+    // Don't reset simulation state here; the integrator clock restarts on the next update
+    integrator_running = false;
+    playback_running = false;
 }
 
 void mode_chaos_update(const mode_context_t *context) {
-    uint32_t current_ms = millis();
-
-    // 1. Turn off outputs whose pulse duration has expired FIRST
-    // This ensures that pulse timing is as accurate as possible, minimizing jitter
-    // from calculations below.
-    for (jack_output_t i = JACK_OUT_1A; i <= JACK_OUT_6B; ++i) {
-        bool is_group_b_output = (i >= JACK_OUT_1B && i <= JACK_OUT_6B);
-        // Skip outputs not managed by chaos mode (e.g., if iterating through all possible outputs)
-        // Chaos mode specifically manages 2A-6A and 2B-6B.
-        // F1 outputs (1A/1B) are managed by clock_manager.
-        if (i == JACK_OUT_1A || i == JACK_OUT_1B) continue; 
-        if (i > JACK_OUT_6A && !is_group_b_output) continue; // Skip invalid enum gaps
-
-        if (trigger_start_time_ms[i] != 0 && (current_ms - trigger_start_time_ms[i] >= DEFAULT_PULSE_DURATION_MS)) {
-            set_output(i, false);
-            trigger_start_time_ms[i] = 0;
-        }
-    }
-
     // --- Adjust divisor on PA1 press (Calc Mode Swap button in this mode) ---
-    // This is checked *after* pulse turn-off to ensure divisor changes don't affect
-    // the current cycle's pulse-off logic if it was already triggered.
     if (context->calc_mode_changed) { // True if PA1 was pressed (calc mode swap event)
         if (chaos_current_divisor <= CHAOS_DIVISOR_MIN) { // If at or below minimum, cycle to default
              chaos_current_divisor = CHAOS_DIVISOR_DEFAULT;
+             // ...and move on to the next attractor engine
+             chaos_engine = (uint8_t)((chaos_engine + 1u) % NUM_CHAOS_ENGINES);
+             integrator_running = false;
+             playback_running = false;
         } else {
             chaos_current_divisor -= CHAOS_DIVISOR_STEP;
             // Ensure it doesn't go below min after decrementing
             if (chaos_current_divisor < CHAOS_DIVISOR_MIN) {
                  chaos_current_divisor = CHAOS_DIVISOR_MIN;
             }
-        } 
+        }
         // The change in divisor will affect the *next* trigger event.
     }
 
-    // 2. Run Lorenz simulation steps
-    uint32_t elapsed_ms = context->ms_since_last_call;
-    if (elapsed_ms == 0) elapsed_ms = 1; // Ensure at least one step if called very rapidly
-    if (elapsed_ms > 100) elapsed_ms = 100; // Cap elapsed time to prevent excessive steps
-    
-    // Calculate number of simulation steps based on elapsed time and Lorenz DT
-    int num_steps = (int)((float)elapsed_ms / (LORENZ_DT * 1000.0f));
-    num_steps = num_steps > 0 ? num_steps : 1; // Ensure at least one simulation step
-    
-    prev_lorenz_x = lorenz_x;
-    prev_lorenz_y = lorenz_y;
-    prev_lorenz_z = lorenz_z;
-    
-    for (int i = 0; i < num_steps; ++i) {
-        float dx = LORENZ_SIGMA * (lorenz_y - lorenz_x);
-        float dy = lorenz_x * (LORENZ_RHO - lorenz_z) - lorenz_y;
-        float dz = lorenz_x * lorenz_y - LORENZ_BETA * lorenz_z;
-        lorenz_x += dx * LORENZ_DT;
-        lorenz_y += dy * LORENZ_DT;
-        lorenz_z += dz * LORENZ_DT;
-    }
-
-    // 3. Check for threshold crossings and trigger new outputs
-    // Threshold assignments are FIXED: Group A=X, Group B=Y/Z
-
-    // --- Group A Triggering (Outputs 2A-6A) --- 
-    for (int i = 0; i < MODE_CHAOS_NUM_VAR_OUTPUTS; ++i) {
-        jack_output_t output = (jack_output_t)(JACK_OUT_2A + i);
-        float threshold = X_THRESHOLDS[i];
-        bool crossed = crossed_threshold(lorenz_x, prev_lorenz_x, threshold);
-
-        if (crossed) {
-             x_crossing_counter[i]++;
-             if (trigger_start_time_ms[output] == 0 && (x_crossing_counter[i] % chaos_current_divisor == 0)) {
-                 trigger_output(output);
-             }
+    if (chaos_engine != CHAOS_ENGINE_LIVE_LORENZ) {
+        bool tempo_valid = (context->current_tempo_interval_ms >= MIN_INTERVAL &&
+                            context->current_tempo_interval_ms <= MAX_INTERVAL);
+        if (tempo_valid) {
+            playback_update(context->current_tempo_interval_ms);
         }
+        return;
     }
 
-    // --- Group B Triggering (Outputs 2B-6B) ---
-    for (int i = 0; i < MODE_CHAOS_NUM_VAR_OUTPUTS; ++i) {
-        jack_output_t output = (jack_output_t)(JACK_OUT_2B + i);
-        float threshold = YZ_THRESHOLDS[i];
-        float current_val = YZ_USE_Y[i] ? lorenz_y : lorenz_z;
-        float prev_val = YZ_USE_Y[i] ? prev_lorenz_y : prev_lorenz_z;
-        bool crossed = crossed_threshold(current_val, prev_val, threshold);
-
-         if (crossed) {
-             yz_crossing_counter[i]++;
-             if (trigger_start_time_ms[output] == 0 && (yz_crossing_counter[i] % chaos_current_divisor == 0)) {
-                 trigger_output(output);
-             }
-         }
+    // Run the Lorenz system on its own fixed clock, a little ahead of now, so that crossings
+    // found inside a step are still in the future and can be scheduled at their exact time.
+    uint32_t horizon_us = io_now_us() + CHAOS_LOOKAHEAD_US;
+    if (!integrator_running) {
+        next_step_us = io_now_us();
+        integrator_running = true;
+    }
+    if ((int32_t)(horizon_us - next_step_us) > (int32_t)(CHAOS_MAX_CATCHUP_STEPS * CHAOS_STEP_US)) {
+        next_step_us = io_now_us(); // Stalled too long (e.g. flash write): skip ahead, don't burst
+    }
+    while ((int32_t)(horizon_us - (next_step_us + CHAOS_STEP_US)) >= 0) {
+        integrate_step(next_step_us);
+        next_step_us += CHAOS_STEP_US;
     }
 }
 
@@ -232,3 +341,13 @@ void mode_chaos_set_divisor(uint32_t divisor) {
         chaos_current_divisor = CHAOS_DIVISOR_DEFAULT; // Use default if loaded value is invalid
     }
 }
+
+uint8_t mode_chaos_get_engine(void) {
+    return chaos_engine;
+}
+
+void mode_chaos_set_engine(uint8_t engine) {
+    chaos_engine = (engine < NUM_CHAOS_ENGINES) ? engine : CHAOS_ENGINE_LIVE_LORENZ;
+    integrator_running = false;
+    playback_running = false;
+}
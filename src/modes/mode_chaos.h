@@ -10,6 +10,15 @@
 #define CHAOS_DIVISOR_STEP    50
 #define CHAOS_DIVISOR_MIN     10
 
+// Trigger sources. Calc Swap steps the divisor; when it wraps back to default the next engine is selected.
+typedef enum {
+    CHAOS_ENGINE_LIVE_LORENZ = 0, // Fixed-step RK4 integration
+    CHAOS_ENGINE_TABLE_LORENZ,    // Precomputed orbits streamed from flash (mode_chaos_tables.c)
+    CHAOS_ENGINE_TABLE_ROSSLER,
+    CHAOS_ENGINE_TABLE_CHUA,
+    NUM_CHAOS_ENGINES
+} chaos_engine_t;
+
 // Functions are declared in modes.h
 // void mode_chaos_init(void);
 // void mode_chaos_update(const mode_context_t *context);
@@ -20,5 +29,7 @@
 // For now, keep them here as they are chaos-specific parameters.
 uint32_t mode_chaos_get_divisor(void);
 void mode_chaos_set_divisor(uint32_t divisor);
+uint8_t mode_chaos_get_engine(void);
+void mode_chaos_set_engine(uint8_t engine);
 
 #endif // MODE_CHAOS_H
@@ -0,0 +1,784 @@
+/* Generated by scripts/chaos_tables.py - do not edit. */
+#include "mode_chaos_tables.h"
+
+static const uint8_t lorenz_stream_0[392] = {
+    0x93, 0x03, 0xE4, 0x2A, 0xE8, 0x16, 0xA8, 0x01, 0xC5, 0x06, 0x81, 0x02, 0x81, 0x06, 0xD0, 0x02,
+    0xCB, 0x05, 0xA5, 0x03, 0x96, 0x05, 0x9A, 0x04, 0xE0, 0x04, 0xDD, 0x06, 0x91, 0x04, 0xBE, 0x20,
+    0xBB, 0x04, 0xF5, 0x0E, 0xC1, 0x04, 0xD1, 0x0E, 0xDD, 0x04, 0x8A, 0x07, 0x8C, 0x04, 0x83, 0x29,
+    0xBB, 0x05, 0xAA, 0x03, 0x94, 0x05, 0xA1, 0x04, 0xDD, 0x04, 0x95, 0x07, 0x8A, 0x04, 0xDA, 0x28,
+    0x83, 0x05, 0xCC, 0x04, 0xCE, 0x04, 0xD6, 0x0E, 0xB9, 0x05, 0xAE, 0x03, 0x92, 0x05, 0xA7, 0x04,
+    0xDB, 0x04, 0xCD, 0x07, 0x84, 0x04, 0xBF, 0x2B, 0xF8, 0x03, 0xB5, 0x39, 0xA8, 0x04, 0xD3, 0x17,
+    0x82, 0x05, 0xD4, 0x04, 0xCB, 0x04, 0xC8, 0x0E, 0x9D, 0x05, 0xF4, 0x03, 0xF0, 0x04, 0xBF, 0x05,
+    0xAE, 0x04, 0xD3, 0x13, 0xEA, 0x03, 0xC6, 0x51, 0x9F, 0x04, 0x98, 0x18, 0xAD, 0x04, 0xBE, 0x18,
+    0x8F, 0x06, 0x8B, 0x02, 0xFB, 0x05, 0xDA, 0x02, 0xC4, 0x05, 0xB0, 0x03, 0x91, 0x05, 0xAC, 0x04,
+    0xD9, 0x04, 0xA1, 0x08, 0xFB, 0x03, 0xE3, 0x39, 0xE8, 0x05, 0xCF, 0x02, 0xCB, 0x05, 0xA4, 0x03,
+    0x98, 0x05, 0x97, 0x04, 0xE1, 0x04, 0xD2, 0x06, 0x93, 0x04, 0xA7, 0x20, 0xD1, 0x04, 0x8A, 0x0F,
+    0x81, 0x06, 0xA4, 0x02, 0xE8, 0x05, 0xF5, 0x02, 0xB3, 0x05, 0xD3, 0x03, 0xFF, 0x04, 0xED, 0x04,
+    0xC4, 0x04, 0xC9, 0x0E, 0xE8, 0x04, 0xF3, 0x05, 0xA3, 0x04, 0xDE, 0x17, 0xD0, 0x04, 0xE4, 0x0E,
+    0xD1, 0x05, 0xFD, 0x02, 0xAE, 0x05, 0xDD, 0x03, 0xFA, 0x04, 0x85, 0x05, 0xBD, 0x04, 0xED, 0x0E,
+    0xC6, 0x04, 0xC3, 0x0E, 0xF8, 0x04, 0x82, 0x05, 0xBE, 0x04, 0xE7, 0x0E, 0xC9, 0x04, 0xC4, 0x0E,
+    0x8F, 0x05, 0xA1, 0x04, 0xDD, 0x04, 0x8C, 0x07, 0x8B, 0x04, 0xFA, 0x28, 0xB1, 0x05, 0xC2, 0x03,
+    0x87, 0x05, 0xCD, 0x04, 0xCE, 0x04, 0xD3, 0x0E, 0xB6, 0x05, 0xB6, 0x03, 0x8D, 0x05, 0xB5, 0x04,
+    0xD6, 0x04, 0xE9, 0x0B, 0xE1, 0x03, 0xD2, 0x68, 0xC6, 0x04, 0xC3, 0x0E, 0xF7, 0x04, 0x87, 0x05,
+    0xBC, 0x04, 0xF2, 0x0E, 0xC3, 0x04, 0xC9, 0x0E, 0xE8, 0x04, 0xEE, 0x05, 0xA4, 0x04, 0xD7, 0x17,
+    0xD9, 0x04, 0xD5, 0x07, 0x82, 0x04, 0xEA, 0x31, 0x85, 0x06, 0x9D, 0x02, 0xED, 0x05, 0xED, 0x02,
+    0xB8, 0x05, 0xC9, 0x03, 0x84, 0x05, 0xD9, 0x04, 0xCA, 0x04, 0xC4, 0x0E, 0x90, 0x05, 0x9C, 0x04,
+    0xDF, 0x04, 0xEE, 0x06, 0x8F, 0x04, 0x8D, 0x21, 0x9D, 0x04, 0xD9, 0x18, 0x9B, 0x04, 0xD6, 0x1A,
+    0xF8, 0x03, 0x88, 0x39, 0xC3, 0x04, 0xCB, 0x0E, 0xE4, 0x04, 0x9C, 0x06, 0x9C, 0x04, 0xB4, 0x19,
+    0x8A, 0x04, 0xE0, 0x28, 0x8E, 0x05, 0xA4, 0x04, 0xDC, 0x04, 0xA2, 0x07, 0x88, 0x04, 0xD1, 0x28,
+    0xDB, 0x04, 0xAC, 0x07, 0x87, 0x04, 0xDC, 0x28,
+};
+static const uint8_t lorenz_stream_1[399] = {
+    0x06, 0xC1, 0x02, 0xE5, 0x2D, 0x90, 0x02, 0xE9, 0x05, 0x9C, 0x02, 0xE7, 0x05, 0xA6, 0x02, 0xE7,
+    0x05, 0xAF, 0x02, 0xED, 0x05, 0xB6, 0x02, 0xFB, 0x05, 0xBC, 0x02, 0x96, 0x06, 0xC1, 0x02, 0xD1,
+    0x06, 0xC5, 0x02, 0xD1, 0x08, 0xC2, 0x02, 0xA1, 0x22, 0xC5, 0x02, 0xEF, 0x10, 0xC4, 0x02, 0xDB,
+    0x10, 0xC4, 0x02, 0xFC, 0x08, 0xC1, 0x02, 0xA5, 0x2B, 0xBC, 0x02, 0x97, 0x06, 0xC2, 0x02, 0xD6,
+    0x06, 0xC4, 0x02, 0x85, 0x09, 0xC1, 0x02, 0xDF, 0x2A, 0xC2, 0x02, 0xF2, 0x06, 0xC5, 0x02, 0x95,
+    0x11, 0xBC, 0x02, 0x99, 0x06, 0xC2, 0x02, 0xDA, 0x06, 0xC4, 0x02, 0xB9, 0x09, 0xC0, 0x02, 0xFE,
+    0x2C, 0xBE, 0x02, 0x85, 0x3B, 0xC3, 0x02, 0xE5, 0x19, 0xC2, 0x02, 0xF8, 0x06, 0xC5, 0x02, 0xF8,
+    0x10, 0xC0, 0x02, 0xBB, 0x06, 0xC3, 0x02, 0xCA, 0x07, 0xC4, 0x02, 0x9E, 0x15, 0xBC, 0x02, 0x8C,
+    0x53, 0xC3, 0x02, 0xFB, 0x19, 0xC4, 0x02, 0x96, 0x1B, 0xAE, 0x02, 0xEF, 0x05, 0xB6, 0x02, 0xFE,
+    0x05, 0xBC, 0x02, 0x9B, 0x06, 0xC2, 0x02, 0xDD, 0x06, 0xC5, 0x02, 0x88, 0x0A, 0xBF, 0x02, 0x93,
+    0x3C, 0xB5, 0x02, 0xFB, 0x05, 0xBC, 0x02, 0x95, 0x06, 0xC1, 0x02, 0xD0, 0x06, 0xC4, 0x02, 0xC8,
+    0x08, 0xC2, 0x02, 0x96, 0x22, 0xC5, 0x02, 0xED, 0x11, 0xB1, 0x02, 0xF3, 0x05, 0xB8, 0x02, 0x85,
+    0x06, 0xBF, 0x02, 0xAA, 0x06, 0xC3, 0x02, 0x8A, 0x07, 0xC5, 0x02, 0xDA, 0x10, 0xC4, 0x02, 0xF5,
+    0x07, 0xC3, 0x02, 0xD4, 0x19, 0xC4, 0x02, 0xB1, 0x11, 0xB9, 0x02, 0x87, 0x06, 0xBF, 0x02, 0xB0,
+    0x06, 0xC3, 0x02, 0x9C, 0x07, 0xC4, 0x02, 0xEA, 0x10, 0xC4, 0x02, 0xDE, 0x10, 0xC3, 0x02, 0x9A,
+    0x07, 0xC4, 0x02, 0xE7, 0x10, 0xC4, 0x02, 0xEC, 0x10, 0xC1, 0x02, 0xD6, 0x06, 0xC4, 0x02, 0xFD,
+    0x08, 0xC1, 0x02, 0x96, 0x2B, 0xBD, 0x02, 0xA3, 0x06, 0xC2, 0x02, 0xF3, 0x06, 0xC4, 0x02, 0x92,
+    0x11, 0xBC, 0x02, 0x9D, 0x06, 0xC2, 0x02, 0xE3, 0x06, 0xC4, 0x02, 0xC3, 0x0D, 0xBA, 0x02, 0xA8,
+    0x6A, 0xC4, 0x02, 0xDE, 0x10, 0xC3, 0x02, 0x9D, 0x07, 0xC5, 0x02, 0xEC, 0x10, 0xC4, 0x02, 0xDB,
+    0x10, 0xC3, 0x02, 0xF1, 0x07, 0xC3, 0x02, 0xD2, 0x19, 0xC5, 0x02, 0xC0, 0x09, 0xC0, 0x02, 0xAA,
+    0x34, 0xB0, 0x02, 0xF2, 0x05, 0xB8, 0x02, 0x82, 0x06, 0xBE, 0x02, 0xA6, 0x06, 0xC2, 0x02, 0xFC,
+    0x06, 0xC4, 0x02, 0xED, 0x10, 0xC1, 0x02, 0xD3, 0x06, 0xC4, 0x02, 0xE1, 0x08, 0xC2, 0x02, 0xE1,
+    0x22, 0xC3, 0x02, 0xB2, 0x1A, 0xC3, 0x02, 0x9E, 0x1C, 0xBE, 0x02, 0xE5, 0x3A, 0xC5, 0x02, 0xDA,
+    0x10, 0xC4, 0x02, 0x99, 0x08, 0xC2, 0x02, 0x85, 0x1B, 0xC1, 0x02, 0xEB, 0x2A, 0xC1, 0x02, 0xD7,
+    0x06, 0xC4, 0x02, 0x91, 0x09, 0xC1, 0x02, 0xC1, 0x2A, 0xC4, 0x02, 0x99, 0x09, 0xC1, 0x02,
+};
+static const uint8_t lorenz_stream_2[136] = {
+    0x68, 0x92, 0x01, 0xE7, 0x74, 0x8E, 0x01, 0xF7, 0x23, 0x4C, 0xED, 0x12, 0x40, 0xF4, 0x1D, 0x94,
+    0x01, 0x86, 0x4A, 0x95, 0x01, 0x83, 0x67, 0x9C, 0x01, 0x9C, 0x2E, 0xA5, 0x01, 0xBA, 0x3C, 0x72,
+    0xA0, 0x25, 0x14, 0x87, 0x26, 0x67, 0xD3, 0x16, 0xAF, 0x01, 0xB5, 0x54, 0x7D, 0xCB, 0x1B, 0x6A,
+    0xE5, 0x4B, 0xA3, 0x01, 0xDB, 0x62, 0x8B, 0x01, 0xC1, 0x5B, 0x39, 0xFE, 0x1C, 0x78, 0xB8, 0x4A,
+    0x4C, 0xF1, 0x12, 0x2E, 0xC4, 0x1C, 0x49, 0xF6, 0x12, 0x20, 0xAD, 0x27, 0x94, 0x01, 0x9F, 0x74,
+    0xB5, 0x01, 0xF5, 0x6B, 0x2E, 0xC6, 0x1C, 0x4C, 0xEF, 0x12, 0x38, 0xFB, 0x1C, 0x77, 0x8E, 0x27,
+    0x9C, 0x01, 0x8E, 0x59, 0x1D, 0x93, 0x27, 0x8F, 0x01, 0x9C, 0x24, 0x80, 0x01, 0xF3, 0x1B, 0x83,
+    0x01, 0xCB, 0x1D, 0xA5, 0x01, 0xB6, 0x3C, 0x3B, 0x9D, 0x1D, 0x81, 0x01, 0xBC, 0x1C, 0x94, 0x01,
+    0x84, 0x41, 0x97, 0x01, 0xC7, 0x37, 0x98, 0x01,
+};
+static const uint8_t lorenz_stream_3[446] = {
+    0xD4, 0x06, 0xB6, 0x05, 0xB5, 0x03, 0x8E, 0x05, 0xB3, 0x04, 0xD7, 0x04, 0xFB, 0x09, 0xEC, 0x03,
+    0xA3, 0x51, 0xA4, 0x05, 0xE2, 0x03, 0xF8, 0x04, 0x91, 0x05, 0xBA, 0x04, 0x8B, 0x0F, 0xB7, 0x04,
+    0xAE, 0x0F, 0xAB, 0x04, 0xF5, 0x17, 0xBB, 0x05, 0xAA, 0x03, 0x94, 0x05, 0xA0, 0x04, 0xDE, 0x04,
+    0x8A, 0x07, 0x8B, 0x04, 0x88, 0x29, 0xC1, 0x05, 0x9D, 0x03, 0x9B, 0x05, 0x8E, 0x04, 0xE5, 0x04,
+    0x9C, 0x06, 0x9C, 0x04, 0xAA, 0x19, 0x8C, 0x04, 0xA4, 0x29, 0xDF, 0x05, 0xE1, 0x02, 0xBF, 0x05,
+    0xBA, 0x03, 0x8B, 0x05, 0xBC, 0x04, 0xD4, 0x04, 0xB1, 0x0F, 0xAF, 0x06, 0xD3, 0x01, 0xA4, 0x06,
+    0xA6, 0x02, 0xE7, 0x05, 0xF5, 0x02, 0xB3, 0x05, 0xD4, 0x03, 0xFE, 0x04, 0xF0, 0x04, 0xC3, 0x04,
+    0xCC, 0x0E, 0xE3, 0x04, 0x98, 0x06, 0x9D, 0x04, 0xFC, 0x18, 0x93, 0x04, 0xA5, 0x20, 0xD5, 0x04,
+    0xBF, 0x10, 0x89, 0x17, 0x5A, 0xFD, 0x06, 0xCE, 0x01, 0xA8, 0x06, 0xA1, 0x02, 0xEA, 0x05, 0xF1,
+    0x02, 0xB5, 0x05, 0xCE, 0x03, 0x82, 0x05, 0xE3, 0x04, 0xC7, 0x04, 0xC3, 0x0E, 0xFA, 0x04, 0xF7,
+    0x04, 0xC1, 0x04, 0xD5, 0x0E, 0xD8, 0x04, 0x9F, 0x08, 0xFB, 0x03, 0x89, 0x3A, 0x90, 0x06, 0x89,
+    0x02, 0xFC, 0x05, 0xD8, 0x02, 0xC5, 0x05, 0xAE, 0x03, 0x92, 0x05, 0xA8, 0x04, 0xDB, 0x04, 0xDE,
+    0x07, 0x82, 0x04, 0x8B, 0x31, 0x9E, 0x05, 0xF2, 0x03, 0xF0, 0x04, 0xBA, 0x05, 0xAF, 0x04, 0xBC,
+    0x11, 0xFE, 0x03, 0xAD, 0x31, 0xA6, 0x04, 0xD2, 0x17, 0xEF, 0x04, 0xB5, 0x05, 0xB0, 0x04, 0xEE,
+    0x10, 0x86, 0x04, 0xF4, 0x28, 0xB5, 0x04, 0xD6, 0x0F, 0xA0, 0x04, 0x88, 0x18, 0xB3, 0x04, 0xFD,
+    0x0F, 0x98, 0x04, 0xCE, 0x20, 0xBC, 0x05, 0xA8, 0x03, 0x95, 0x05, 0x9D, 0x04, 0xDF, 0x04, 0xF6,
+    0x06, 0x8E, 0x04, 0xE1, 0x21, 0x8C, 0x04, 0x9F, 0x2C, 0xEF, 0x2E, 0x7E, 0xE4, 0x06, 0xE3, 0x01,
+    0x97, 0x06, 0xB5, 0x02, 0xDD, 0x05, 0x85, 0x03, 0xA9, 0x05, 0xE9, 0x03, 0xF5, 0x04, 0xA3, 0x05,
+    0xB5, 0x04, 0xD5, 0x0F, 0xA1, 0x04, 0x82, 0x18, 0xB6, 0x04, 0xBE, 0x0F, 0xA6, 0x04, 0xD1, 0x17,
+    0xED, 0x04, 0xC9, 0x05, 0xAC, 0x04, 0x96, 0x18, 0xE4, 0x05, 0xD9, 0x02, 0xC4, 0x05, 0xB0, 0x03,
+    0x91, 0x05, 0xAC, 0x04, 0xD9, 0x04, 0x8E, 0x08, 0xFD, 0x03, 0xE2, 0x31, 0x98, 0x04, 0xC1, 0x20,
+    0xAC, 0x05, 0xCD, 0x03, 0x82, 0x05, 0xE0, 0x04, 0xC8, 0x04, 0xC3, 0x0E, 0xFF, 0x04, 0xDD, 0x04,
+    0xC9, 0x04, 0xC2, 0x0E, 0x87, 0x05, 0xBD, 0x04, 0xD3, 0x04, 0xAB, 0x0F, 0xA6, 0x06, 0xE2, 0x01,
+    0x99, 0x06, 0xB3, 0x02, 0xDE, 0x05, 0x83, 0x03, 0xAA, 0x05, 0xE7, 0x03, 0xF6, 0x04, 0x9D, 0x05,
+    0xB7, 0x04, 0xB8, 0x0F, 0xA7, 0x04, 0xD5, 0x17, 0x84, 0x05, 0xCA, 0x04, 0xCE, 0x04, 0xD9, 0x0E,
+    0xC0, 0x05, 0xA0, 0x03, 0x99, 0x05, 0x93, 0x04, 0xE3, 0x04, 0xB2, 0x06, 0x98, 0x04, 0xD8, 0x20,
+    0xC7, 0x05, 0x90, 0x03, 0xA2, 0x05, 0xF8, 0x03, 0xEE, 0x04, 0xCC, 0x05, 0xAC, 0x04, 0x83, 0x18,
+    0xCC, 0x05, 0x86, 0x03, 0xA8, 0x05, 0xEA, 0x03, 0xF4, 0x04, 0xA4, 0x05, 0xB5, 0x04,
+};
+static const uint8_t lorenz_stream_4[476] = {
+    0xA8, 0x08, 0xBC, 0x02, 0x9C, 0x06, 0xC2, 0x02, 0xE2, 0x06, 0xC4, 0x02, 0xDB, 0x0B, 0xBC, 0x02,
+    0xAD, 0x53, 0xBE, 0x02, 0xB2, 0x06, 0xC4, 0x02, 0xA5, 0x07, 0xC4, 0x02, 0xFF, 0x10, 0xC5, 0x02,
+    0x9A, 0x11, 0xC4, 0x02, 0xA5, 0x1A, 0xBC, 0x02, 0x97, 0x06, 0xC2, 0x02, 0xD5, 0x06, 0xC4, 0x02,
+    0xFC, 0x08, 0xC1, 0x02, 0xAC, 0x2B, 0xBB, 0x02, 0x93, 0x06, 0xC1, 0x02, 0xCA, 0x06, 0xC4, 0x02,
+    0x98, 0x08, 0xC3, 0x02, 0xFC, 0x1A, 0xC1, 0x02, 0xD8, 0x2B, 0xB6, 0x02, 0xFF, 0x05, 0xBD, 0x02,
+    0x9F, 0x06, 0xC2, 0x02, 0xE7, 0x06, 0xC5, 0x02, 0xA8, 0x12, 0xA8, 0x02, 0xEA, 0x05, 0xB2, 0x02,
+    0xF3, 0x05, 0xB8, 0x02, 0x85, 0x06, 0xBF, 0x02, 0xAB, 0x06, 0xC2, 0x02, 0x8D, 0x07, 0xC4, 0x02,
+    0xDA, 0x10, 0xC4, 0x02, 0x95, 0x08, 0xC3, 0x02, 0xD2, 0x1A, 0xC1, 0x02, 0x96, 0x22, 0xC5, 0x02,
+    0xEB, 0x13, 0x89, 0x02, 0xEB, 0x05, 0x97, 0x02, 0xE7, 0x05, 0xA1, 0x02, 0xE6, 0x05, 0xAA, 0x02,
+    0xE9, 0x05, 0xB2, 0x02, 0xF2, 0x05, 0xB8, 0x02, 0x84, 0x06, 0xBE, 0x02, 0xA8, 0x06, 0xC2, 0x02,
+    0x83, 0x07, 0xC5, 0x02, 0xDF, 0x10, 0xC3, 0x02, 0x92, 0x07, 0xC4, 0x02, 0xDD, 0x10, 0xC4, 0x02,
+    0x86, 0x0A, 0xBF, 0x02, 0xCC, 0x3C, 0xAE, 0x02, 0xEE, 0x05, 0xB7, 0x02, 0xFD, 0x05, 0xBC, 0x02,
+    0x9A, 0x06, 0xC1, 0x02, 0xDB, 0x06, 0xC4, 0x02, 0xCA, 0x09, 0xBF, 0x02, 0x9A, 0x33, 0xC0, 0x02,
+    0xBA, 0x06, 0xC3, 0x02, 0xC6, 0x07, 0xC4, 0x02, 0x90, 0x13, 0xBF, 0x02, 0xFF, 0x32, 0xC3, 0x02,
+    0xD8, 0x19, 0xC3, 0x02, 0xC2, 0x07, 0xC4, 0x02, 0xC6, 0x12, 0xC1, 0x02, 0xCF, 0x2A, 0xC4, 0x02,
+    0xBD, 0x11, 0xC3, 0x02, 0xEF, 0x19, 0xC4, 0x02, 0xDF, 0x11, 0xC2, 0x02, 0xF6, 0x22, 0xBB, 0x02,
+    0x97, 0x06, 0xC1, 0x02, 0xD4, 0x06, 0xC4, 0x02, 0xE9, 0x08, 0xC1, 0x02, 0xAD, 0x23, 0xC1, 0x02,
+    0xD5, 0x2F, 0xE1, 0x01, 0x84, 0x06, 0xF4, 0x01, 0xF9, 0x05, 0x82, 0x02, 0xF0, 0x05, 0x8E, 0x02,
+    0xEA, 0x05, 0x99, 0x02, 0xE7, 0x05, 0xA3, 0x02, 0xE7, 0x05, 0xAC, 0x02, 0xEA, 0x05, 0xB4, 0x02,
+    0xF4, 0x05, 0xBB, 0x02, 0x89, 0x06, 0xC0, 0x02, 0xB6, 0x06, 0xC3, 0x02, 0xB4, 0x07, 0xC4, 0x02,
+    0xBC, 0x11, 0xC3, 0x02, 0xEA, 0x19, 0xC4, 0x02, 0xA8, 0x11, 0xC4, 0x02, 0xD6, 0x19, 0xC4, 0x02,
+    0xD2, 0x07, 0xC4, 0x02, 0xDA, 0x1A, 0xB6, 0x02, 0xFD, 0x05, 0xBD, 0x02, 0x9A, 0x06, 0xC2, 0x02,
+    0xDD, 0x06, 0xC4, 0x02, 0xF6, 0x09, 0xBF, 0x02, 0xAD, 0x33, 0xC2, 0x02, 0xE1, 0x22, 0xBE, 0x02,
+    0xA7, 0x06, 0xC2, 0x02, 0x81, 0x07, 0xC5, 0x02, 0xE1, 0x10, 0xC3, 0x02, 0xFE, 0x06, 0xC5, 0x02,
+    0xE6, 0x10, 0xC2, 0x02, 0xE8, 0x06, 0xC4, 0x02, 0x9E, 0x12, 0xAA, 0x02, 0xEB, 0x05, 0xB3, 0x02,
+    0xF5, 0x05, 0xBA, 0x02, 0x89, 0x06, 0xC0, 0x02, 0xB4, 0x06, 0xC4, 0x02, 0xAE, 0x07, 0xC5, 0x02,
+    0xA3, 0x11, 0xC3, 0x02, 0xE7, 0x19, 0xC2, 0x02, 0xF1, 0x06, 0xC5, 0x02, 0x9C, 0x11, 0xBB, 0x02,
+    0x94, 0x06, 0xC1, 0x02, 0xCD, 0x06, 0xC4, 0x02, 0xAB, 0x08, 0xC3, 0x02, 0x85, 0x23, 0xBA, 0x02,
+    0x8E, 0x06, 0xC0, 0x02, 0xBD, 0x06, 0xC4, 0x02, 0xD4, 0x07, 0xC4, 0x02, 0xBC, 0x1A, 0xB9, 0x02,
+    0x8A, 0x06, 0xBF, 0x02, 0xB6, 0x06, 0xC4, 0x02, 0xB3, 0x07, 0xC4, 0x02,
+};
+static const uint8_t lorenz_stream_5[398] = {
+    0xE4, 0x01, 0xB0, 0x2D, 0xD0, 0x02, 0xB2, 0x05, 0xD1, 0x02, 0xB4, 0x05, 0xD6, 0x02, 0xBA, 0x05,
+    0xDB, 0x02, 0xC4, 0x05, 0xDD, 0x02, 0xD6, 0x05, 0xE0, 0x02, 0xF5, 0x05, 0xE1, 0x02, 0xB5, 0x06,
+    0xDF, 0x02, 0xBE, 0x08, 0xD6, 0x02, 0x89, 0x22, 0xDC, 0x02, 0xD7, 0x10, 0xDD, 0x02, 0xC0, 0x10,
+    0xDF, 0x02, 0xE9, 0x08, 0xD4, 0x02, 0x81, 0x2B, 0xE1, 0x02, 0xF7, 0x05, 0xE1, 0x02, 0xBB, 0x06,
+    0xDF, 0x02, 0xF2, 0x08, 0xD4, 0x02, 0xC0, 0x2A, 0xE1, 0x02, 0xD8, 0x06, 0xDE, 0x02, 0xF2, 0x10,
+    0xE2, 0x02, 0xF8, 0x05, 0xE1, 0x02, 0xBF, 0x06, 0xDF, 0x02, 0xA7, 0x09, 0xD3, 0x02, 0xEC, 0x2C,
+    0xD0, 0x02, 0xED, 0x3A, 0xDA, 0x02, 0xC6, 0x19, 0xE2, 0x02, 0xDE, 0x06, 0xDD, 0x02, 0xD8, 0x10,
+    0xE2, 0x02, 0x9D, 0x06, 0xE0, 0x02, 0xB3, 0x07, 0xDB, 0x02, 0x8F, 0x15, 0xCC, 0x02, 0xF5, 0x52,
+    0xD9, 0x02, 0xE4, 0x19, 0xDA, 0x02, 0xEC, 0x1A, 0xDE, 0x02, 0xC5, 0x05, 0xDE, 0x02, 0xD9, 0x05,
+    0xE0, 0x02, 0xFA, 0x05, 0xE1, 0x02, 0xC2, 0x06, 0xDF, 0x02, 0xF7, 0x09, 0xD1, 0x02, 0xEB, 0x3B,
+    0xE0, 0x02, 0xD5, 0x05, 0xE0, 0x02, 0xF5, 0x05, 0xE1, 0x02, 0xB4, 0x06, 0xDF, 0x02, 0xB4, 0x08,
+    0xD6, 0x02, 0xFB, 0x21, 0xDF, 0x02, 0xC5, 0x11, 0xDE, 0x02, 0xCB, 0x05, 0xDF, 0x02, 0xE1, 0x05,
+    0xE1, 0x02, 0x8B, 0x06, 0xE1, 0x02, 0xF1, 0x06, 0xDD, 0x02, 0xBE, 0x10, 0xE1, 0x02, 0xDF, 0x07,
+    0xD9, 0x02, 0xB9, 0x19, 0xDF, 0x02, 0x8B, 0x11, 0xE2, 0x02, 0xE4, 0x05, 0xE0, 0x02, 0x91, 0x06,
+    0xE1, 0x02, 0x83, 0x07, 0xDD, 0x02, 0xD0, 0x10, 0xDE, 0x02, 0xC0, 0x10, 0xE1, 0x02, 0x81, 0x07,
+    0xDD, 0x02, 0xCD, 0x10, 0xDE, 0x02, 0xCC, 0x10, 0xE2, 0x02, 0xB9, 0x06, 0xE0, 0x02, 0xEA, 0x08,
+    0xD4, 0x02, 0xF3, 0x2A, 0xE2, 0x02, 0x82, 0x06, 0xE1, 0x02, 0xD9, 0x06, 0xDE, 0x02, 0xEE, 0x10,
+    0xE2, 0x02, 0xFC, 0x05, 0xE1, 0x02, 0xC8, 0x06, 0xDF, 0x02, 0xB5, 0x0D, 0xCA, 0x02, 0x8C, 0x6A,
+    0xDE, 0x02, 0xBF, 0x10, 0xE2, 0x02, 0x85, 0x07, 0xDC, 0x02, 0xD4, 0x10, 0xDD, 0x02, 0xBE, 0x10,
+    0xE0, 0x02, 0xDB, 0x07, 0xD9, 0x02, 0xB7, 0x19, 0xDF, 0x02, 0xAE, 0x09, 0xD3, 0x02, 0x80, 0x34,
+    0xDF, 0x02, 0xC9, 0x05, 0xDF, 0x02, 0xDE, 0x05, 0xE1, 0x02, 0x85, 0x06, 0xE1, 0x02, 0xE2, 0x06,
+    0xDE, 0x02, 0xCD, 0x10, 0xE2, 0x02, 0xB7, 0x06, 0xDF, 0x02, 0xCD, 0x08, 0xD6, 0x02, 0xCC, 0x22,
+    0xD7, 0x02, 0x9E, 0x1A, 0xD7, 0x02, 0x8E, 0x1C, 0xD0, 0x02, 0xCB, 0x3A, 0xDD, 0x02, 0xBE, 0x10,
+    0xE0, 0x02, 0x84, 0x08, 0xD8, 0x02, 0xF2, 0x1A, 0xD4, 0x02, 0xCA, 0x2A, 0xE2, 0x02, 0xBC, 0x06,
+    0xDF, 0x02, 0xFE, 0x08, 0xD4, 0x02, 0xA5, 0x2A, 0xE0, 0x02, 0x86, 0x09, 0xD4, 0x02,
+};
+static const uint8_t lorenz_stream_6[806] = {
+    0x36, 0x9C, 0x05, 0xA2, 0x02, 0xF7, 0x05, 0x82, 0x03, 0xC7, 0x05, 0xFC, 0x03, 0x9C, 0x05, 0xB3,
+    0x09, 0xD7, 0x1D, 0x40, 0x97, 0x07, 0xC6, 0x01, 0xBA, 0x06, 0x9D, 0x02, 0xFF, 0x05, 0xF3, 0x02,
+    0xCE, 0x05, 0xE4, 0x03, 0xA2, 0x05, 0x9A, 0x06, 0x96, 0x05, 0xC6, 0x02, 0xE2, 0x05, 0xAE, 0x03,
+    0xB4, 0x05, 0xD6, 0x04, 0x8E, 0x05, 0xCB, 0x04, 0x8F, 0x05, 0xDD, 0x04, 0x8D, 0x05, 0xB8, 0x04,
+    0x91, 0x05, 0x8F, 0x05, 0x8B, 0x05, 0xE6, 0x03, 0xA0, 0x05, 0xC7, 0x06, 0x9F, 0x05, 0x97, 0x02,
+    0xFE, 0x05, 0xF7, 0x02, 0xCC, 0x05, 0xEA, 0x03, 0xA0, 0x05, 0xC7, 0x06, 0x9E, 0x05, 0x98, 0x02,
+    0xFD, 0x05, 0xF8, 0x02, 0xCB, 0x05, 0xEC, 0x03, 0xA0, 0x05, 0xD1, 0x06, 0xA1, 0x05, 0x8D, 0x02,
+    0x84, 0x06, 0xEB, 0x02, 0xD2, 0x05, 0xD8, 0x03, 0xA6, 0x05, 0xDB, 0x05, 0x8E, 0x05, 0x8A, 0x03,
+    0xC0, 0x05, 0x94, 0x04, 0x97, 0x05, 0xC3, 0x06, 0x9E, 0x05, 0x9B, 0x02, 0xFB, 0x05, 0xFB, 0x02,
+    0xCA, 0x05, 0xF1, 0x03, 0x9E, 0x05, 0x89, 0x07, 0xB2, 0x05, 0xCE, 0x01, 0xAE, 0x06, 0xAE, 0x02,
+    0xF4, 0x05, 0x87, 0x03, 0xC4, 0x05, 0x85, 0x04, 0x9A, 0x05, 0x88, 0x08, 0xC9, 0x0D, 0x8C, 0x01,
+    0xE4, 0x06, 0xEF, 0x01, 0x9D, 0x06, 0xC3, 0x02, 0xE8, 0x05, 0xA1, 0x03, 0xB9, 0x05, 0xB6, 0x04,
+    0x91, 0x05, 0x9D, 0x05, 0x8C, 0x05, 0xD2, 0x03, 0xA6, 0x05, 0xD8, 0x05, 0x8E, 0x05, 0x8D, 0x03,
+    0xBF, 0x05, 0x9B, 0x04, 0x96, 0x05, 0x8D, 0x06, 0x94, 0x05, 0xD3, 0x02, 0xDB, 0x05, 0xBF, 0x03,
+    0xAE, 0x05, 0x82, 0x05, 0x8B, 0x05, 0xFC, 0x03, 0x9B, 0x05, 0xDD, 0x09, 0xB5, 0x25, 0x85, 0x01,
+    0xE9, 0x06, 0xEA, 0x01, 0xA1, 0x06, 0xBE, 0x02, 0xEA, 0x05, 0x9B, 0x03, 0xBC, 0x05, 0xAA, 0x04,
+    0x93, 0x05, 0xC7, 0x05, 0x8D, 0x05, 0x9F, 0x03, 0xB7, 0x05, 0xBE, 0x04, 0x91, 0x05, 0x86, 0x05,
+    0x8B, 0x05, 0xF3, 0x03, 0x9D, 0x05, 0xD9, 0x07, 0xE9, 0x05, 0x3F, 0x90, 0x07, 0xD0, 0x01, 0xB3,
+    0x06, 0xA7, 0x02, 0xF8, 0x05, 0xFF, 0x02, 0xC8, 0x05, 0xF6, 0x03, 0x9D, 0x05, 0xDC, 0x07, 0xEC,
+    0x05, 0x38, 0x94, 0x07, 0xCE, 0x01, 0xB4, 0x06, 0xA5, 0x02, 0xFA, 0x05, 0xFC, 0x02, 0xC9, 0x05,
+    0xF2, 0x03, 0x9E, 0x05, 0x9A, 0x07, 0xB9, 0x05, 0xB8, 0x01, 0xBE, 0x06, 0x9B, 0x02, 0x80, 0x06,
+    0xF2, 0x02, 0xCE, 0x05, 0xE2, 0x03, 0xA3, 0x05, 0x8F, 0x06, 0x94, 0x05, 0xD2, 0x02, 0xDB, 0x05,
+    0xBE, 0x03, 0xAE, 0x05, 0xFD, 0x04, 0x8B, 0x05, 0x85, 0x04, 0x99, 0x05, 0xC1, 0x07, 0xD0, 0x05,
+    0x7A, 0xE9, 0x06, 0xED, 0x01, 0x9F, 0x06, 0xC2, 0x02, 0xE8, 0x05, 0xA0, 0x03, 0xB9, 0x05, 0xB4,
+    0x04, 0x92, 0x05, 0xA4, 0x05, 0x8B, 0x05, 0xCA, 0x03, 0xA8, 0x05, 0xB5, 0x05, 0x8B, 0x05, 0xB7,
+    0x03, 0xAF, 0x05, 0xF9, 0x04, 0x8B, 0x05, 0x8B, 0x04, 0x98, 0x05, 0xEF, 0x06, 0xA9, 0x05, 0xEC,
+    0x01, 0x9A, 0x06, 0xCA, 0x02, 0xE3, 0x05, 0xAA, 0x03, 0xB6, 0x05, 0xCA, 0x04, 0x8F, 0x05, 0xE5,
+    0x04, 0x8D, 0x05, 0xA8, 0x04, 0x93, 0x05, 0xC4, 0x05, 0x8C, 0x05, 0xA3, 0x03, 0xB6, 0x05, 0xC8,
+    0x04, 0x8F, 0x05, 0xEC, 0x04, 0x8C, 0x05, 0x9D, 0x04, 0x95, 0x05, 0xF1, 0x05, 0x91, 0x05, 0xF0,
+    0x02, 0xCC, 0x05, 0xEA, 0x03, 0xA1, 0x05, 0xC8, 0x06, 0x9F, 0x05, 0x96, 0x02, 0xFF, 0x05, 0xF5,
+    0x02, 0xCC, 0x05, 0xE8, 0x03, 0xA1, 0x05, 0xB3, 0x06, 0x9A, 0x05, 0xAD, 0x02, 0xF0, 0x05, 0x90,
+    0x03, 0xC0, 0x05, 0x94, 0x04, 0x97, 0x05, 0xBD, 0x06, 0x9C, 0x05, 0xA2, 0x02, 0xF7, 0x05, 0x83,
+    0x03, 0xC6, 0x05, 0xFE, 0x03, 0x9C, 0x05, 0x9F, 0x0B, 0xFA, 0x3C, 0xA1, 0x01, 0xD5, 0x06, 0xFF,
+    0x01, 0x93, 0x06, 0xD2, 0x02, 0xDF, 0x05, 0xB6, 0x03, 0xB1, 0x05, 0xE7, 0x04, 0x8D, 0x05, 0xA8,
+    0x04, 0x93, 0x05, 0xC2, 0x05, 0x8C, 0x05, 0xA5, 0x03, 0xB5, 0x05, 0xCD, 0x04, 0x8F, 0x05, 0xE0,
+    0x04, 0x8D, 0x05, 0xB1, 0x04, 0x92, 0x05, 0xA5, 0x05, 0x8B, 0x05, 0xC8, 0x03, 0xA9, 0x05, 0xAF,
+    0x05, 0x8C, 0x05, 0xBD, 0x03, 0xAD, 0x05, 0x8C, 0x05, 0x8B, 0x05, 0xED, 0x03, 0x9F, 0x05, 0x8F,
+    0x07, 0xB6, 0x05, 0xC4, 0x01, 0xB5, 0x06, 0xA6, 0x02, 0xF9, 0x05, 0xFE, 0x02, 0xC8, 0x05, 0xF6,
+    0x03, 0x9D, 0x05, 0xC8, 0x07, 0xD6, 0x05, 0x6C, 0xF2, 0x06, 0xE6, 0x01, 0xA4, 0x06, 0xBA, 0x02,
+    0xED, 0x05, 0x96, 0x03, 0xBD, 0x05, 0xA1, 0x04, 0x94, 0x05, 0xF4, 0x05, 0x90, 0x05, 0xEE, 0x02,
+    0xCD, 0x05, 0xE7, 0x03, 0xA1, 0x05, 0xAB, 0x06, 0x99, 0x05, 0xB5, 0x02, 0xEB, 0x05, 0x9A, 0x03,
+    0xBC, 0x05, 0xA7, 0x04, 0x94, 0x05, 0xD3, 0x05, 0x8D, 0x05, 0x92, 0x03, 0xBD, 0x05, 0xA4, 0x04,
+    0x94, 0x05, 0xE2, 0x05, 0x8E, 0x05, 0x81, 0x03, 0xC5, 0x05, 0x85, 0x04, 0x9A, 0x05, 0xFC, 0x07,
+    0xC3, 0x0D, 0x9F, 0x01, 0xD7, 0x06, 0xFC, 0x01, 0x94, 0x06, 0xD2, 0x02, 0xDF, 0x05, 0xB4, 0x03,
+    0xB1, 0x05, 0xE2, 0x04, 0x8D, 0x05, 0xB3, 0x04, 0x92, 0x05, 0x9C, 0x05, 0x8B, 0x05, 0xD4, 0x03,
+    0xA6, 0x05, 0xDC, 0x05, 0x8E, 0x05, 0x88, 0x03, 0xC1, 0x05, 0x93, 0x04, 0x97, 0x05, 0xCE, 0x06,
+    0xA1, 0x05, 0x8F, 0x02, 0x82, 0x06, 0xEE, 0x02, 0xD1, 0x05, 0xDC, 0x03, 0xA4, 0x05, 0xF1, 0x05,
+    0x90, 0x05, 0xF2, 0x02, 0xCB, 0x05, 0xED, 0x03, 0xA0, 0x05, 0xDE, 0x06, 0xA4, 0x05, 0xFF, 0x01,
+    0x8D, 0x06, 0xDD, 0x02, 0xD9, 0x05, 0xC4, 0x03, 0xAC, 0x05, 0x8E, 0x05, 0x8B, 0x05, 0xEA, 0x03,
+    0x9F, 0x05, 0xE7, 0x06, 0xA7, 0x05, 0xF5, 0x01, 0x94, 0x06, 0xD3, 0x02, 0xDE, 0x05, 0xB6, 0x03,
+    0xB1, 0x05, 0xE8, 0x04, 0x8C, 0x05,
+};
+static const uint8_t lorenz_stream_7[476] = {
+    0xA1, 0x07, 0xE2, 0x02, 0xFB, 0x05, 0xE1, 0x02, 0xC7, 0x06, 0xDF, 0x02, 0xCB, 0x0B, 0xCD, 0x02,
+    0x89, 0x53, 0xE3, 0x02, 0x93, 0x06, 0xE1, 0x02, 0x8D, 0x07, 0xDC, 0x02, 0xE7, 0x10, 0xDC, 0x02,
+    0x85, 0x11, 0xDA, 0x02, 0x81, 0x1A, 0xE2, 0x02, 0xF6, 0x05, 0xE1, 0x02, 0xBA, 0x06, 0xDF, 0x02,
+    0xE8, 0x08, 0xD5, 0x02, 0x88, 0x2B, 0xE1, 0x02, 0xF2, 0x05, 0xE0, 0x02, 0xAE, 0x06, 0xE0, 0x02,
+    0x83, 0x08, 0xD8, 0x02, 0xE8, 0x1A, 0xD5, 0x02, 0xB1, 0x2B, 0xE0, 0x02, 0xDB, 0x05, 0xE0, 0x02,
+    0xFE, 0x05, 0xE1, 0x02, 0xCD, 0x06, 0xDE, 0x02, 0xFC, 0x11, 0xDB, 0x02, 0xBE, 0x05, 0xDC, 0x02,
+    0xCB, 0x05, 0xDF, 0x02, 0xE1, 0x05, 0xE1, 0x02, 0x8C, 0x06, 0xE1, 0x02, 0xF2, 0x06, 0xDE, 0x02,
+    0xBE, 0x10, 0xE0, 0x02, 0x80, 0x08, 0xD8, 0x02, 0xBD, 0x1A, 0xD6, 0x02, 0xFB, 0x21, 0xDF, 0x02,
+    0xB5, 0x13, 0xCC, 0x02, 0xB2, 0x05, 0xCE, 0x02, 0xB3, 0x05, 0xD3, 0x02, 0xB6, 0x05, 0xD8, 0x02,
+    0xBD, 0x05, 0xDC, 0x02, 0xCA, 0x05, 0xDF, 0x02, 0xE0, 0x05, 0xE0, 0x02, 0x89, 0x06, 0xE1, 0x02,
+    0xE9, 0x06, 0xDE, 0x02, 0xC0, 0x10, 0xE2, 0x02, 0xF9, 0x06, 0xDD, 0x02, 0xC1, 0x10, 0xE0, 0x02,
+    0xF5, 0x09, 0xD1, 0x02, 0xA0, 0x3C, 0xDE, 0x02, 0xC5, 0x05, 0xDE, 0x02, 0xD8, 0x05, 0xE0, 0x02,
+    0xF9, 0x05, 0xE1, 0x02, 0xBF, 0x06, 0xDF, 0x02, 0xB7, 0x09, 0xD3, 0x02, 0xF8, 0x32, 0xE2, 0x02,
+    0x9C, 0x06, 0xE0, 0x02, 0xAE, 0x07, 0xDB, 0x02, 0xFF, 0x12, 0xD2, 0x02, 0xE7, 0x32, 0xDA, 0x02,
+    0xBA, 0x19, 0xE1, 0x02, 0xAB, 0x07, 0xDB, 0x02, 0xB3, 0x12, 0xD4, 0x02, 0xB7, 0x2A, 0xDC, 0x02,
+    0xA8, 0x11, 0xD8, 0x02, 0xD7, 0x19, 0xDB, 0x02, 0xCB, 0x11, 0xD7, 0x02, 0xD1, 0x22, 0xE2, 0x02,
+    0xF6, 0x05, 0xE1, 0x02, 0xB8, 0x06, 0xDF, 0x02, 0xD5, 0x08, 0xD5, 0x02, 0x99, 0x23, 0xD5, 0x02,
+    0x92, 0x2F, 0xB9, 0x02, 0xBA, 0x05, 0xBA, 0x02, 0xB6, 0x05, 0xC2, 0x02, 0xB3, 0x05, 0xC9, 0x02,
+    0xB2, 0x05, 0xCF, 0x02, 0xB3, 0x05, 0xD4, 0x02, 0xB8, 0x05, 0xD9, 0x02, 0xC0, 0x05, 0xDC, 0x02,
+    0xCF, 0x05, 0xDF, 0x02, 0xE7, 0x05, 0xE1, 0x02, 0x98, 0x06, 0xE0, 0x02, 0x9C, 0x07, 0xDB, 0x02,
+    0xA7, 0x11, 0xD8, 0x02, 0xD3, 0x19, 0xDB, 0x02, 0x93, 0x11, 0xD9, 0x02, 0xBA, 0x19, 0xE1, 0x02,
+    0xBB, 0x07, 0xDA, 0x02, 0xB4, 0x1A, 0xE0, 0x02, 0xD8, 0x05, 0xE1, 0x02, 0xF9, 0x05, 0xE1, 0x02,
+    0xC2, 0x06, 0xDF, 0x02, 0xE4, 0x09, 0xD2, 0x02, 0x97, 0x33, 0xD7, 0x02, 0xBE, 0x22, 0xE2, 0x02,
+    0x88, 0x06, 0xE1, 0x02, 0xE7, 0x06, 0xDD, 0x02, 0xC3, 0x10, 0xE2, 0x02, 0xE5, 0x06, 0xDD, 0x02,
+    0xC7, 0x10, 0xE2, 0x02, 0xCD, 0x06, 0xDF, 0x02, 0xF2, 0x11, 0xDC, 0x02, 0xC0, 0x05, 0xDC, 0x02,
+    0xCE, 0x05, 0xDF, 0x02, 0xE7, 0x05, 0xE1, 0x02, 0x96, 0x06, 0xE1, 0x02, 0x96, 0x07, 0xDC, 0x02,
+    0x8D, 0x11, 0xDA, 0x02, 0xC8, 0x19, 0xE1, 0x02, 0xD7, 0x06, 0xDE, 0x02, 0xF8, 0x10, 0xE2, 0x02,
+    0xF3, 0x05, 0xE1, 0x02, 0xB0, 0x06, 0xE0, 0x02, 0x96, 0x08, 0xD8, 0x02, 0xE0, 0x22, 0xE1, 0x02,
+    0xEC, 0x05, 0xE1, 0x02, 0xA0, 0x06, 0xE0, 0x02, 0xBD, 0x07, 0xDB, 0x02, 0x96, 0x1A, 0xE1, 0x02,
+    0xE8, 0x05, 0xE0, 0x02, 0x98, 0x06, 0xE1, 0x02, 0x9C, 0x07, 0xDB, 0x02,
+};
+static const uint8_t lorenz_stream_8[875] = {
+    0x78, 0xCF, 0x02, 0xD4, 0x05, 0xBA, 0x02, 0x9F, 0x06, 0xC1, 0x02, 0xE2, 0x06, 0xC8, 0x02, 0xD4,
+    0x0B, 0xD5, 0x02, 0x9A, 0x05, 0x85, 0x02, 0xF5, 0x05, 0x91, 0x02, 0xF1, 0x05, 0x9D, 0x02, 0xF0,
+    0x05, 0xA7, 0x02, 0xF4, 0x05, 0xB1, 0x02, 0xFF, 0x05, 0xB9, 0x02, 0x99, 0x06, 0xC0, 0x02, 0xD1,
+    0x06, 0xC7, 0x02, 0xCE, 0x08, 0xCF, 0x02, 0xE2, 0x05, 0xBD, 0x02, 0xB4, 0x06, 0xC4, 0x02, 0xA3,
+    0x07, 0xCB, 0x02, 0x90, 0x07, 0xCA, 0x02, 0x9F, 0x07, 0xCB, 0x02, 0xFF, 0x06, 0xCA, 0x02, 0xCB,
+    0x07, 0xCC, 0x02, 0xBF, 0x06, 0xC7, 0x02, 0xF8, 0x08, 0xCF, 0x02, 0xD1, 0x05, 0xB9, 0x02, 0x9A,
+    0x06, 0xC1, 0x02, 0xD5, 0x06, 0xC7, 0x02, 0xF7, 0x08, 0xD0, 0x02, 0xD1, 0x05, 0xB9, 0x02, 0x9A,
+    0x06, 0xC1, 0x02, 0xD6, 0x06, 0xC7, 0x02, 0x81, 0x09, 0xD0, 0x02, 0xCD, 0x05, 0xB8, 0x02, 0x96,
+    0x06, 0xBF, 0x02, 0xCB, 0x06, 0xC6, 0x02, 0x95, 0x08, 0xCE, 0x02, 0x83, 0x06, 0xC2, 0x02, 0xF2,
+    0x06, 0xC9, 0x02, 0xF0, 0x08, 0xD0, 0x02, 0xD2, 0x05, 0xB9, 0x02, 0x9C, 0x06, 0xC1, 0x02, 0xDA,
+    0x06, 0xC7, 0x02, 0xB5, 0x09, 0xD0, 0x02, 0xBE, 0x05, 0xB2, 0x02, 0x83, 0x06, 0xBB, 0x02, 0xA0,
+    0x06, 0xC2, 0x02, 0xE7, 0x06, 0xC8, 0x02, 0xAE, 0x0A, 0xD3, 0x02, 0xA5, 0x05, 0xA2, 0x02, 0xF2,
+    0x05, 0xAB, 0x02, 0xF8, 0x05, 0xB5, 0x02, 0x88, 0x06, 0xBD, 0x02, 0xAC, 0x06, 0xC3, 0x02, 0x8B,
+    0x07, 0xCA, 0x02, 0xD7, 0x07, 0xCC, 0x02, 0xB2, 0x06, 0xC6, 0x02, 0x92, 0x08, 0xCE, 0x02, 0x85,
+    0x06, 0xC3, 0x02, 0xF7, 0x06, 0xC9, 0x02, 0xBE, 0x08, 0xCF, 0x02, 0xE8, 0x05, 0xBE, 0x02, 0xBC,
+    0x06, 0xC5, 0x02, 0xC7, 0x07, 0xCC, 0x02, 0xD0, 0x06, 0xC8, 0x02, 0xFD, 0x0B, 0xD6, 0x02, 0x98,
+    0x05, 0xFD, 0x01, 0xFA, 0x05, 0x89, 0x02, 0xF4, 0x05, 0x95, 0x02, 0xF1, 0x05, 0xA1, 0x02, 0xF1,
+    0x05, 0xAB, 0x02, 0xF7, 0x05, 0xB4, 0x02, 0x88, 0x06, 0xBC, 0x02, 0xA9, 0x06, 0xC3, 0x02, 0x82,
+    0x07, 0xCA, 0x02, 0xFD, 0x07, 0xCD, 0x02, 0x90, 0x06, 0xC4, 0x02, 0x90, 0x07, 0xCA, 0x02, 0xC3,
+    0x07, 0xCC, 0x02, 0xC8, 0x06, 0xC8, 0x02, 0x81, 0x0A, 0xD2, 0x02, 0xAD, 0x05, 0xA9, 0x02, 0xF5,
+    0x05, 0xB1, 0x02, 0x82, 0x06, 0xBA, 0x02, 0x9D, 0x06, 0xC1, 0x02, 0xDD, 0x06, 0xC8, 0x02, 0x83,
+    0x0A, 0xD2, 0x02, 0xAC, 0x05, 0xA8, 0x02, 0xF5, 0x05, 0xB2, 0x02, 0x81, 0x06, 0xB9, 0x02, 0x9C,
+    0x06, 0xC1, 0x02, 0xDB, 0x06, 0xC7, 0x02, 0xC5, 0x09, 0xD1, 0x02, 0xB9, 0x05, 0xB0, 0x02, 0x80,
+    0x06, 0xB9, 0x02, 0x98, 0x06, 0xC0, 0x02, 0xD0, 0x06, 0xC7, 0x02, 0xC4, 0x08, 0xCF, 0x02, 0xE7,
+    0x05, 0xBE, 0x02, 0xBB, 0x06, 0xC5, 0x02, 0xC3, 0x07, 0xCC, 0x02, 0xD6, 0x06, 0xC8, 0x02, 0xE9,
+    0x09, 0xD2, 0x02, 0xB1, 0x05, 0xAB, 0x02, 0xF8, 0x05, 0xB5, 0x02, 0x88, 0x06, 0xBC, 0x02, 0xAC,
+    0x06, 0xC3, 0x02, 0x8A, 0x07, 0xCA, 0x02, 0xDD, 0x07, 0xCC, 0x02, 0xAC, 0x06, 0xC6, 0x02, 0xF2,
+    0x07, 0xCD, 0x02, 0x9F, 0x06, 0xC5, 0x02, 0xBF, 0x07, 0xCC, 0x02, 0xDB, 0x06, 0xC9, 0x02, 0x9A,
+    0x09, 0xD0, 0x02, 0xC4, 0x05, 0xB5, 0x02, 0x8B, 0x06, 0xBD, 0x02, 0xB1, 0x06, 0xC4, 0x02, 0x9A,
+    0x07, 0xCB, 0x02, 0xA5, 0x07, 0xCC, 0x02, 0xF2, 0x06, 0xCA, 0x02, 0xF9, 0x07, 0xCD, 0x02, 0x93,
+    0x06, 0xC4, 0x02, 0x99, 0x07, 0xCA, 0x02, 0xAB, 0x07, 0xCB, 0x02, 0xEA, 0x06, 0xC9, 0x02, 0xA4,
+    0x08, 0xCE, 0x02, 0xF6, 0x05, 0xC1, 0x02, 0xD6, 0x06, 0xC7, 0x02, 0xF8, 0x08, 0xD0, 0x02, 0xD0,
+    0x05, 0xB9, 0x02, 0x9A, 0x06, 0xC0, 0x02, 0xD4, 0x06, 0xC7, 0x02, 0xE4, 0x08, 0xCF, 0x02, 0xD9,
+    0x05, 0xBB, 0x02, 0xA4, 0x06, 0xC2, 0x02, 0xF2, 0x06, 0xC9, 0x02, 0xEA, 0x08, 0xD0, 0x02, 0xD4,
+    0x05, 0xBA, 0x02, 0x9F, 0x06, 0xC2, 0x02, 0xE2, 0x06, 0xC8, 0x02, 0xBD, 0x0D, 0xD9, 0x02, 0x9F,
+    0x05, 0xCE, 0x01, 0x99, 0x06, 0xE1, 0x01, 0x8B, 0x06, 0xF1, 0x01, 0x80, 0x06, 0x80, 0x02, 0xF7,
+    0x05, 0x8D, 0x02, 0xF2, 0x05, 0x99, 0x02, 0xF0, 0x05, 0xA3, 0x02, 0xF2, 0x05, 0xAE, 0x02, 0xFA,
+    0x05, 0xB6, 0x02, 0x8D, 0x06, 0xBE, 0x02, 0xB7, 0x06, 0xC5, 0x02, 0xB1, 0x07, 0xCB, 0x02, 0xF3,
+    0x06, 0xCA, 0x02, 0xF8, 0x07, 0xCD, 0x02, 0x94, 0x06, 0xC4, 0x02, 0x9C, 0x07, 0xCA, 0x02, 0xA2,
+    0x07, 0xCB, 0x02, 0xFA, 0x06, 0xC9, 0x02, 0xDE, 0x07, 0xCD, 0x02, 0xAB, 0x06, 0xC6, 0x02, 0xED,
+    0x07, 0xCD, 0x02, 0xA3, 0x06, 0xC6, 0x02, 0xCF, 0x07, 0xCC, 0x02, 0xC5, 0x06, 0xC8, 0x02, 0xBB,
+    0x09, 0xD1, 0x02, 0xBB, 0x05, 0xB2, 0x02, 0x82, 0x06, 0xB9, 0x02, 0x9D, 0x06, 0xC1, 0x02, 0xDD,
+    0x06, 0xC7, 0x02, 0xF1, 0x09, 0xD2, 0x02, 0xB0, 0x05, 0xAA, 0x02, 0xF8, 0x05, 0xB3, 0x02, 0x86,
+    0x06, 0xBC, 0x02, 0xA7, 0x06, 0xC3, 0x02, 0xFA, 0x06, 0xCA, 0x02, 0xA5, 0x08, 0xCF, 0x02, 0xF4,
+    0x05, 0xC1, 0x02, 0xD3, 0x06, 0xC7, 0x02, 0xDD, 0x08, 0xCF, 0x02, 0xDB, 0x05, 0xBC, 0x02, 0xA9,
+    0x06, 0xC3, 0x02, 0x80, 0x07, 0xC9, 0x02, 0x88, 0x08, 0xCD, 0x02, 0x89, 0x06, 0xC2, 0x02, 0xFE,
+    0x06, 0xC9, 0x02, 0x96, 0x08, 0xCE, 0x02, 0xFE, 0x05, 0xC2, 0x02, 0xE7, 0x06, 0xC9, 0x02, 0xA2,
+    0x0A, 0xD2, 0x02, 0xA8, 0x05, 0xA3, 0x02, 0xF2, 0x05, 0xAD, 0x02, 0xFB, 0x05, 0xB5, 0x02, 0x8D,
+    0x06, 0xBE, 0x02, 0xB6, 0x06, 0xC4, 0x02, 0xAD, 0x07, 0xCB, 0x02, 0xFC, 0x06, 0xCA, 0x02, 0xD6,
+    0x07, 0xCC, 0x02, 0xB3, 0x06, 0xC6, 0x02, 0x96, 0x08, 0xCD, 0x02, 0x83, 0x06, 0xC2, 0x02, 0xF1,
+    0x06, 0xC9, 0x02, 0xFB, 0x08, 0xCF, 0x02, 0xCF, 0x05, 0xB8, 0x02, 0x97, 0x06, 0xC0, 0x02, 0xCD,
+    0x06, 0xC6, 0x02, 0xA8, 0x08, 0xCE, 0x02, 0xF7, 0x05, 0xC1, 0x02, 0xD7, 0x06, 0xC7, 0x02, 0x8D,
+    0x09, 0xD0, 0x02, 0xC9, 0x05, 0xB7, 0x02, 0x91, 0x06, 0xBE, 0x02, 0xBE, 0x06, 0xC6, 0x02, 0xD1,
+    0x07, 0xCD, 0x02, 0xC2, 0x06, 0xC7, 0x02, 0x95, 0x09, 0xD0, 0x02, 0xC7, 0x05, 0xB5, 0x02, 0x8E,
+    0x06, 0xBE, 0x02, 0xB7, 0x06, 0xC4, 0x02, 0xB2, 0x07, 0xCB, 0x02,
+};
+static const uint8_t lorenz_stream_9[126] = {
+    0xEC, 0x22, 0xC2, 0x05, 0x96, 0x4B, 0xD3, 0x01, 0xEF, 0x54, 0x9C, 0x02, 0xAC, 0x23, 0x9B, 0x02,
+    0xAC, 0x23, 0xAB, 0x02, 0xF2, 0x3F, 0x97, 0x02, 0xAF, 0x23, 0xF3, 0x02, 0xCB, 0x2B, 0x8A, 0x04,
+    0xAB, 0x6C, 0xBC, 0x01, 0x8C, 0x2E, 0xED, 0x05, 0xF5, 0x83, 0x01, 0xD4, 0x03, 0xBA, 0x33, 0xD5,
+    0x03, 0xB7, 0x33, 0x88, 0x03, 0xB5, 0x2B, 0xBF, 0x01, 0x8D, 0x2E, 0xB8, 0x03, 0x83, 0x6E, 0xD2,
+    0x02, 0xAB, 0x70, 0x7B, 0xB0, 0x1B, 0x9E, 0x02, 0xAC, 0x23, 0xFD, 0x01, 0xE6, 0x23, 0x8C, 0x02,
+    0xBC, 0x23, 0xB8, 0x07, 0xD2, 0xDF, 0x01, 0xFC, 0x02, 0xB8, 0x2B, 0xC0, 0x03, 0x99, 0x34, 0x82,
+    0x01, 0xAF, 0x1B, 0xF0, 0x01, 0x96, 0x41, 0x44, 0xD7, 0x1B, 0xFC, 0x03, 0x89, 0x5A, 0x04, 0x8D,
+    0x1C, 0xA6, 0x02, 0xBA, 0x23, 0x77, 0xB2, 0x1B, 0xBB, 0x02, 0x9A, 0x36, 0xC8, 0x02,
+};
+
+static const uint8_t rossler_stream_0[560] = {
+    0x84, 0x03, 0xA4, 0x06, 0x86, 0x09, 0xE5, 0x04, 0xDC, 0x08, 0xB6, 0x05, 0xDD, 0x09, 0xA4, 0x06,
+    0xFF, 0x08, 0xD5, 0x04, 0xBE, 0x08, 0xF6, 0x04, 0x8C, 0x0A, 0x9E, 0x06, 0x8D, 0x09, 0xFD, 0x04,
+    0xF1, 0x08, 0xF9, 0x05, 0xAB, 0x09, 0xDB, 0x05, 0x80, 0x09, 0xD8, 0x05, 0x80, 0x09, 0xE0, 0x05,
+    0x80, 0x09, 0xCA, 0x05, 0x81, 0x09, 0xFE, 0x05, 0xFD, 0x08, 0x89, 0x05, 0xF6, 0x08, 0x8E, 0x06,
+    0x9B, 0x09, 0xA9, 0x05, 0xFF, 0x08, 0xA6, 0x06, 0x80, 0x09, 0xD7, 0x04, 0xC4, 0x08, 0x80, 0x05,
+    0x85, 0x0A, 0xA0, 0x06, 0x8B, 0x09, 0xF4, 0x04, 0xEB, 0x08, 0xE4, 0x05, 0xBB, 0x09, 0x80, 0x06,
+    0xFE, 0x08, 0x84, 0x05, 0xF5, 0x08, 0x88, 0x06, 0xA0, 0x09, 0xB9, 0x05, 0x80, 0x09, 0x9B, 0x06,
+    0xFC, 0x08, 0xDC, 0x04, 0xCE, 0x08, 0x94, 0x05, 0xF6, 0x09, 0xA5, 0x06, 0x85, 0x09, 0xE4, 0x04,
+    0xD9, 0x08, 0xB2, 0x05, 0xE0, 0x09, 0xA6, 0x06, 0xFF, 0x08, 0xD6, 0x04, 0xC0, 0x08, 0xF8, 0x04,
+    0x8A, 0x0A, 0x9F, 0x06, 0x8D, 0x09, 0xFA, 0x04, 0xEF, 0x08, 0xF3, 0x05, 0xB0, 0x09, 0xE7, 0x05,
+    0xFF, 0x08, 0xBB, 0x05, 0x80, 0x09, 0x99, 0x06, 0xFD, 0x08, 0xDD, 0x04, 0xD1, 0x08, 0x9A, 0x05,
+    0xF1, 0x09, 0xA6, 0x06, 0x84, 0x09, 0xDF, 0x04, 0xD4, 0x08, 0xA1, 0x05, 0xEC, 0x09, 0xA7, 0x06,
+    0x82, 0x09, 0xDB, 0x04, 0xCD, 0x08, 0x91, 0x05, 0xF8, 0x09, 0xA4, 0x06, 0x87, 0x09, 0xE5, 0x04,
+    0xDC, 0x08, 0xB8, 0x05, 0xDC, 0x09, 0xA4, 0x06, 0xFE, 0x08, 0xD5, 0x04, 0xBE, 0x08, 0xF6, 0x04,
+    0x8C, 0x0A, 0x9D, 0x06, 0x8E, 0x09, 0xFD, 0x04, 0xF2, 0x08, 0xF9, 0x05, 0xAB, 0x09, 0xDA, 0x05,
+    0x80, 0x09, 0xDA, 0x05, 0x80, 0x09, 0xD9, 0x05, 0x80, 0x09, 0xDB, 0x05, 0x81, 0x09, 0xD6, 0x05,
+    0x81, 0x09, 0xE1, 0x05, 0xFF, 0x08, 0xC8, 0x05, 0x81, 0x09, 0x82, 0x06, 0xFE, 0x08, 0x81, 0x05,
+    0xF3, 0x08, 0x82, 0x06, 0xA5, 0x09, 0xC7, 0x05, 0x80, 0x09, 0x84, 0x06, 0xFD, 0x08, 0xFE, 0x04,
+    0xF2, 0x08, 0xFA, 0x05, 0xAA, 0x09, 0xD8, 0x05, 0x80, 0x09, 0xDF, 0x05, 0x80, 0x09, 0xCD, 0x05,
+    0x80, 0x09, 0xF9, 0x05, 0xFE, 0x08, 0x93, 0x05, 0xFB, 0x08, 0x9C, 0x06, 0x8F, 0x09, 0x80, 0x05,
+    0xF4, 0x08, 0x81, 0x06, 0xA5, 0x09, 0xC9, 0x05, 0x81, 0x09, 0x80, 0x06, 0xFE, 0x08, 0x83, 0x05,
+    0xF5, 0x08, 0x87, 0x06, 0xA1, 0x09, 0xBB, 0x05, 0x80, 0x09, 0x99, 0x06, 0xFC, 0x08, 0xDE, 0x04,
+    0xD1, 0x08, 0x9D, 0x05, 0xF0, 0x09, 0xA6, 0x06, 0x83, 0x09, 0xDE, 0x04, 0xD1, 0x08, 0x9D, 0x05,
+    0xF0, 0x09, 0xA6, 0x06, 0x83, 0x09, 0xDE, 0x04, 0xD2, 0x08, 0x9D, 0x05, 0xEF, 0x09, 0xA6, 0x06,
+    0x84, 0x09, 0xDD, 0x04, 0xD1, 0x08, 0x9C, 0x05, 0xF0, 0x09, 0xA6, 0x06, 0x84, 0x09, 0xDE, 0x04,
+    0xD3, 0x08, 0x9F, 0x05, 0xEE, 0x09, 0xA6, 0x06, 0x83, 0x09, 0xDC, 0x04, 0xCF, 0x08, 0x97, 0x05,
+    0xF4, 0x09, 0xA5, 0x06, 0x85, 0x09, 0xE2, 0x04, 0xD7, 0x08, 0xAB, 0x05, 0xE5, 0x09, 0xA6, 0x06,
+    0x81, 0x09, 0xD7, 0x04, 0xC4, 0x08, 0x81, 0x05, 0x84, 0x0A, 0xA0, 0x06, 0x8B, 0x09, 0xF3, 0x04,
+    0xEA, 0x08, 0xE3, 0x05, 0xBC, 0x09, 0x84, 0x06, 0xFD, 0x08, 0xFE, 0x04, 0xF2, 0x08, 0xFC, 0x05,
+    0xA9, 0x09, 0xD5, 0x05, 0x80, 0x09, 0xE5, 0x05, 0x80, 0x09, 0xBF, 0x05, 0x81, 0x09, 0x91, 0x06,
+    0xFD, 0x08, 0xE8, 0x04, 0xE0, 0x08, 0xC2, 0x05, 0xD4, 0x09, 0xA0, 0x06, 0xFE, 0x08, 0xD6, 0x04,
+    0xC2, 0x08, 0xFC, 0x04, 0x87, 0x0A, 0xA0, 0x06, 0x8C, 0x09, 0xF7, 0x04, 0xED, 0x08, 0xEC, 0x05,
+    0xB5, 0x09, 0xF4, 0x05, 0xFF, 0x08, 0x9C, 0x05, 0xFD, 0x08, 0xA3, 0x06, 0x88, 0x09, 0xE9, 0x04,
+    0xE0, 0x08, 0xC4, 0x05, 0xD3, 0x09, 0x9F, 0x06, 0xFD, 0x08, 0xD7, 0x04, 0xC4, 0x08, 0xFF, 0x04,
+    0x86, 0x0A, 0xA0, 0x06, 0x8B, 0x09, 0xF4, 0x04, 0xEB, 0x08, 0xE5, 0x05, 0xBA, 0x09, 0x80, 0x06,
+};
+static const uint8_t rossler_stream_1[456] = {
+    0xB0, 0x04, 0xE1, 0x03, 0xFB, 0x0A, 0xD6, 0x03, 0xB8, 0x19, 0x88, 0x04, 0xDD, 0x0A, 0xCE, 0x03,
+    0xAB, 0x19, 0xB8, 0x03, 0x97, 0x0B, 0xE3, 0x03, 0xB6, 0x0B, 0xFA, 0x01, 0x92, 0x0C, 0x8E, 0x04,
+    0xCC, 0x0A, 0x8C, 0x04, 0xCE, 0x0A, 0x8F, 0x04, 0xCC, 0x0A, 0x87, 0x04, 0xD1, 0x0A, 0x98, 0x04,
+    0xC9, 0x0A, 0xE9, 0x03, 0x8F, 0x0B, 0xEC, 0x02, 0xCA, 0x0B, 0xF9, 0x03, 0xE3, 0x0A, 0xFE, 0x03,
+    0xE5, 0x0A, 0xCF, 0x03, 0xAD, 0x19, 0xC7, 0x03, 0x8D, 0x0B, 0xDF, 0x03, 0xBE, 0x19, 0x99, 0x04,
+    0xC9, 0x0A, 0xE7, 0x03, 0x99, 0x0B, 0xCC, 0x02, 0xDF, 0x0B, 0x80, 0x04, 0xD8, 0x0A, 0x97, 0x04,
+    0xD0, 0x0A, 0xD2, 0x03, 0xB1, 0x19, 0xE3, 0x03, 0xFA, 0x0A, 0xD5, 0x03, 0xB7, 0x19, 0x84, 0x04,
+    0xE1, 0x0A, 0xCE, 0x03, 0xAC, 0x19, 0xBC, 0x03, 0x94, 0x0B, 0xE2, 0x03, 0xC4, 0x0B, 0xD2, 0x01,
+    0xAB, 0x0C, 0x91, 0x04, 0xCB, 0x0A, 0x80, 0x04, 0xD8, 0x0A, 0x97, 0x04, 0xD0, 0x0A, 0xD2, 0x03,
+    0xB3, 0x19, 0xEB, 0x03, 0xF3, 0x0A, 0xD4, 0x03, 0xB4, 0x19, 0xF3, 0x03, 0xEE, 0x0A, 0xD1, 0x03,
+    0xB1, 0x19, 0xE0, 0x03, 0xFB, 0x0A, 0xD7, 0x03, 0xB7, 0x19, 0x8A, 0x04, 0xDD, 0x0A, 0xCD, 0x03,
+    0xAB, 0x19, 0xB8, 0x03, 0x97, 0x0B, 0xE3, 0x03, 0xB4, 0x0B, 0xFE, 0x01, 0x90, 0x0C, 0x8D, 0x04,
+    0xCD, 0x0A, 0x8D, 0x04, 0xCD, 0x0A, 0x8D, 0x04, 0xCD, 0x0A, 0x8E, 0x04, 0xCC, 0x0A, 0x8C, 0x04,
+    0xCE, 0x0A, 0x90, 0x04, 0xCB, 0x0A, 0x86, 0x04, 0xD2, 0x0A, 0x99, 0x04, 0xC9, 0x0A, 0xE5, 0x03,
+    0xA4, 0x0B, 0xAE, 0x02, 0xF2, 0x0B, 0x86, 0x04, 0xD2, 0x0A, 0x99, 0x04, 0xC9, 0x0A, 0xE4, 0x03,
+    0xB2, 0x0B, 0x84, 0x02, 0x8C, 0x0C, 0x8C, 0x04, 0xCE, 0x0A, 0x8F, 0x04, 0xCB, 0x0A, 0x88, 0x04,
+    0xD1, 0x0A, 0x97, 0x04, 0xC9, 0x0A, 0xEE, 0x03, 0xFB, 0x0A, 0xB1, 0x03, 0x9B, 0x0B, 0xE6, 0x03,
+    0xA4, 0x0B, 0xAA, 0x02, 0xF5, 0x0B, 0x86, 0x04, 0xD2, 0x0A, 0x98, 0x04, 0xCA, 0x0A, 0xE6, 0x03,
+    0x9B, 0x0B, 0xC9, 0x02, 0xE1, 0x0B, 0x80, 0x04, 0xD8, 0x0A, 0x97, 0x04, 0xCF, 0x0A, 0xD3, 0x03,
+    0xB3, 0x19, 0xEE, 0x03, 0xF1, 0x0A, 0xD3, 0x03, 0xB3, 0x19, 0xEE, 0x03, 0xF1, 0x0A, 0xD3, 0x03,
+    0xB3, 0x19, 0xEF, 0x03, 0xF1, 0x0A, 0xD2, 0x03, 0xB3, 0x19, 0xED, 0x03, 0xF2, 0x0A, 0xD3, 0x03,
+    0xB3, 0x19, 0xF1, 0x03, 0xF0, 0x0A, 0xD2, 0x03, 0xB1, 0x19, 0xE7, 0x03, 0xF7, 0x0A, 0xD5, 0x03,
+    0xB5, 0x19, 0xFE, 0x03, 0xE5, 0x0A, 0xD0, 0x03, 0xAD, 0x19, 0xC8, 0x03, 0x8C, 0x0B, 0xDE, 0x03,
+    0xBE, 0x19, 0x99, 0x04, 0xCA, 0x0A, 0xE4, 0x03, 0xB0, 0x0B, 0x8A, 0x02, 0x88, 0x0C, 0x8C, 0x04,
+    0xCD, 0x0A, 0x91, 0x04, 0xCB, 0x0A, 0x83, 0x04, 0xD5, 0x0A, 0x99, 0x04, 0xCD, 0x0A, 0xD8, 0x03,
+    0xB9, 0x19, 0x92, 0x04, 0xD5, 0x0A, 0xCF, 0x03, 0xAC, 0x19, 0xC2, 0x03, 0x90, 0x0B, 0xE0, 0x03,
+    0xDE, 0x0B, 0x93, 0x01, 0xCF, 0x0C, 0x96, 0x04, 0xC9, 0x0A, 0xF3, 0x03, 0xEE, 0x0A, 0xDA, 0x03,
+    0x80, 0x0B, 0xD9, 0x03, 0xB9, 0x19, 0x93, 0x04, 0xD4, 0x0A, 0xCF, 0x03, 0xAD, 0x19, 0xC7, 0x03,
+    0x8D, 0x0B, 0xDF, 0x03, 0xBE, 0x19, 0x99, 0x04,
+};
+static const uint8_t rossler_stream_2[307] = {
+    0xF3, 0x13, 0xC1, 0x02, 0xAF, 0x29, 0xC0, 0x02, 0x92, 0x29, 0xC0, 0x02, 0x87, 0x1B, 0x9F, 0x02,
+    0xB9, 0x0C, 0xA2, 0x02, 0xBD, 0x0C, 0x9A, 0x02, 0xB6, 0x0C, 0xAA, 0x02, 0xCE, 0x0C, 0xF3, 0x01,
+    0xB8, 0x0C, 0xBE, 0x02, 0xFA, 0x1A, 0xB8, 0x02, 0xEF, 0x1A, 0xC1, 0x02, 0x97, 0x29, 0xC0, 0x02,
+    0x9B, 0x1B, 0xEF, 0x01, 0xB9, 0x0C, 0xC0, 0x02, 0xFD, 0x1A, 0xB2, 0x02, 0x80, 0x0D, 0x81, 0x01,
+    0xEF, 0x0C, 0xC1, 0x02, 0xA1, 0x29, 0xC1, 0x02, 0xAC, 0x29, 0xC1, 0x02, 0x93, 0x29, 0xC0, 0x02,
+    0x8C, 0x1B, 0x94, 0x02, 0xB4, 0x0C, 0xB2, 0x02, 0xFA, 0x0C, 0x8E, 0x01, 0xE8, 0x0C, 0xC1, 0x02,
+    0xA3, 0x29, 0xC1, 0x02, 0xA7, 0x29, 0xC0, 0x02, 0xA0, 0x29, 0xC1, 0x02, 0xAF, 0x29, 0xC0, 0x02,
+    0x92, 0x29, 0xC0, 0x02, 0x87, 0x1B, 0xA0, 0x02, 0xBA, 0x0C, 0x9F, 0x02, 0xBA, 0x0C, 0xA1, 0x02,
+    0xBA, 0x0C, 0x9F, 0x02, 0xB9, 0x0C, 0xA2, 0x02, 0xBD, 0x0C, 0x9A, 0x02, 0xB5, 0x0C, 0xAC, 0x02,
+    0xD0, 0x0C, 0xEC, 0x01, 0xBB, 0x0C, 0xBF, 0x02, 0x81, 0x1B, 0xAC, 0x02, 0xD2, 0x0C, 0xE7, 0x01,
+    0xBD, 0x0C, 0xBF, 0x02, 0x86, 0x1B, 0xA2, 0x02, 0xBC, 0x0C, 0x9B, 0x02, 0xB7, 0x0C, 0xA9, 0x02,
+    0xC9, 0x0C, 0xFD, 0x01, 0xB5, 0x0C, 0xBD, 0x02, 0xF3, 0x1A, 0xBF, 0x02, 0x81, 0x1B, 0xAB, 0x02,
+    0xD0, 0x0C, 0xEE, 0x01, 0xBA, 0x0C, 0xBF, 0x02, 0xFE, 0x1A, 0xB1, 0x02, 0xF9, 0x0C, 0x91, 0x01,
+    0xE7, 0x0C, 0xC1, 0x02, 0xA4, 0x29, 0xC1, 0x02, 0xA4, 0x29, 0xC1, 0x02, 0xA4, 0x29, 0xC1, 0x02,
+    0xA4, 0x29, 0xC1, 0x02, 0xA5, 0x29, 0xC1, 0x02, 0xA1, 0x29, 0xC1, 0x02, 0xAA, 0x29, 0xC1, 0x02,
+    0x97, 0x29, 0xC1, 0x02, 0x9E, 0x1B, 0xE7, 0x01, 0xBD, 0x0C, 0xBF, 0x02, 0x85, 0x1B, 0xA3, 0x02,
+    0xBF, 0x0C, 0x96, 0x02, 0xB4, 0x0C, 0xB0, 0x02, 0xE5, 0x0C, 0xBD, 0x01, 0xD0, 0x0C, 0xC1, 0x02,
+    0xB3, 0x29, 0xC0, 0x02, 0x96, 0x29, 0xC0, 0x02, 0x93, 0x1B, 0x83, 0x02, 0xB4, 0x0C, 0xBB, 0x02,
+    0xF1, 0x1A, 0xC0, 0x02, 0xF3, 0x1B, 0x1E, 0xA3, 0x0D, 0xC1, 0x02, 0x97, 0x29, 0xC0, 0x02, 0x9B,
+    0x1B, 0xEF, 0x01,
+};
+static const uint8_t rossler_stream_3[490] = {
+    0x6A, 0x93, 0x0A, 0x91, 0x06, 0xF5, 0x08, 0xC6, 0x01, 0xAE, 0x0C, 0x8F, 0x05, 0xEC, 0x09, 0x98,
+    0x06, 0xBC, 0x16, 0xC4, 0x04, 0xAD, 0x0A, 0x87, 0x06, 0xC7, 0x08, 0xCE, 0x03, 0x83, 0x0B, 0xDB,
+    0x05, 0x80, 0x09, 0xDD, 0x05, 0xFB, 0x08, 0xD8, 0x05, 0x85, 0x09, 0xE4, 0x05, 0xF0, 0x08, 0xC5,
+    0x05, 0xA5, 0x09, 0x81, 0x06, 0xC7, 0x08, 0x8F, 0x04, 0xD5, 0x0A, 0xF3, 0x05, 0xD6, 0x08, 0x82,
+    0x05, 0xF9, 0x09, 0x97, 0x06, 0xC3, 0x16, 0xCF, 0x04, 0xA5, 0x0A, 0x8A, 0x06, 0xCD, 0x08, 0x8A,
+    0x03, 0xB1, 0x0B, 0xC4, 0x05, 0xA8, 0x09, 0x83, 0x06, 0xC7, 0x08, 0xFA, 0x03, 0xE3, 0x0A, 0xEC,
+    0x05, 0xE2, 0x08, 0xA8, 0x05, 0xCF, 0x09, 0x95, 0x06, 0xD2, 0x16, 0xE7, 0x04, 0x91, 0x0A, 0x92,
+    0x06, 0xFE, 0x08, 0xA7, 0x01, 0xC0, 0x0C, 0x89, 0x05, 0xF2, 0x09, 0x98, 0x06, 0xBE, 0x16, 0xC7,
+    0x04, 0xAB, 0x0A, 0x88, 0x06, 0xC8, 0x08, 0xBB, 0x03, 0x90, 0x0B, 0xD5, 0x05, 0x8B, 0x09, 0xEB,
+    0x05, 0xE3, 0x08, 0xAA, 0x05, 0xCD, 0x09, 0x94, 0x06, 0xD6, 0x16, 0xEF, 0x04, 0x8A, 0x0A, 0x94,
+    0x06, 0xDB, 0x16, 0xF7, 0x04, 0x83, 0x0A, 0x95, 0x06, 0xD0, 0x16, 0xE4, 0x04, 0x94, 0x0A, 0x90,
+    0x06, 0xF2, 0x08, 0xD0, 0x01, 0xA8, 0x0C, 0x91, 0x05, 0xEA, 0x09, 0x98, 0x06, 0xBC, 0x16, 0xC3,
+    0x04, 0xAE, 0x0A, 0x87, 0x06, 0xC7, 0x08, 0xCF, 0x03, 0x82, 0x0B, 0xDC, 0x05, 0xFE, 0x08, 0xDC,
+    0x05, 0xFE, 0x08, 0xDC, 0x05, 0xFE, 0x08, 0xDB, 0x05, 0x80, 0x09, 0xDD, 0x05, 0xFB, 0x08, 0xD8,
+    0x05, 0x85, 0x09, 0xE5, 0x05, 0xEE, 0x08, 0xC2, 0x05, 0xAA, 0x09, 0x85, 0x06, 0xC6, 0x08, 0xE9,
+    0x03, 0xF0, 0x0A, 0xE5, 0x05, 0xEE, 0x08, 0xC0, 0x05, 0xAD, 0x09, 0x86, 0x06, 0xC7, 0x08, 0xD2,
+    0x03, 0x80, 0x0B, 0xDD, 0x05, 0xFC, 0x08, 0xD9, 0x05, 0x84, 0x09, 0xE2, 0x05, 0xF2, 0x08, 0xC9,
+    0x05, 0x9F, 0x09, 0xFD, 0x05, 0xCA, 0x08, 0xBE, 0x04, 0xB1, 0x0A, 0x85, 0x06, 0xC7, 0x08, 0xE6,
+    0x03, 0xF2, 0x0A, 0xE4, 0x05, 0xEF, 0x08, 0xC3, 0x05, 0xA9, 0x09, 0x83, 0x06, 0xC6, 0x08, 0xF9,
+    0x03, 0xE5, 0x0A, 0xEB, 0x05, 0xE3, 0x08, 0xAB, 0x05, 0xCB, 0x09, 0x94, 0x06, 0xD8, 0x16, 0xF1,
+    0x04, 0x88, 0x0A, 0x94, 0x06, 0xD8, 0x16, 0xF1, 0x04, 0x88, 0x0A, 0x94, 0x06, 0xD8, 0x16, 0xF2,
+    0x04, 0x88, 0x0A, 0x94, 0x06, 0xD7, 0x16, 0xEF, 0x04, 0x8A, 0x0A, 0x93, 0x06, 0xDA, 0x16, 0xF4,
+    0x04, 0x86, 0x0A, 0x94, 0x06, 0xD4, 0x16, 0xEA, 0x04, 0x8E, 0x0A, 0x93, 0x06, 0x92, 0x09, 0x6F,
+    0xE0, 0x0C, 0x82, 0x05, 0xF9, 0x09, 0x97, 0x06, 0xC4, 0x16, 0xD0, 0x04, 0xA4, 0x0A, 0x8B, 0x06,
+    0xCD, 0x08, 0x83, 0x03, 0xB6, 0x0B, 0xC1, 0x05, 0xAC, 0x09, 0x86, 0x06, 0xC7, 0x08, 0xD6, 0x03,
+    0xFD, 0x0A, 0xDF, 0x05, 0xFA, 0x08, 0xD5, 0x05, 0x89, 0x09, 0xE9, 0x05, 0xE7, 0x08, 0xB4, 0x05,
+    0xBF, 0x09, 0x8F, 0x06, 0xE5, 0x08, 0x84, 0x02, 0x88, 0x0C, 0x9C, 0x05, 0xDE, 0x09, 0x97, 0x06,
+    0xC1, 0x16, 0xCB, 0x04, 0xA8, 0x0A, 0x89, 0x06, 0xCA, 0x08, 0xA4, 0x03, 0xA0, 0x0B, 0xCC, 0x05,
+    0x9A, 0x09, 0xF8, 0x05, 0xCF, 0x08, 0xDE, 0x04, 0x98, 0x0A, 0x8F, 0x06, 0xE2, 0x08, 0x8E, 0x02,
+    0x82, 0x0C, 0x9F, 0x05, 0xDB, 0x09, 0x97, 0x06, 0xC3, 0x16, 0xCF, 0x04, 0xA5, 0x0A, 0x8A, 0x06,
+    0xCD, 0x08, 0x8B, 0x03, 0xB1, 0x0B, 0xC3, 0x05, 0xA8, 0x09,
+};
+static const uint8_t rossler_stream_4[306] = {
+    0x88, 0x0C, 0x90, 0x04, 0xDF, 0x27, 0xA1, 0x04, 0xB3, 0x27, 0xF4, 0x03, 0xD5, 0x19, 0xF6, 0x02,
+    0xE2, 0x0B, 0xFD, 0x02, 0xE2, 0x0B, 0xEC, 0x02, 0xE3, 0x0B, 0x92, 0x03, 0xE8, 0x0B, 0xA7, 0x02,
+    0x80, 0x0C, 0xE8, 0x03, 0xD1, 0x19, 0xC0, 0x03, 0xE6, 0x19, 0x9E, 0x04, 0xBA, 0x27, 0xFF, 0x03,
+    0xE1, 0x19, 0xA1, 0x02, 0x83, 0x0C, 0xEC, 0x03, 0xD1, 0x19, 0xAA, 0x03, 0x91, 0x0C, 0x8E, 0x01,
+    0xD8, 0x0C, 0x99, 0x04, 0xC9, 0x27, 0x90, 0x04, 0xDD, 0x27, 0xA0, 0x04, 0xB5, 0x27, 0xF7, 0x03,
+    0xD7, 0x19, 0xE0, 0x02, 0xE7, 0x0B, 0xA8, 0x03, 0x8B, 0x0C, 0x9E, 0x01, 0xCF, 0x0C, 0x98, 0x04,
+    0xCC, 0x27, 0x96, 0x04, 0xD1, 0x27, 0x9A, 0x04, 0xC7, 0x27, 0x8F, 0x04, 0xE0, 0x27, 0xA2, 0x04,
+    0xB2, 0x27, 0xF4, 0x03, 0xD4, 0x19, 0xF9, 0x02, 0xE1, 0x0B, 0xF8, 0x02, 0xE2, 0x0B, 0xF9, 0x02,
+    0xE2, 0x0B, 0xF6, 0x02, 0xE2, 0x0B, 0xFD, 0x02, 0xE2, 0x0B, 0xEB, 0x02, 0xE3, 0x0B, 0x95, 0x03,
+    0xEA, 0x0B, 0x9C, 0x02, 0x86, 0x0C, 0xF0, 0x03, 0xD2, 0x19, 0x96, 0x03, 0xEB, 0x0B, 0x95, 0x02,
+    0x8A, 0x0C, 0xF4, 0x03, 0xD4, 0x19, 0xFC, 0x02, 0xE2, 0x0B, 0xEE, 0x02, 0xE3, 0x0B, 0x8E, 0x03,
+    0xE6, 0x0B, 0xB7, 0x02, 0xF8, 0x0B, 0xDA, 0x03, 0xD5, 0x19, 0xF0, 0x03, 0xD3, 0x19, 0x93, 0x03,
+    0xEA, 0x0B, 0xA0, 0x02, 0x84, 0x0C, 0xEC, 0x03, 0xD1, 0x19, 0xA8, 0x03, 0x8A, 0x0C, 0xA2, 0x01,
+    0xCD, 0x0C, 0x97, 0x04, 0xCE, 0x27, 0x97, 0x04, 0xCE, 0x27, 0x97, 0x04, 0xCE, 0x27, 0x97, 0x04,
+    0xCE, 0x27, 0x96, 0x04, 0xD0, 0x27, 0x98, 0x04, 0xCA, 0x27, 0x93, 0x04, 0xD8, 0x27, 0x9E, 0x04,
+    0xBB, 0x27, 0xFF, 0x03, 0xE4, 0x19, 0x96, 0x02, 0x89, 0x0C, 0xF3, 0x03, 0xD4, 0x19, 0x80, 0x03,
+    0xE2, 0x0B, 0xE4, 0x02, 0xE5, 0x0B, 0xA1, 0x03, 0xF8, 0x0B, 0xDC, 0x01, 0xAB, 0x0C, 0x8C, 0x04,
+    0xE8, 0x27, 0x9F, 0x04, 0xB7, 0x27, 0xFB, 0x03, 0xDC, 0x19, 0xC2, 0x02, 0xF2, 0x0B, 0xD0, 0x03,
+    0xDB, 0x19, 0x8A, 0x04, 0xEA, 0x27, 0x9F, 0x04, 0xB9, 0x27, 0xFE, 0x03, 0xE2, 0x19, 0xA1, 0x02,
+    0x83, 0x0C,
+};
+static const uint8_t rossler_stream_5[542] = {
+    0x94, 0x07, 0xB8, 0x06, 0xAA, 0x09, 0xFD, 0x01, 0x80, 0x0B, 0xE0, 0x05, 0xC1, 0x09, 0xB3, 0x06,
+    0xEF, 0x15, 0xAB, 0x05, 0xE8, 0x09, 0xB4, 0x06, 0x9A, 0x09, 0xA6, 0x03, 0xA0, 0x0A, 0x98, 0x06,
+    0x9E, 0x09, 0xBE, 0x05, 0x9D, 0x09, 0xB8, 0x05, 0x9E, 0x09, 0xC9, 0x05, 0x9A, 0x09, 0x9E, 0x05,
+    0xA7, 0x09, 0xF9, 0x05, 0x98, 0x09, 0xDD, 0x03, 0x82, 0x0A, 0xA8, 0x06, 0x97, 0x09, 0xCF, 0x04,
+    0xC8, 0x09, 0xB6, 0x06, 0xD6, 0x09, 0x3A, 0xE8, 0x0B, 0xB3, 0x05, 0xE2, 0x09, 0xB6, 0x06, 0x9D,
+    0x09, 0xF3, 0x02, 0xBD, 0x0A, 0x87, 0x06, 0xA7, 0x09, 0xFD, 0x05, 0x98, 0x09, 0xCC, 0x03, 0x8B,
+    0x0A, 0xA3, 0x06, 0x99, 0x09, 0xF9, 0x04, 0xB5, 0x09, 0xA3, 0x06, 0xBB, 0x09, 0x97, 0x01, 0xB8,
+    0x0B, 0xC4, 0x05, 0xD5, 0x09, 0xB8, 0x06, 0xAC, 0x09, 0xEF, 0x01, 0x88, 0x0B, 0xDC, 0x05, 0xC5,
+    0x09, 0xB4, 0x06, 0xF2, 0x15, 0xAD, 0x05, 0xE6, 0x09, 0xB5, 0x06, 0x9B, 0x09, 0x97, 0x03, 0xA9,
+    0x0A, 0x93, 0x06, 0xA0, 0x09, 0xD4, 0x05, 0x98, 0x09, 0xFC, 0x04, 0xB4, 0x09, 0xA0, 0x06, 0xB7,
+    0x09, 0xAD, 0x01, 0xAC, 0x0B, 0xCA, 0x05, 0xD1, 0x09, 0xB8, 0x06, 0xB3, 0x09, 0xC2, 0x01, 0xA1,
+    0x0B, 0xCF, 0x05, 0xCD, 0x09, 0xB8, 0x06, 0xBD, 0x09, 0x8F, 0x01, 0xBC, 0x0B, 0xC2, 0x05, 0xD7,
+    0x09, 0xB8, 0x06, 0xA9, 0x09, 0x81, 0x02, 0xFE, 0x0A, 0xE2, 0x05, 0xC0, 0x09, 0xB2, 0x06, 0xEF,
+    0x15, 0xAB, 0x05, 0xE8, 0x09, 0xB4, 0x06, 0x9A, 0x09, 0xA7, 0x03, 0xA0, 0x0A, 0x98, 0x06, 0x9D,
+    0x09, 0xBD, 0x05, 0x9D, 0x09, 0xBD, 0x05, 0x9D, 0x09, 0xBC, 0x05, 0x9E, 0x09, 0xBE, 0x05, 0x9D,
+    0x09, 0xB7, 0x05, 0x9F, 0x09, 0xCA, 0x05, 0x9A, 0x09, 0x9A, 0x05, 0xA8, 0x09, 0xFF, 0x05, 0x99,
+    0x09, 0xBD, 0x03, 0x93, 0x0A, 0x9F, 0x06, 0x9A, 0x09, 0x98, 0x05, 0xA9, 0x09, 0x82, 0x06, 0x9A,
+    0x09, 0xAA, 0x03, 0x9E, 0x0A, 0x99, 0x06, 0x9D, 0x09, 0xB8, 0x05, 0x9F, 0x09, 0xC6, 0x05, 0x9B,
+    0x09, 0xA3, 0x05, 0xA5, 0x09, 0xF1, 0x05, 0x97, 0x09, 0x89, 0x04, 0xEA, 0x09, 0xB3, 0x06, 0x9A,
+    0x09, 0xBA, 0x03, 0x95, 0x0A, 0x9E, 0x06, 0x9B, 0x09, 0x9B, 0x05, 0xA8, 0x09, 0xFC, 0x05, 0x99,
+    0x09, 0xCA, 0x03, 0x8C, 0x0A, 0xA3, 0x06, 0x99, 0x09, 0xFC, 0x04, 0xB4, 0x09, 0xA0, 0x06, 0xB5,
+    0x09, 0xB3, 0x01, 0xA9, 0x0B, 0xCB, 0x05, 0xD1, 0x09, 0xB8, 0x06, 0xB6, 0x09, 0xB2, 0x01, 0xA9,
+    0x0B, 0xCB, 0x05, 0xD0, 0x09, 0xB9, 0x06, 0xB5, 0x09, 0xB4, 0x01, 0xA8, 0x0B, 0xCC, 0x05, 0xD0,
+    0x09, 0xB8, 0x06, 0xB6, 0x09, 0xB0, 0x01, 0xAB, 0x0B, 0xCA, 0x05, 0xD1, 0x09, 0xB8, 0x06, 0xB4,
+    0x09, 0xBB, 0x01, 0xA5, 0x0B, 0xCD, 0x05, 0xCF, 0x09, 0xB8, 0x06, 0xB9, 0x09, 0xA0, 0x01, 0xB3,
+    0x0B, 0xC6, 0x05, 0xD4, 0x09, 0xB8, 0x06, 0xAF, 0x09, 0xDD, 0x01, 0x92, 0x0B, 0xD7, 0x05, 0xC8,
+    0x09, 0xB6, 0x06, 0xD3, 0x09, 0x42, 0xE4, 0x0B, 0xB4, 0x05, 0xE1, 0x09, 0xB6, 0x06, 0x9E, 0x09,
+    0xED, 0x02, 0xC0, 0x0A, 0x85, 0x06, 0xA9, 0x09, 0x81, 0x06, 0x9A, 0x09, 0xAD, 0x03, 0x9C, 0x0A,
+    0x9A, 0x06, 0x9D, 0x09, 0xB4, 0x05, 0xA0, 0x09, 0xCF, 0x05, 0x99, 0x09, 0x89, 0x05, 0xAF, 0x09,
+    0x94, 0x06, 0xA6, 0x09, 0x9C, 0x02, 0xEF, 0x0A, 0xEA, 0x05, 0xBA, 0x09, 0xAC, 0x06, 0xE4, 0x09,
+    0x16, 0xFB, 0x0B, 0xB1, 0x05, 0xE3, 0x09, 0xB6, 0x06, 0x9C, 0x09, 0x85, 0x03, 0xB3, 0x0A, 0x8D,
+    0x06, 0xA3, 0x09, 0xEA, 0x05, 0x97, 0x09, 0xA9, 0x04, 0xDA, 0x09, 0xB7, 0x06, 0xA5, 0x09, 0xA2,
+    0x02, 0xEB, 0x0A, 0xEC, 0x05, 0xBA, 0x09, 0xAA, 0x06, 0xD7, 0x09, 0x38, 0xE9, 0x0B, 0xB3, 0x05,
+    0xE2, 0x09, 0xB6, 0x06, 0x9D, 0x09, 0xF3, 0x02, 0xBD, 0x0A, 0x87, 0x06, 0xA8, 0x09,
+};
+static const uint8_t rossler_stream_6[332] = {
+    0xF5, 0x14, 0xAE, 0x03, 0xE2, 0x1A, 0xF2, 0x01, 0xEE, 0x0B, 0xA8, 0x03, 0xAB, 0x28, 0xB3, 0x03,
+    0x93, 0x1A, 0xAF, 0x03, 0xA9, 0x0B, 0xB1, 0x03, 0xAD, 0x0B, 0xAD, 0x03, 0xA4, 0x0B, 0xB5, 0x03,
+    0xBE, 0x0B, 0x96, 0x03, 0x9B, 0x0B, 0xB4, 0x03, 0x84, 0x1A, 0xB8, 0x03, 0xAF, 0x0C, 0xA7, 0x01,
+    0x98, 0x0C, 0xA9, 0x03, 0xB0, 0x28, 0xB0, 0x03, 0xA4, 0x1A, 0x94, 0x03, 0x9B, 0x0B, 0xB4, 0x03,
+    0x89, 0x1A, 0xB7, 0x03, 0xE1, 0x0B, 0xD3, 0x02, 0xB7, 0x0B, 0xAA, 0x03, 0xB7, 0x28, 0xAC, 0x03,
+    0xEF, 0x1A, 0xD3, 0x01, 0xFF, 0x0B, 0xA9, 0x03, 0xAC, 0x28, 0xB2, 0x03, 0x98, 0x1A, 0xAA, 0x03,
+    0x9F, 0x0B, 0xB7, 0x03, 0xDF, 0x0B, 0xD9, 0x02, 0xB3, 0x0B, 0xAC, 0x03, 0xB9, 0x28, 0xAB, 0x03,
+    0xBC, 0x28, 0xAA, 0x03, 0xB6, 0x28, 0xAD, 0x03, 0xE0, 0x1A, 0xFA, 0x01, 0xE9, 0x0B, 0xA8, 0x03,
+    0xAB, 0x28, 0xB3, 0x03, 0x92, 0x1A, 0xB0, 0x03, 0xAA, 0x0B, 0xB0, 0x03, 0xAA, 0x0B, 0xB0, 0x03,
+    0xAA, 0x0B, 0xB0, 0x03, 0xA9, 0x0B, 0xB1, 0x03, 0xAD, 0x0B, 0xAD, 0x03, 0xA3, 0x0B, 0xB6, 0x03,
+    0xC0, 0x0B, 0x92, 0x03, 0x9B, 0x0B, 0xB4, 0x03, 0x8C, 0x1A, 0xB5, 0x03, 0xC3, 0x0B, 0x8E, 0x03,
+    0x9C, 0x0B, 0xB3, 0x03, 0x92, 0x1A, 0xB1, 0x03, 0xAC, 0x0B, 0xAE, 0x03, 0xA5, 0x0B, 0xB4, 0x03,
+    0xBA, 0x0B, 0x9C, 0x03, 0x9B, 0x0B, 0xB6, 0x03, 0xFA, 0x19, 0xB3, 0x03, 0x8D, 0x1A, 0xB5, 0x03,
+    0xBF, 0x0B, 0x94, 0x03, 0x9B, 0x0B, 0xB4, 0x03, 0x88, 0x1A, 0xB7, 0x03, 0xDE, 0x0B, 0xDB, 0x02,
+    0xB2, 0x0B, 0xAB, 0x03, 0xBA, 0x28, 0xAB, 0x03, 0xBA, 0x28, 0xAC, 0x03, 0xB9, 0x28, 0xAB, 0x03,
+    0xBA, 0x28, 0xAB, 0x03, 0xBB, 0x28, 0xAB, 0x03, 0xB8, 0x28, 0xAC, 0x03, 0x82, 0x1B, 0xA1, 0x01,
+    0x9B, 0x0C, 0xAA, 0x03, 0xAF, 0x28, 0xB1, 0x03, 0xA6, 0x1A, 0x8F, 0x03, 0x9C, 0x0B, 0xB3, 0x03,
+    0x91, 0x1A, 0xB2, 0x03, 0xAE, 0x0B, 0xAC, 0x03, 0xA1, 0x0B, 0xB6, 0x03, 0xD1, 0x0B, 0xF5, 0x02,
+    0xA5, 0x0B, 0xAF, 0x03, 0xCD, 0x1A, 0xAB, 0x02, 0xCD, 0x0B, 0xA9, 0x03, 0xAE, 0x28, 0xB1, 0x03,
+    0x9E, 0x1A, 0xA0, 0x03, 0x9B, 0x0B, 0xB7, 0x03, 0xF4, 0x19, 0xAE, 0x03, 0xCA, 0x1A, 0xB4, 0x02,
+    0xC8, 0x0B, 0xA9, 0x03, 0xAF, 0x28, 0xB1, 0x03, 0xA4, 0x1A, 0x94, 0x03,
+};
+static const uint8_t rossler_stream_7[467] = {
+    0x3D, 0xAE, 0x04, 0xBB, 0x0A, 0xF7, 0x05, 0x8D, 0x17, 0xE0, 0x04, 0x90, 0x0A, 0x80, 0x06, 0xE7,
+    0x16, 0x86, 0x04, 0xDA, 0x0A, 0xEB, 0x05, 0x84, 0x09, 0xF0, 0x02, 0xC3, 0x0B, 0xB9, 0x05, 0xA1,
+    0x09, 0xBB, 0x05, 0x9E, 0x09, 0xB6, 0x05, 0xA6, 0x09, 0xC3, 0x05, 0x93, 0x09, 0x9F, 0x05, 0xC7,
+    0x09, 0xE5, 0x05, 0xFA, 0x08, 0xC4, 0x03, 0x8A, 0x0B, 0xD5, 0x05, 0xFD, 0x08, 0xD1, 0x04, 0x9E,
+    0x0A, 0xFF, 0x05, 0xED, 0x16, 0x93, 0x04, 0xD0, 0x0A, 0xF0, 0x05, 0x98, 0x09, 0x8E, 0x02, 0x82,
+    0x0C, 0x9E, 0x05, 0xC9, 0x09, 0xE7, 0x05, 0xFC, 0x08, 0xAB, 0x03, 0x9B, 0x0B, 0xCC, 0x05, 0x87,
+    0x09, 0xFD, 0x04, 0xF2, 0x09, 0xFC, 0x05, 0xF9, 0x16, 0xB1, 0x04, 0xB9, 0x0A, 0xF8, 0x05, 0x8A,
+    0x17, 0xD9, 0x04, 0x97, 0x0A, 0xFF, 0x05, 0xE9, 0x16, 0x8A, 0x04, 0xD7, 0x0A, 0xEC, 0x05, 0x89,
+    0x09, 0xD6, 0x02, 0xD4, 0x0B, 0xB1, 0x05, 0xAD, 0x09, 0xCB, 0x05, 0x88, 0x09, 0x80, 0x05, 0xEE,
+    0x09, 0xFB, 0x05, 0xFE, 0x16, 0xB9, 0x04, 0xB2, 0x0A, 0xFA, 0x05, 0x81, 0x17, 0xC4, 0x04, 0xA9,
+    0x0A, 0xFD, 0x05, 0xF7, 0x16, 0xAE, 0x04, 0xBC, 0x0A, 0xF7, 0x05, 0x8D, 0x17, 0xE2, 0x04, 0x8F,
+    0x0A, 0xFF, 0x05, 0xE7, 0x16, 0x85, 0x04, 0xDB, 0x0A, 0xEB, 0x05, 0x84, 0x09, 0xF1, 0x02, 0xC2,
+    0x0B, 0xBA, 0x05, 0xA0, 0x09, 0xB9, 0x05, 0xA1, 0x09, 0xBA, 0x05, 0xA0, 0x09, 0xB8, 0x05, 0xA2,
+    0x09, 0xBB, 0x05, 0x9E, 0x09, 0xB5, 0x05, 0xA7, 0x09, 0xC4, 0x05, 0x92, 0x09, 0x9C, 0x05, 0xCB,
+    0x09, 0xE9, 0x05, 0xFF, 0x08, 0x93, 0x03, 0xAB, 0x0B, 0xC5, 0x05, 0x91, 0x09, 0x99, 0x05, 0xCE,
+    0x09, 0xEB, 0x05, 0x83, 0x09, 0xF6, 0x02, 0xBF, 0x0B, 0xBB, 0x05, 0x9E, 0x09, 0xB6, 0x05, 0xA6,
+    0x09, 0xC1, 0x05, 0x95, 0x09, 0xA4, 0x05, 0xC0, 0x09, 0xE0, 0x05, 0xF8, 0x08, 0xFF, 0x03, 0xDF,
+    0x0A, 0xE9, 0x05, 0x80, 0x09, 0x90, 0x03, 0xAD, 0x0B, 0xC4, 0x05, 0x92, 0x09, 0x9D, 0x05, 0xC9,
+    0x09, 0xE8, 0x05, 0xFC, 0x08, 0xA8, 0x03, 0x9E, 0x0B, 0xCB, 0x05, 0x88, 0x09, 0x80, 0x05, 0xEE,
+    0x09, 0xFB, 0x05, 0xFE, 0x16, 0xBD, 0x04, 0xAF, 0x0A, 0xFB, 0x05, 0xFE, 0x16, 0xBC, 0x04, 0xB0,
+    0x0A, 0xFB, 0x05, 0xFE, 0x16, 0xBD, 0x04, 0xAF, 0x0A, 0xFB, 0x05, 0xFE, 0x16, 0xBB, 0x04, 0xB1,
+    0x0A, 0xFA, 0x05, 0x80, 0x17, 0xC0, 0x04, 0xAC, 0x0A, 0xFC, 0x05, 0xFB, 0x16, 0xB4, 0x04, 0xB6,
+    0x0A, 0xF9, 0x05, 0x87, 0x17, 0xD0, 0x04, 0x9E, 0x0A, 0xFF, 0x05, 0xED, 0x16, 0x95, 0x04, 0xCF,
+    0x0A, 0xF0, 0x05, 0x9C, 0x09, 0x81, 0x02, 0x8A, 0x0C, 0x9B, 0x05, 0xCD, 0x09, 0xEA, 0x05, 0x83,
+    0x09, 0xFA, 0x02, 0xBC, 0x0B, 0xBC, 0x05, 0x9D, 0x09, 0xB2, 0x05, 0xAB, 0x09, 0xC8, 0x05, 0x8C,
+    0x09, 0x8C, 0x05, 0xE0, 0x09, 0xF5, 0x05, 0x94, 0x17, 0xF0, 0x04, 0x80, 0x0A, 0xFF, 0x05, 0xEB,
+    0x16, 0x8F, 0x04, 0xD3, 0x0A, 0xEE, 0x05, 0x90, 0x09, 0xB4, 0x02, 0xEA, 0x0B, 0xA7, 0x05, 0xBB,
+    0x09, 0xDB, 0x05, 0xF9, 0x08, 0xA7, 0x04, 0xC1, 0x0A, 0xF5, 0x05, 0x95, 0x17, 0xF3, 0x04, 0xFD,
+    0x09, 0xFF, 0x05, 0xED, 0x16, 0x93, 0x04, 0xD0, 0x0A, 0xF0, 0x05, 0x98, 0x09, 0x8F, 0x02, 0x81,
+    0x0C, 0x9E, 0x05,
+};
+static const uint8_t rossler_stream_8[187] = {
+    0xF2, 0x15, 0xC9, 0x01, 0xA0, 0x2A, 0xCF, 0x01, 0x94, 0x2A, 0xBE, 0x01, 0xCD, 0x48, 0x4E, 0x9D,
+    0x1C, 0xB7, 0x01, 0x94, 0x1C, 0x98, 0x01, 0xE7, 0x1B, 0xCF, 0x01, 0x94, 0x2A, 0xC4, 0x01, 0xC7,
+    0x2A, 0xBA, 0x01, 0xA6, 0x1C, 0x7D, 0xF1, 0x1B, 0xCD, 0x01, 0x97, 0x2A, 0xCB, 0x01, 0x9D, 0x2A,
+    0xD0, 0x01, 0x93, 0x2A, 0xC1, 0x01, 0xFC, 0x2A, 0x7B, 0xF3, 0x1B, 0xCC, 0x01, 0x98, 0x2A, 0xCD,
+    0x01, 0x99, 0x2A, 0xCD, 0x01, 0x97, 0x2A, 0xCA, 0x01, 0xA0, 0x2A, 0xCF, 0x01, 0x94, 0x2A, 0xBE,
+    0x01, 0xD7, 0x74, 0x55, 0x95, 0x1C, 0xBC, 0x01, 0xBB, 0x1C, 0x59, 0x91, 0x1C, 0xBE, 0x01, 0xFA,
+    0x39, 0x42, 0xA9, 0x1C, 0xAF, 0x01, 0xF8, 0x1B, 0xBC, 0x01, 0xBE, 0x1C, 0x53, 0x98, 0x1C, 0xBA,
+    0x01, 0xA7, 0x1C, 0x7A, 0xF4, 0x1B, 0xCC, 0x01, 0x99, 0x2A, 0xCC, 0x01, 0x98, 0x2A, 0xCD, 0x01,
+    0x99, 0x2A, 0xCC, 0x01, 0x99, 0x2A, 0xCC, 0x01, 0x99, 0x2A, 0xCD, 0x01, 0x97, 0x2A, 0xCC, 0x01,
+    0x9B, 0x2A, 0xCF, 0x01, 0x94, 0x2A, 0xC5, 0x01, 0xC2, 0x2A, 0xBF, 0x01, 0xE0, 0x39, 0x6E, 0xFD,
+    0x1B, 0xC8, 0x01, 0xA5, 0x2A, 0xCE, 0x01, 0x94, 0x2A, 0xC3, 0x01, 0xDB, 0x2A, 0xA6, 0x01, 0xEC,
+    0x1B, 0xC9, 0x01, 0xA5, 0x2A, 0xCE, 0x01, 0x95, 0x2A, 0xC4, 0x01,
+};
+static const uint8_t rossler_stream_9[112] = {
+    0xA1, 0x16, 0x6D, 0xF7, 0x2A, 0x7D, 0xF8, 0x2A, 0x49, 0xBA, 0x66, 0x27, 0x85, 0x3A, 0x7B, 0xF4,
+    0x2A, 0x59, 0xBE, 0x2B, 0x37, 0x81, 0x3A, 0x76, 0xF0, 0x2A, 0x6F, 0xF5, 0x2A, 0x7C, 0xF7, 0x2A,
+    0x4E, 0xCF, 0x48, 0x74, 0xF1, 0x2A, 0x73, 0xF2, 0x2A, 0x76, 0xF1, 0x2A, 0x6D, 0xF7, 0x2A, 0x7D,
+    0xF8, 0x2A, 0x49, 0xBA, 0x92, 0x01, 0x3F, 0x9E, 0x3A, 0x48, 0x86, 0x75, 0x3F, 0xA8, 0x3A, 0x38,
+    0x82, 0x3A, 0x74, 0xF1, 0x2A, 0x74, 0xF1, 0x2A, 0x74, 0xF1, 0x2A, 0x74, 0xF1, 0x2A, 0x74, 0xF1,
+    0x2A, 0x75, 0xF1, 0x2A, 0x70, 0xF4, 0x2A, 0x7A, 0xF4, 0x2A, 0x5A, 0xB4, 0x2B, 0x47, 0xB6, 0x57,
+    0x69, 0xFD, 0x2A, 0x7C, 0xF5, 0x2A, 0x54, 0xD5, 0x48, 0x68, 0xFF, 0x2A, 0x7B, 0xF4, 0x2A, 0x59,
+};
+
+static const uint8_t chua_stream_0[111] = {
+    0xB2, 0x3A, 0xD8, 0x2E, 0xD9, 0x39, 0xA2, 0x41, 0xE6, 0x2C, 0xD9, 0x01, 0xC1, 0x0E, 0x95, 0x6A,
+    0xE1, 0x2B, 0xF2, 0x07, 0xC2, 0x1E, 0xF2, 0x42, 0xAA, 0x2D, 0x38, 0x8C, 0x0F, 0xB8, 0x7C, 0xDB,
+    0x2B, 0xC7, 0x0A, 0x91, 0x41, 0x99, 0x41, 0xFF, 0x27, 0xE7, 0x08, 0xCB, 0x1E, 0xFE, 0x06, 0x80,
+    0x0E, 0xE8, 0x04, 0xC0, 0x0D, 0x9F, 0x41, 0xFE, 0x27, 0x9E, 0x41, 0xB1, 0x28, 0xCE, 0x05, 0xB9,
+    0x0D, 0xF3, 0x2E, 0xE8, 0x2B, 0xD8, 0x06, 0xE2, 0x0D, 0xA1, 0x06, 0xCA, 0x0D, 0xC4, 0x08, 0xA9,
+    0x1E, 0xC1, 0x47, 0xAF, 0x29, 0xBD, 0x02, 0x96, 0x0E, 0xB3, 0x57, 0xE6, 0x2B, 0x87, 0x07, 0x8A,
+    0x0E, 0xB9, 0x04, 0xC9, 0x0D, 0x9D, 0x41, 0xB0, 0x3A, 0xF9, 0x40, 0xAF, 0x3B, 0xC4, 0x40,
+};
+static const uint8_t chua_stream_1[171] = {
+    0xC8, 0x01, 0xEE, 0x26, 0xC6, 0x03, 0xDB, 0x0C, 0x96, 0x33, 0xC9, 0x24, 0xF4, 0x04, 0xF4, 0x0B,
+    0xA2, 0x44, 0x93, 0x28, 0xFC, 0x06, 0xFB, 0x0A, 0xF9, 0x6C, 0xDD, 0x18, 0x85, 0x02, 0xDA, 0x0D,
+    0x8C, 0x0B, 0xD3, 0x0A, 0xC7, 0x05, 0xCA, 0x0B, 0xEF, 0x45, 0x92, 0x28, 0xDE, 0x06, 0x86, 0x0B,
+    0x99, 0x7F, 0xCC, 0x18, 0xE0, 0x02, 0x9E, 0x0D, 0x81, 0x0E, 0xAD, 0x2D, 0xAD, 0x04, 0x9C, 0x0C,
+    0xE9, 0x48, 0x99, 0x10, 0xB0, 0x02, 0xBD, 0x0D, 0x82, 0x0C, 0xCD, 0x0B, 0xD8, 0x01, 0xFA, 0x0D,
+    0xA0, 0x0A, 0xB6, 0x0A, 0xC5, 0x08, 0xC4, 0x0A, 0xA6, 0x4A, 0xAC, 0x0E, 0xB5, 0x04, 0x97, 0x0C,
+    0xF8, 0x47, 0x86, 0x12, 0x11, 0xF0, 0x0E, 0x8E, 0x09, 0xB7, 0x0A, 0xFC, 0x31, 0xEF, 0x18, 0xB6,
+    0x01, 0x8E, 0x0E, 0xFF, 0x09, 0xB3, 0x0A, 0xD2, 0x09, 0xB4, 0x0A, 0xDE, 0x0B, 0x91, 0x0B, 0x97,
+    0x03, 0xFB, 0x0C, 0xA9, 0x4D, 0xB4, 0x22, 0x9E, 0x07, 0xEF, 0x0A, 0x9A, 0x5A, 0xE8, 0x18, 0xD2,
+    0x01, 0xFC, 0x0D, 0xA8, 0x0A, 0xB7, 0x0A, 0xA6, 0x08, 0xCA, 0x0A, 0xFE, 0x44, 0x99, 0x26, 0xD8,
+    0x03, 0xD0, 0x0C, 0xB1, 0x44, 0xC0, 0x27, 0x92, 0x04, 0xAC, 0x0C,
+};
+static const uint8_t chua_stream_2[209] = {
+    0xA8, 0x0B, 0xD0, 0x08, 0xD7, 0x08, 0xD6, 0x08, 0xFF, 0x08, 0xCA, 0x08, 0xED, 0x3C, 0xCC, 0x08,
+    0xD7, 0x08, 0xD6, 0x08, 0xBD, 0x09, 0xB4, 0x08, 0xDE, 0x51, 0xD4, 0x08, 0xD7, 0x08, 0xD7, 0x08,
+    0xD6, 0x0A, 0xFF, 0x07, 0xFF, 0x7A, 0xD5, 0x08, 0xDE, 0x08, 0xD5, 0x08, 0xB4, 0x0E, 0xD3, 0x06,
+    0xED, 0x09, 0xA6, 0x08, 0xA0, 0x53, 0xD4, 0x08, 0xD7, 0x08, 0xD7, 0x08, 0xC2, 0x0A, 0x85, 0x08,
+    0xAE, 0x8D, 0x01, 0xD6, 0x08, 0xE9, 0x08, 0xD1, 0x08, 0x9C, 0x12, 0xA2, 0x05, 0xED, 0x08, 0xD7,
+    0x08, 0xD6, 0x08, 0xD7, 0x08, 0xA0, 0x09, 0xBE, 0x08, 0xDA, 0x4E, 0xC4, 0x08, 0xE3, 0x08, 0xD3,
+    0x08, 0xBB, 0x0F, 0xA1, 0x06, 0xE6, 0x08, 0xD5, 0x08, 0xC3, 0x0D, 0xFE, 0x06, 0xFA, 0x0B, 0xC7,
+    0x07, 0x88, 0x4F, 0xB9, 0x08, 0xA3, 0x09, 0xBD, 0x08, 0xDA, 0x4E, 0xC7, 0x08, 0xD7, 0x08, 0xD7,
+    0x08, 0xB6, 0x0C, 0xB0, 0x07, 0x92, 0x40, 0xD5, 0x08, 0xD9, 0x08, 0xD6, 0x08, 0xA2, 0x0D, 0x89,
+    0x07, 0xFB, 0x0C, 0x99, 0x07, 0x94, 0x0F, 0xB2, 0x06, 0xFE, 0x08, 0xCD, 0x08, 0xAC, 0x55, 0xC9,
+    0x08, 0xD7, 0x08, 0xD7, 0x08, 0xEF, 0x0A, 0xF6, 0x07, 0x99, 0x68, 0xD4, 0x08, 0xDB, 0x08, 0xD6,
+    0x08, 0xCB, 0x0D, 0xFA, 0x06, 0xE0, 0x0B, 0xD0, 0x07, 0xEC, 0x4F, 0xCF, 0x08, 0xD7, 0x08, 0xD6,
+    0x08, 0x84, 0x09, 0xC9, 0x08, 0xDE, 0x50, 0xD1, 0x08, 0xD7, 0x08, 0xD7, 0x08, 0x96, 0x09, 0xC2,
+    0x08,
+};
+static const uint8_t chua_stream_3[93] = {
+    0xFC, 0x3D, 0xF4, 0x27, 0xCE, 0x3F, 0xF9, 0x3B, 0x88, 0x42, 0xDD, 0x2B, 0x99, 0x09, 0xE2, 0x1F,
+    0xA6, 0x02, 0xA0, 0x0E, 0x9A, 0x57, 0x9D, 0x2C, 0xE2, 0x03, 0xDC, 0x0D, 0xF6, 0x41, 0xDB, 0x2B,
+    0xA7, 0x0A, 0xC4, 0x41, 0xE5, 0x7C, 0xE0, 0x3A, 0x93, 0x7D, 0xD5, 0x3A, 0xC1, 0x2E, 0xF1, 0x3A,
+    0xD2, 0x42, 0xD1, 0x28, 0xEA, 0x81, 0x01, 0x97, 0x03, 0xC1, 0x09, 0xA2, 0x20, 0xAE, 0x05, 0xB9,
+    0x0D, 0xF0, 0x3F, 0xE4, 0x2B, 0xB1, 0x07, 0xD9, 0x0E, 0xA8, 0x02, 0xA1, 0x0E, 0x9E, 0x58, 0xB3,
+    0x3B, 0xE8, 0x40, 0xD4, 0x28, 0xC3, 0x04, 0xC5, 0x0D, 0x9F, 0x41, 0x99, 0x3A,
+};
+static const uint8_t chua_stream_4[139] = {
+    0x8A, 0x45, 0xDF, 0x0E, 0xF9, 0x03, 0xBB, 0x0C, 0xEE, 0x42, 0xED, 0x27, 0xA4, 0x05, 0xDA, 0x0B,
+    0xF0, 0x44, 0xD3, 0x18, 0xBC, 0x02, 0xB5, 0x0D, 0xB7, 0x0C, 0xB9, 0x1B, 0x95, 0x07, 0xF2, 0x0A,
+    0x8B, 0x5A, 0x9F, 0x28, 0xEF, 0x07, 0xD7, 0x0A, 0xDD, 0x44, 0xCD, 0x18, 0xDB, 0x02, 0xA1, 0x0D,
+    0xDA, 0x0D, 0xE9, 0x2C, 0xCD, 0x06, 0x8D, 0x0B, 0x9E, 0x80, 0x01, 0xE4, 0x26, 0xCF, 0x03, 0xD5,
+    0x0C, 0xF2, 0x80, 0x01, 0xD4, 0x26, 0xC2, 0x03, 0xDE, 0x0C, 0x94, 0x32, 0xFA, 0x26, 0xD6, 0x03,
+    0xD1, 0x0C, 0x87, 0x4D, 0x92, 0x0D, 0xF0, 0x05, 0xB6, 0x0B, 0xD8, 0x91, 0x01, 0xA8, 0x1C, 0xF5,
+    0x08, 0xBB, 0x0A, 0xF1, 0x42, 0xE4, 0x18, 0xE8, 0x01, 0xED, 0x0D, 0xCE, 0x0A, 0xBF, 0x0A, 0x97,
+    0x07, 0xF3, 0x0A, 0xBB, 0x5B, 0xC3, 0x27, 0x9B, 0x04, 0xA7, 0x0C, 0x8D, 0x47, 0xCA, 0x21, 0xAA,
+    0x08, 0xC8, 0x0A, 0x8C, 0x45, 0xF1, 0x25, 0xEC, 0x03, 0xC3, 0x0C,
+};
+static const uint8_t chua_stream_5[425] = {
+    0x3B, 0xC6, 0x0B, 0xA6, 0x03, 0xF6, 0x0C, 0xC0, 0x05, 0xB4, 0x0B, 0xDB, 0x06, 0xCD, 0x0D, 0xF2,
+    0x01, 0xDA, 0x0C, 0xA8, 0x06, 0xEE, 0x0A, 0xA0, 0x08, 0xCC, 0x0A, 0xF4, 0x03, 0xBE, 0x0C, 0xE4,
+    0x05, 0xB6, 0x0B, 0xF9, 0x06, 0x86, 0x0F, 0x89, 0x01, 0x83, 0x0E, 0x8B, 0x05, 0xC8, 0x0B, 0xD0,
+    0x06, 0xFC, 0x0A, 0xD7, 0x08, 0xD9, 0x0B, 0xC8, 0x04, 0xFC, 0x0B, 0x91, 0x06, 0xD1, 0x0B, 0xB4,
+    0x07, 0x8B, 0x0E, 0xFB, 0x03, 0x9B, 0x0C, 0x82, 0x06, 0xF3, 0x0A, 0xE5, 0x07, 0x92, 0x0F, 0xBC,
+    0x05, 0x9F, 0x0B, 0x87, 0x07, 0xB6, 0x0B, 0xEB, 0x08, 0xC1, 0x0B, 0x9B, 0x05, 0xC1, 0x0B, 0xC0,
+    0x06, 0xAA, 0x0C, 0xCD, 0x08, 0xB1, 0x0B, 0x89, 0x07, 0xB0, 0x0E, 0x88, 0x03, 0xE8, 0x0C, 0xCF,
+    0x05, 0x93, 0x0B, 0x9A, 0x07, 0xD8, 0x0B, 0xD5, 0x08, 0xDB, 0x0B, 0xC0, 0x04, 0x83, 0x0C, 0x8C,
+    0x06, 0xCD, 0x0B, 0xAC, 0x07, 0x89, 0x0E, 0x85, 0x04, 0x93, 0x0C, 0x88, 0x06, 0xF1, 0x0A, 0xEE,
+    0x07, 0xC8, 0x11, 0xFC, 0x02, 0x8F, 0x0D, 0xB2, 0x05, 0xA9, 0x0B, 0xF8, 0x06, 0xA0, 0x0B, 0xF0,
+    0x08, 0xBA, 0x0B, 0xAC, 0x05, 0xB9, 0x0B, 0xCC, 0x06, 0xD7, 0x0C, 0xC1, 0x08, 0xE5, 0x0E, 0xD2,
+    0x03, 0xD4, 0x0C, 0xD6, 0x05, 0xB3, 0x0B, 0xED, 0x06, 0xD0, 0x1D, 0xD1, 0x04, 0xF5, 0x0B, 0x9F,
+    0x06, 0xEE, 0x0A, 0x92, 0x08, 0xE6, 0x09, 0xA9, 0x05, 0xBD, 0x0B, 0xC5, 0x06, 0xBB, 0x0C, 0xEB,
+    0x08, 0xB2, 0x0B, 0xBA, 0x06, 0x98, 0x0C, 0xAD, 0x08, 0xEB, 0x0B, 0xE9, 0x07, 0xC7, 0x1D, 0xCD,
+    0x04, 0xF8, 0x0B, 0x9D, 0x06, 0xEE, 0x0A, 0x8E, 0x08, 0xF3, 0x09, 0xE5, 0x05, 0xB2, 0x0B, 0xEE,
+    0x06, 0xDB, 0x1D, 0xD3, 0x04, 0xF4, 0x0B, 0xA1, 0x06, 0xED, 0x0A, 0x95, 0x08, 0xEC, 0x09, 0x85,
+    0x05, 0xD1, 0x0B, 0xB0, 0x06, 0xFE, 0x0B, 0x80, 0x08, 0xAB, 0x0D, 0xD6, 0x02, 0xDB, 0x0C, 0xE1,
+    0x06, 0x8A, 0x0B, 0xE8, 0x08, 0xC5, 0x0B, 0x8E, 0x05, 0xC8, 0x0B, 0xB8, 0x06, 0x92, 0x0C, 0xA3,
+    0x08, 0x85, 0x0C, 0x94, 0x08, 0xB2, 0x0C, 0xE2, 0x08, 0xA6, 0x0B, 0xD3, 0x06, 0xFE, 0x0C, 0xAE,
+    0x04, 0xB6, 0x10, 0xDF, 0x05, 0x84, 0x0B, 0xB3, 0x07, 0x98, 0x0C, 0x96, 0x08, 0x82, 0x0A, 0xD5,
+    0x04, 0xF5, 0x0B, 0x96, 0x06, 0xD5, 0x0B, 0xBD, 0x07, 0x93, 0x0E, 0xE2, 0x03, 0xAC, 0x0C, 0xF6,
+    0x05, 0xF7, 0x0A, 0xD2, 0x07, 0xA7, 0x0D, 0x85, 0x07, 0xB6, 0x0B, 0xE9, 0x08, 0xC5, 0x0B, 0x92,
+    0x05, 0xC5, 0x0B, 0xBB, 0x06, 0x99, 0x0C, 0xAF, 0x08, 0xE5, 0x0B, 0xE1, 0x07, 0xFD, 0x1D, 0xE7,
+    0x04, 0xE4, 0x0B, 0xB1, 0x06, 0xEF, 0x0A, 0xAC, 0x08, 0xA1, 0x0B, 0xB0, 0x03, 0xEF, 0x0C, 0xC4,
+    0x05, 0xB3, 0x0B, 0xDF, 0x06, 0x91, 0x1C, 0xD8, 0x05, 0x8C, 0x0B, 0xA5, 0x07, 0xF2, 0x0B, 0xBD,
+    0x08, 0xDF, 0x0B, 0xC9, 0x03, 0xDC, 0x0C, 0xD0, 0x05, 0xB3, 0x0B, 0xE8, 0x06, 0x9D, 0x1D, 0xD9,
+    0x04, 0xEE, 0x0B, 0xA6, 0x06, 0xEE, 0x0A, 0x9C, 0x08,
+};
+static const uint8_t chua_stream_6[267] = {
+    0xD9, 0x3C, 0xC5, 0x05, 0xDA, 0x06, 0xF1, 0x0A, 0x9B, 0x07, 0x8D, 0x0A, 0xEA, 0x3F, 0xE2, 0x08,
+    0xD4, 0x04, 0xF9, 0x0B, 0x93, 0x06, 0xDD, 0x0A, 0xDB, 0x07, 0xFF, 0x09, 0xA4, 0x42, 0x89, 0x09,
+    0xD7, 0x05, 0x90, 0x0B, 0xEA, 0x06, 0x9E, 0x0A, 0xFD, 0x0B, 0xD8, 0x0A, 0xB6, 0x06, 0xC1, 0x0A,
+    0xD3, 0x08, 0xF4, 0x09, 0xAF, 0x31, 0xAC, 0x02, 0xC5, 0x23, 0xFE, 0x08, 0xA1, 0x05, 0xBC, 0x0B,
+    0xBF, 0x06, 0xB9, 0x0A, 0x86, 0x09, 0xF3, 0x09, 0x92, 0x42, 0x8A, 0x09, 0xDD, 0x05, 0x8B, 0x0B,
+    0xF0, 0x06, 0x9C, 0x0A, 0xED, 0x0C, 0xE3, 0x0B, 0xFA, 0x04, 0xD6, 0x0B, 0xAC, 0x06, 0xC9, 0x0A,
+    0xAD, 0x08, 0xF5, 0x09, 0x86, 0x31, 0xDE, 0x03, 0xDD, 0x47, 0x8B, 0x08, 0x94, 0x04, 0xAF, 0x0C,
+    0xEC, 0x05, 0xFC, 0x0A, 0x8E, 0x07, 0x90, 0x0A, 0xEE, 0x2E, 0xFF, 0x02, 0xE7, 0x24, 0xA9, 0x01,
+    0xA0, 0x25, 0x81, 0x08, 0x91, 0x04, 0xB2, 0x0C, 0xEA, 0x05, 0xFD, 0x0A, 0x8B, 0x07, 0x92, 0x0A,
+    0xD3, 0x2E, 0x99, 0x08, 0x95, 0x04, 0xAD, 0x0C, 0xEE, 0x05, 0xFA, 0x0A, 0x90, 0x07, 0x90, 0x0A,
+    0x82, 0x42, 0x97, 0x05, 0xF1, 0x07, 0xCC, 0x0A, 0xFE, 0x07, 0xFA, 0x09, 0xFB, 0x31, 0x5B, 0x81,
+    0x27, 0xE4, 0x02, 0xEB, 0x23, 0xC3, 0x04, 0xFE, 0x0C, 0xF3, 0x0A, 0xCB, 0x06, 0xB0, 0x0A, 0xD7,
+    0x09, 0xF7, 0x09, 0xAA, 0x40, 0x87, 0x09, 0xCB, 0x05, 0x99, 0x0B, 0xDD, 0x06, 0xA4, 0x0A, 0xE3,
+    0x0A, 0x8F, 0x0A, 0xD4, 0x08, 0xF3, 0x09, 0xD7, 0x31, 0xB6, 0x01, 0x80, 0x25, 0xC9, 0x08, 0xA9,
+    0x04, 0x9B, 0x0C, 0xFB, 0x05, 0xF0, 0x0A, 0xA6, 0x07, 0x8A, 0x0A, 0xB0, 0x40, 0x80, 0x06, 0xD5,
+    0x05, 0xB2, 0x0B, 0xC5, 0x06, 0xB4, 0x0A, 0xA9, 0x09, 0xF4, 0x09, 0x84, 0x41, 0xC8, 0x07, 0xA4,
+    0x04, 0xA7, 0x0C, 0xF2, 0x05, 0xF7, 0x0A, 0x97, 0x07, 0x8E, 0x0A,
+};
+static const uint8_t chua_stream_7[427] = {
+    0x82, 0x14, 0xCE, 0x04, 0xF7, 0x0B, 0x9E, 0x06, 0xED, 0x0A, 0x8F, 0x08, 0xED, 0x09, 0xD6, 0x05,
+    0xB3, 0x0B, 0xE3, 0x06, 0xDD, 0x1C, 0xFF, 0x04, 0xD2, 0x0B, 0xC4, 0x06, 0xF7, 0x0A, 0xC9, 0x08,
+    0xE1, 0x0B, 0x84, 0x04, 0xB0, 0x0C, 0xED, 0x05, 0xB9, 0x0B, 0x83, 0x07, 0xC1, 0x0E, 0xD1, 0x02,
+    0x8C, 0x0D, 0xBB, 0x05, 0xA2, 0x0B, 0x82, 0x07, 0xAE, 0x0B, 0xED, 0x08, 0xBE, 0x0B, 0xA5, 0x05,
+    0xBC, 0x0B, 0xC7, 0x06, 0xC2, 0x0C, 0xF4, 0x08, 0xDC, 0x0B, 0x95, 0x06, 0xD4, 0x0B, 0xBA, 0x07,
+    0x91, 0x0E, 0xEB, 0x03, 0xA5, 0x0C, 0xFA, 0x05, 0xF6, 0x0A, 0xD8, 0x07, 0xDB, 0x0D, 0xD4, 0x06,
+    0x82, 0x0B, 0xDD, 0x08, 0xD3, 0x0B, 0xE3, 0x04, 0xE8, 0x0B, 0x9F, 0x06, 0xE3, 0x0B, 0xD2, 0x07,
+    0xC6, 0x0E, 0xC0, 0x02, 0x97, 0x0D, 0xB6, 0x05, 0xA6, 0x0B, 0xFC, 0x06, 0xA4, 0x0B, 0xF0, 0x08,
+    0xBB, 0x0B, 0xAB, 0x05, 0xB9, 0x0B, 0xCC, 0x06, 0xD3, 0x0C, 0xE2, 0x08, 0xE4, 0x0D, 0xBB, 0x04,
+    0x86, 0x0C, 0x8A, 0x06, 0xCB, 0x0B, 0xA8, 0x07, 0x88, 0x0E, 0x86, 0x04, 0x93, 0x0C, 0x89, 0x06,
+    0xF0, 0x0A, 0xF0, 0x07, 0xED, 0x12, 0x8D, 0x01, 0xA9, 0x0E, 0xEC, 0x04, 0xE0, 0x0B, 0xB5, 0x06,
+    0xF0, 0x0A, 0xB2, 0x08, 0xC1, 0x0B, 0xAA, 0x03, 0xF2, 0x0C, 0xC3, 0x05, 0xB3, 0x0B, 0xDD, 0x06,
+    0xEA, 0x0D, 0xA3, 0x01, 0xFD, 0x0C, 0x81, 0x06, 0xF3, 0x0A, 0xE2, 0x07, 0xD1, 0x0E, 0xEE, 0x05,
+    0xFA, 0x0A, 0xCC, 0x07, 0x84, 0x0D, 0xA7, 0x07, 0xFF, 0x0B, 0xAF, 0x08, 0xBC, 0x0B, 0xA4, 0x03,
+    0xF7, 0x0C, 0xBF, 0x05, 0xB4, 0x0B, 0xDB, 0x06, 0xC5, 0x0D, 0x89, 0x02, 0xD4, 0x0C, 0xB6, 0x06,
+    0xF1, 0x0A, 0xB4, 0x08, 0xC9, 0x0B, 0xAD, 0x03, 0xF1, 0x0C, 0xC3, 0x05, 0xB4, 0x0B, 0xDE, 0x06,
+    0x91, 0x0E, 0x45, 0xB7, 0x0D, 0xE3, 0x05, 0x83, 0x0B, 0xB7, 0x07, 0xA5, 0x0C, 0x88, 0x08, 0xA3,
+    0x0A, 0x95, 0x06, 0xBF, 0x0B, 0x92, 0x07, 0x98, 0x0E, 0xD5, 0x03, 0xB5, 0x0C, 0xEF, 0x05, 0xFB,
+    0x0A, 0xC7, 0x07, 0xED, 0x0C, 0xBF, 0x07, 0xCE, 0x0C, 0xDD, 0x07, 0xAA, 0x0E, 0x8F, 0x06, 0xEF,
+    0x0A, 0xFE, 0x07, 0xB1, 0x0D, 0xAA, 0x07, 0xC9, 0x0B, 0xAD, 0x06, 0xFA, 0x0B, 0xF9, 0x07, 0x9A,
+    0x1C, 0xC1, 0x05, 0x9E, 0x0B, 0x89, 0x07, 0xB8, 0x0B, 0xEA, 0x08, 0xC4, 0x0B, 0x96, 0x05, 0xC3,
+    0x0B, 0xBD, 0x06, 0xA0, 0x0C, 0xBB, 0x08, 0xCC, 0x0B, 0xBA, 0x07, 0x96, 0x0E, 0xDC, 0x03, 0xB0,
+    0x0C, 0xF2, 0x05, 0xF9, 0x0A, 0xCD, 0x07, 0x8A, 0x0D, 0xA1, 0x07, 0xF0, 0x0B, 0xBE, 0x08, 0xE0,
+    0x0B, 0xCC, 0x03, 0xDA, 0x0C, 0xD2, 0x05, 0xB3, 0x0B, 0xE9, 0x06, 0xAE, 0x1D, 0xD4, 0x04, 0xF2,
+    0x0B, 0xA2, 0x06, 0xEE, 0x0A, 0x95, 0x08, 0xF3, 0x09, 0xF4, 0x04, 0xDE, 0x0B, 0xA6, 0x06, 0xED,
+    0x0B, 0xE3, 0x07, 0xFB, 0x1D, 0xE4, 0x04, 0xE6, 0x0B, 0xAF, 0x06, 0xEF, 0x0A, 0xA9, 0x08, 0x90,
+    0x0B, 0xB9, 0x03, 0xE8, 0x0C, 0xC9, 0x05, 0xB2, 0x0B, 0xE2, 0x06,
+};
+static const uint8_t chua_stream_8[154] = {
+    0xE6, 0x4C, 0xE2, 0x03, 0xEE, 0x0C, 0xDC, 0x05, 0xEC, 0x64, 0xA4, 0x04, 0xF1, 0x0C, 0xF3, 0x05,
+    0x9C, 0x57, 0x93, 0x03, 0x8B, 0x0D, 0xBA, 0x05, 0xB9, 0x13, 0x14, 0xE1, 0x0E, 0xE9, 0x04, 0xB1,
+    0x0D, 0xF7, 0x05, 0xC8, 0x6C, 0xE2, 0x01, 0xF8, 0x0D, 0xFC, 0x04, 0xDB, 0x0D, 0xED, 0x05, 0x8A,
+    0x57, 0x9F, 0x03, 0x85, 0x0D, 0xC0, 0x05, 0xF9, 0x34, 0xD7, 0x04, 0x96, 0x0D, 0xFB, 0x05, 0xE1,
+    0xA0, 0x01, 0xD2, 0x03, 0xF2, 0x0C, 0xD4, 0x05, 0xD1, 0xA1, 0x01, 0xCC, 0x03, 0xF4, 0x0C, 0xD2,
+    0x05, 0x9E, 0x53, 0xD4, 0x03, 0xF2, 0x0C, 0xD5, 0x05, 0xB6, 0x54, 0xBA, 0x04, 0xFE, 0x0C, 0xF9,
+    0x05, 0x93, 0x98, 0x01, 0x9E, 0x02, 0xCB, 0x0D, 0x93, 0x05, 0xAD, 0x0E, 0xCE, 0x05, 0xC1, 0x55,
+    0xF0, 0x02, 0x9D, 0x0D, 0xAC, 0x05, 0xEC, 0x0F, 0xD7, 0x04, 0xB4, 0x0D, 0xF7, 0x05, 0xE6, 0x7C,
+    0xF0, 0x03, 0xED, 0x0C, 0xE1, 0x05, 0x85, 0x53, 0x88, 0x02, 0xE0, 0x0D, 0x87, 0x05, 0xFC, 0x0D,
+    0xE2, 0x05, 0xF4, 0x64, 0xDE, 0x03, 0xEF, 0x0C, 0xDA, 0x05,
+};
+static const uint8_t chua_stream_9[276] = {
+    0x81, 0x07, 0x91, 0x04, 0xB1, 0x0C, 0xEB, 0x05, 0xFD, 0x0A, 0x8B, 0x07, 0x91, 0x0A, 0xCA, 0x2E,
+    0xF3, 0x06, 0xDA, 0x04, 0x83, 0x0C, 0x8B, 0x06, 0xE3, 0x0A, 0xC8, 0x07, 0x82, 0x0A, 0xB4, 0x41,
+    0xF8, 0x08, 0x8A, 0x05, 0xCE, 0x0B, 0xB2, 0x06, 0xC4, 0x0A, 0xC5, 0x08, 0xF4, 0x09, 0x93, 0x31,
+    0x99, 0x03, 0xF8, 0x35, 0x88, 0x09, 0xCF, 0x05, 0x96, 0x0B, 0xE1, 0x06, 0xA2, 0x0A, 0x8B, 0x0B,
+    0x9C, 0x0A, 0xEA, 0x07, 0xFD, 0x09, 0xFB, 0x42, 0xF7, 0x08, 0x84, 0x05, 0xD3, 0x0B, 0xAE, 0x06,
+    0xC7, 0x0A, 0xB6, 0x08, 0xF5, 0x09, 0x87, 0x31, 0xD5, 0x03, 0xEE, 0x47, 0x89, 0x09, 0xDE, 0x05,
+    0x8B, 0x0B, 0xF1, 0x06, 0x9B, 0x0A, 0x89, 0x0D, 0xA1, 0x0C, 0xA4, 0x04, 0x98, 0x0C, 0xFE, 0x05,
+    0xED, 0x0A, 0xAD, 0x07, 0x88, 0x0A, 0xD5, 0x40, 0xDF, 0x05, 0x94, 0x06, 0x8E, 0x0B, 0xE8, 0x06,
+    0x9F, 0x0A, 0xD9, 0x0B, 0xC1, 0x0A, 0xDA, 0x06, 0xA6, 0x0A, 0xC4, 0x0A, 0x87, 0x0A, 0xB9, 0x09,
+    0xF5, 0x09, 0xCE, 0x40, 0xBB, 0x05, 0xF6, 0x06, 0xE8, 0x0A, 0xB0, 0x07, 0x87, 0x0A, 0xDF, 0x40,
+    0xF6, 0x05, 0xE7, 0x05, 0xA6, 0x0B, 0xCE, 0x06, 0xAD, 0x0A, 0xE7, 0x09, 0xF8, 0x09, 0xB4, 0x2F,
+    0x86, 0x09, 0xC4, 0x05, 0x9F, 0x0B, 0xD6, 0x06, 0xA8, 0x0A, 0xAF, 0x0A, 0x83, 0x0A, 0x90, 0x0A,
+    0xFF, 0x09, 0xC1, 0x0B, 0xB3, 0x0A, 0xFE, 0x06, 0x96, 0x0A, 0xAE, 0x47, 0x93, 0x06, 0xB7, 0x05,
+    0xC6, 0x0B, 0xB6, 0x06, 0xC0, 0x0A, 0xD8, 0x08, 0xF4, 0x09, 0xC3, 0x31, 0xED, 0x01, 0x92, 0x24,
+    0x87, 0x09, 0xC7, 0x05, 0x9D, 0x0B, 0xD9, 0x06, 0xA6, 0x0A, 0xC9, 0x0A, 0x88, 0x0A, 0xA6, 0x09,
+    0xF5, 0x09, 0x86, 0x41, 0xDF, 0x07, 0x9B, 0x04, 0xAC, 0x0C, 0xEF, 0x05, 0xF9, 0x0A, 0x92, 0x07,
+    0x8F, 0x0A, 0x91, 0x41, 0xC6, 0x08, 0xA7, 0x04, 0x9D, 0x0C, 0xF9, 0x05, 0xF2, 0x0A, 0xA3, 0x07,
+    0x8B, 0x0A, 0x9D, 0x40,
+};
+
+const chaos_table_t chaos_tables[CHAOS_TABLE_NUM_ATTRACTORS] = {
+    { /* lorenz */
+        16384u * CHAOS_TABLE_SUBSTEPS, 25u,
+        {
+            { lorenz_stream_0, 196u },
+            { lorenz_stream_1, 200u },
+            { lorenz_stream_2, 78u },
+            { lorenz_stream_3, 224u },
+            { lorenz_stream_4, 238u },
+            { lorenz_stream_5, 199u },
+            { lorenz_stream_6, 406u },
+            { lorenz_stream_7, 238u },
+            { lorenz_stream_8, 438u },
+            { lorenz_stream_9, 64u },
+        },
+    },
+    { /* rossler */
+        16384u * CHAOS_TABLE_SUBSTEPS, 30u,
+        {
+            { rossler_stream_0, 280u },
+            { rossler_stream_1, 228u },
+            { rossler_stream_2, 154u },
+            { rossler_stream_3, 246u },
+            { rossler_stream_4, 153u },
+            { rossler_stream_5, 273u },
+            { rossler_stream_6, 166u },
+            { rossler_stream_7, 234u },
+            { rossler_stream_8, 98u },
+            { rossler_stream_9, 74u },
+        },
+    },
+    { /* chua */
+        16384u * CHAOS_TABLE_SUBSTEPS, 50u,
+        {
+            { chua_stream_0, 56u },
+            { chua_stream_1, 86u },
+            { chua_stream_2, 104u },
+            { chua_stream_3, 46u },
+            { chua_stream_4, 68u },
+            { chua_stream_5, 213u },
+            { chua_stream_6, 134u },
+            { chua_stream_7, 214u },
+            { chua_stream_8, 76u },
+            { chua_stream_9, 138u },
+        },
+    },
+};
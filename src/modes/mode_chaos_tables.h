@@ -0,0 +1,27 @@
+#ifndef MODE_CHAOS_TABLES_H
+#define MODE_CHAOS_TABLES_H
+
+#include <stdint.h>
+
+// Precomputed attractor orbits for Chaos mode playback (data generated by scripts/chaos_tables.py).
+// Times are in 1/CHAOS_TABLE_SUBSTEPS of an integration step; playback maps steps_per_beat steps
+// onto one tempo interval and loops the orbit.
+
+#define CHAOS_TABLE_SUBSTEPS 16
+#define CHAOS_TABLE_NUM_STREAMS 10 // 2A-6A (x thresholds), 2B-6B (y/z thresholds)
+#define CHAOS_TABLE_NUM_ATTRACTORS 3 // Lorenz, Roessler, Chua
+
+typedef struct {
+    const uint8_t *data; // Varint (LEB128) deltas between crossings; the first is from orbit start
+    uint16_t count;      // Crossings in one orbit
+} chaos_table_stream_t;
+
+typedef struct {
+    uint32_t orbit_substeps; // Loop length
+    uint16_t steps_per_beat;
+    chaos_table_stream_t streams[CHAOS_TABLE_NUM_STREAMS];
+} chaos_table_t;
+
+extern const chaos_table_t chaos_tables[CHAOS_TABLE_NUM_ATTRACTORS];
+
+#endif // MODE_CHAOS_TABLES_H
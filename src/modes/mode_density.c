@@ -3,65 +3,63 @@
 #include "../main_constants.h"
 #include "../variables.h"
 
-#include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 static uint16_t density_patterns[MODE_RHYTHM_NUM_OUTPUTS];
 static uint8_t density_pct;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static bool pending_recalc;
 static calculation_mode_t s_calc;
+static uint16_t next_patterns[MODE_RHYTHM_NUM_OUTPUTS]; /* Recalculated tracks of the back bar */
+static mode_rhythm_bars_t bars;
+static bool bar_dirty = true;
 
-static void recalc_density_patterns(void) {
+/* Below 100 % base hits are thinned, above it rests are filled. Built ahead into the back bar. */
+static void prepare_next_bar(void) {
     for (int oi = 0; oi < MODE_RHYTHM_NUM_OUTPUTS; oi++) {
-        uint16_t base = mode_rhythm_base_pattern(s_calc, oi);
-        uint16_t p = base;
+        next_patterns[oi] = mode_rhythm_base_pattern(s_calc, oi);
+    }
+    if (density_pct != 100) {
+        mode_rhythm_xf_t xf = { MODE_RHYTHM_XF_THIN, 0, MODE_RHYTHM_ALL_TRACKS, NULL, NULL };
         if (density_pct < 100) {
-            uint8_t rem = (uint8_t)(100 - density_pct);
-            for (int b = 0; b < 16; b++) {
-                if ((p >> b) & 1) {
-                    if ((uint8_t)(rand() % 100) < rem) {
-                        p &= (uint16_t)~(1u << b);
-                    }
-                }
-            }
-        } else if (density_pct > 100) {
-            uint8_t add = (uint8_t)((density_pct > 200) ? 100 : (density_pct - 100));
-            for (int b = 0; b < 16; b++) {
-                if (((p >> b) & 1) == 0) {
-                    if ((uint8_t)(rand() % 100) < add) {
-                        p |= (uint16_t)(1u << b);
-                    }
-                }
-            }
+            xf.amount = (uint8_t)(100 - density_pct);
         } else {
-            p = base;
+            xf.op = MODE_RHYTHM_XF_FILL;
+            xf.amount = (uint8_t)((density_pct > 200) ? 100 : (density_pct - 100));
         }
-        density_patterns[oi] = p;
+        mode_rhythm_xf_apply(next_patterns, &xf, 1);
     }
-    pending_recalc = false;
+    mode_rhythm_bar_build(mode_rhythm_bars_back(&bars), next_patterns);
+    bars.back_ready = true;
 }
 
 void mode_density_init(void) {
     mode_density_reset();
-    next_step_time = 0;
 }
 
 void mode_density_reset(void) {
     density_pct = 100;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     pending_recalc = true;
+    bars.back_ready = false;
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         density_patterns[i] = 0;
         set_output(mode_rhythm_jacks[i], false);
     }
+    bar_dirty = true;
 }
 
 void mode_density_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_density_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_density_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -74,12 +72,14 @@ void mode_density_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
         density_pct = (uint8_t)(density_pct + 10);
     }
     pending_recalc = true;
+    bars.back_ready = false;
 }
 
 void mode_density_set_state(uint8_t pct, bool ramp_up) {
     density_pct = pct;
     (void)ramp_up;
     pending_recalc = true;
+    bars.back_ready = false;
 }
 
 void mode_density_get_state(uint8_t *pct, bool *ramp_up) {
@@ -94,40 +94,39 @@ void mode_density_update(const mode_context_t *context) {
     }
     if (context->calc_mode_changed) {
         pending_recalc = true;
+        bars.back_ready = false;
     }
 
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
+        if (pending_recalc && !bars.back_ready) {
+            prepare_next_bar();
+        }
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    if (current_step == 0 && pending_recalc) {
-        recalc_density_patterns();
-    }
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t pattern = density_patterns[i];
-        if ((pattern >> current_step) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
+    if (step_clock.bar_start && pending_recalc) {
+        if (!bars.back_ready) {
+            prepare_next_bar();
         }
+        memcpy(density_patterns, next_patterns, sizeof density_patterns);
+        pending_recalc = false;
+        mode_rhythm_bars_swap(&bars);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    } else if (bar_dirty) {
+        mode_rhythm_bar_build(&bars.bar[bars.front], density_patterns);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
     }
+    mode_rhythm_bar_play(mode_rhythm_bars_front(&bars), current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
+uint32_t mode_density_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    if (pending_recalc && !bars.back_ready) {
+        return MODE_WAKE_NOW; /* Recalculated bar still to generate */
     }
+    return mode_step_clock_next_wake_us(&step_clock);
 }
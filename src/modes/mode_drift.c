@@ -6,24 +6,57 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 static uint16_t drifted_patterns[MODE_RHYTHM_NUM_OUTPUTS];
 static bool drift_active;
 static uint8_t drift_probability;
 static bool drift_ramp_up;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
+static uint16_t next_patterns[MODE_RHYTHM_NUM_OUTPUTS]; /* drifted_patterns of the back bar */
+static mode_rhythm_bars_t bars;
+static bool bar_dirty = true; /* drifted_patterns changed outside a bar start */
 
 static void reload_base_patterns(void) {
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         drifted_patterns[i] = mode_rhythm_base_pattern(s_calc, i);
     }
+    bar_dirty = true;
+    bars.back_ready = false;
+}
+
+/* Next bar's mutations, built into the back buffer ahead of its downbeat. */
+static void prepare_next_bar(void) {
+    memcpy(next_patterns, drifted_patterns, sizeof next_patterns);
+    if (drift_active && drift_probability > 0) {
+        /* Increase unpredictability with multiple micro-mutations per bar. */
+        uint16_t flips[MODE_RHYTHM_NUM_OUTPUTS] = { 0 };
+        uint8_t mutations = (uint8_t)(1u + (rand() % 3));
+        for (uint8_t m = 0; m < mutations; m++) {
+            if ((uint8_t)(rand() % 100) < drift_probability) {
+                int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
+                int bi = rand() % 16;
+                flips[oi] ^= (uint16_t)(1u << bi);
+            }
+        }
+        /* Rare larger jump for non-linear evolution at higher drift values. */
+        if ((uint8_t)(rand() % 100) < (uint8_t)(drift_probability / 2u)) {
+            int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
+            int bj = rand() % 16;
+            int bk = rand() % 16;
+            flips[oi] ^= (uint16_t)((1u << bj) | (1u << bk));
+        }
+        const mode_rhythm_xf_t drift_xf = { MODE_RHYTHM_XF_XOR, 0, MODE_RHYTHM_ALL_TRACKS, flips, NULL };
+        mode_rhythm_xf_apply(next_patterns, &drift_xf, 1);
+    }
+    mode_rhythm_bar_build(mode_rhythm_bars_back(&bars), next_patterns);
+    bars.back_ready = true;
 }
 
 void mode_drift_init(void) {
     mode_drift_reset();
-    next_step_time = 0;
 }
 
 void mode_drift_reset(void) {
@@ -31,7 +64,7 @@ void mode_drift_reset(void) {
     drift_probability = 0;
     drift_ramp_up = true;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     reload_base_patterns();
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         set_output(mode_rhythm_jacks[i], false);
@@ -40,6 +73,11 @@ void mode_drift_reset(void) {
 
 void mode_drift_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_drift_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_drift_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -65,12 +103,14 @@ void mode_drift_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
             drift_probability = (uint8_t)(drift_probability - 10);
         }
     }
+    bars.back_ready = false;
 }
 
 void mode_drift_set_state(bool active, uint8_t probability, bool ramp_up) {
     drift_active = active;
     drift_probability = probability;
     drift_ramp_up = ramp_up;
+    bars.back_ready = false;
 }
 
 void mode_drift_get_state(bool *active, uint8_t *probability, bool *ramp_up) {
@@ -88,53 +128,35 @@ void mode_drift_update(const mode_context_t *context) {
         reload_base_patterns();
     }
 
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
-        return;
-    }
-
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    if (current_step == 0 && drift_active && drift_probability > 0) {
-        /* Increase unpredictability with multiple micro-mutations per bar. */
-        uint8_t mutations = (uint8_t)(1u + (rand() % 3));
-        for (uint8_t m = 0; m < mutations; m++) {
-            if ((uint8_t)(rand() % 100) < drift_probability) {
-                int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
-                int bi = rand() % 16;
-                drifted_patterns[oi] ^= (uint16_t)(1u << bi);
-            }
-        }
-        /* Rare larger jump for non-linear evolution at higher drift values. */
-        if ((uint8_t)(rand() % 100) < (uint8_t)(drift_probability / 2u)) {
-            int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
-            int bj = rand() % 16;
-            int bk = rand() % 16;
-            drifted_patterns[oi] ^= (uint16_t)((1u << bj) | (1u << bk));
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
+        if (!bars.back_ready) {
+            prepare_next_bar();
         }
+        return;
     }
+    current_step = (uint8_t)step;
 
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t pattern = drifted_patterns[i];
-        if ((pattern >> current_step) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
+    if (step_clock.bar_start) {
+        if (!bars.back_ready) {
+            prepare_next_bar(); /* No idle time since the last state change */
         }
+        memcpy(drifted_patterns, next_patterns, sizeof drifted_patterns);
+        mode_rhythm_bars_swap(&bars);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    } else if (bar_dirty) {
+        mode_rhythm_bar_build(&bars.bar[bars.front], drifted_patterns);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
     }
+    mode_rhythm_bar_play(mode_rhythm_bars_front(&bars), current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
+uint32_t mode_drift_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    if (!bars.back_ready) {
+        return MODE_WAKE_NOW; /* Next bar still to generate */
     }
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -83,7 +83,7 @@ void mode_euclidean_update(const mode_context_t* context) {
             if (n_a > 0) *step_ptr_a %= n_a; else *step_ptr_a = 0; // Wrap step counter
             if (pulse_a) {
                 // Use the dedicated function for timed pulse
-                set_output_high_for_duration(group_a_outputs[i], DEFAULT_PULSE_DURATION_MS);
+                io_trigger(group_a_outputs[i]);
                 // *on_time_ptr_a = context->current_time_ms; // No longer needed
             }
 
@@ -93,13 +93,13 @@ void mode_euclidean_update(const mode_context_t* context) {
             if (n_b > 0) *step_ptr_b %= n_b; else *step_ptr_b = 0; // Wrap step counter
             if (pulse_b) {
                  // Use the dedicated function for timed pulse
-                 set_output_high_for_duration(group_b_outputs[i], DEFAULT_PULSE_DURATION_MS);
+                 io_trigger(group_b_outputs[i]);
                 // *on_time_ptr_b = context->current_time_ms; // No longer needed
             }
         }
     }
 
-    // The loop checking pulse duration is no longer needed here, io_update_pulse_timers handles it.
+    // The loop checking pulse duration is no longer needed here, the pulse timer ISR handles it.
     /*
     for(int i = 0; i < NUM_EUCLIDEAN_FACTORED_OUTPUTS; i++) {
         uint32_t* on_time_ptr_a = &on_time_a[i];
@@ -11,8 +11,10 @@ static uint8_t fill_density;
 static bool fill_ramp_up;
 static uint16_t fill_mask[MODE_RHYTHM_NUM_OUTPUTS];
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
 
 static void regenerate_fill_mask(void) {
     /* Map 0..50 to 6 strong stages so each MOD click is clearly audible. */
@@ -45,26 +47,44 @@ static void regenerate_fill_mask(void) {
         }
         fill_mask[oi] = m;
     }
+    bar_dirty = true;
+}
+
+static void build_bar(void) {
+    uint16_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        tracks[i] = mode_rhythm_base_pattern(s_calc, i);
+    }
+    const mode_rhythm_xf_t fill_xf = { MODE_RHYTHM_XF_OR, 0, MODE_RHYTHM_ALL_TRACKS, fill_mask, NULL };
+    mode_rhythm_xf_apply(tracks, &fill_xf, 1);
+    mode_rhythm_bar_build(&bar, tracks);
+    mode_step_clock_follow(&step_clock, &bar);
+    bar_dirty = false;
 }
 
 void mode_fill_init(void) {
     mode_fill_reset();
-    next_step_time = 0;
 }
 
 void mode_fill_reset(void) {
     fill_density = 0;
     fill_ramp_up = true;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         fill_mask[i] = 0;
         set_output(mode_rhythm_jacks[i], false);
     }
+    bar_dirty = true;
 }
 
 void mode_fill_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_fill_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_fill_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -100,39 +120,23 @@ void mode_fill_update(const mode_context_t *context) {
         regenerate_fill_mask();
     }
 
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    if (current_step == 0) {
+    if (step_clock.bar_start) {
         regenerate_fill_mask();
     }
 
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t base = mode_rhythm_base_pattern(s_calc, i);
-        uint16_t extra = fill_mask[i];
-        if (((base >> current_step) & 1) || ((extra >> current_step) & 1)) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
-        }
+    if (bar_dirty) {
+        build_bar();
     }
+    mode_rhythm_bar_play(&bar, current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
-    }
+uint32_t mode_fill_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -1,13 +1,17 @@
 #include "mode_fixed.h"
+#include "mode_rhythm_shared.h"
 #include "../drivers/io.h"
 #include "../main_constants.h"
 #include "../variables.h"
+#include "../drivers/pattern_bank.h"
 
-#define NUM_FIXED_BANKS 10
+// Longer banks are written one 16-step bar per literal, in play order
+#define BARS2(b0, b1) ((uint64_t)(b0) | ((uint64_t)(b1) << 16))
+#define BARS4(b0, b1, b2, b3) (BARS2(b0, b1) | ((uint64_t)BARS2(b2, b3) << 32))
 
 // Output mapping: 2=Kick, 3=Snare, 4=Clap, 5=Open HH, 6=Closed HH
 // A and B are slightly different for variation
-static const uint16_t patterns[NUM_FIXED_BANKS][NUM_JACK_OUTPUTS] = {
+static const uint64_t patterns[NUM_FIXED_BANKS][NUM_JACK_OUTPUTS] = {
     // Bank 0: Basic Techno
     [0] = {
         [JACK_OUT_2A] = 0b1000100010001000, [JACK_OUT_2B] = 0b0000100010001001,
@@ -108,76 +112,145 @@ static const uint16_t patterns[NUM_FIXED_BANKS][NUM_JACK_OUTPUTS] = {
         [JACK_OUT_1A] = 0, [JACK_OUT_1B] = 0, [JACK_OUT_UNUSED_PB2] = 0, [JACK_OUT_UNUSED_PB3] = 0,
         [JACK_OUT_UNUSED_PB4] = 0, [JACK_OUT_UNUSED_PB7] = 0, [JACK_OUT_UNUSED_PB11] = 0,
         [JACK_OUT_STATUS_LED_PA15] = 0, [JACK_OUT_AUX_LED_PA3] = 0
+    },
+    // Bank 10: Techno, 2 bars with a turnaround
+    [10] = {
+        [JACK_OUT_2A] = BARS2(0b1000100010001000, 0b1010100010001000),
+        [JACK_OUT_2B] = BARS2(0b0000100010001001, 0b0000100010001001),
+        [JACK_OUT_3A] = BARS2(0b0010001000100010, 0b1111001000100010),
+        [JACK_OUT_3B] = BARS2(0b0000001000100010, 0b0101001000100010),
+        [JACK_OUT_4A] = BARS2(0b0010001000100010, 0b0010001000100010),
+        [JACK_OUT_4B] = BARS2(0b0010000000000010, 0b1010000000000010),
+        [JACK_OUT_5A] = BARS2(0b1010101010101010, 0b1010101010101010),
+        [JACK_OUT_5B] = BARS2(0b0010101010101010, 0b0000000010101010),
+        [JACK_OUT_6A] = BARS2(0b1111111111111111, 0b0101111111111111),
+        [JACK_OUT_6B] = BARS2(0b1111111101111111, 0b0000111101111111),
+        [JACK_OUT_1A] = 0, [JACK_OUT_1B] = 0, [JACK_OUT_UNUSED_PB2] = 0, [JACK_OUT_UNUSED_PB3] = 0,
+        [JACK_OUT_UNUSED_PB4] = 0, [JACK_OUT_UNUSED_PB7] = 0, [JACK_OUT_UNUSED_PB11] = 0,
+        [JACK_OUT_STATUS_LED_PA15] = 0, [JACK_OUT_AUX_LED_PA3] = 0
+    },
+    // Bank 11: 4-bar phrase, groove x2, breakdown, build
+    [11] = {
+        [JACK_OUT_2A] = BARS4(0b1001000100010000, 0b1001000100010000, 0b0000000000000000, 0b1111000100010001),
+        [JACK_OUT_2B] = BARS4(0b1000000100010001, 0b1000000100010001, 0b1000000000000001, 0b1000000100010001),
+        [JACK_OUT_3A] = BARS4(0b0010001000100010, 0b0010001000100010, 0b0000000000000000, 0b1010101000100010),
+        [JACK_OUT_3B] = BARS4(0b0000001000100010, 0b0000001000100010, 0b0000000000000000, 0b1111111100000000),
+        [JACK_OUT_4A] = BARS4(0b0001000100010001, 0b0001000100010001, 0b0001000000000000, 0b0001000100010001),
+        [JACK_OUT_4B] = BARS4(0b0000000100010001, 0b0000000100010001, 0b0000000000000000, 0b0000000100010001),
+        [JACK_OUT_5A] = BARS4(0b1010101010101010, 0b1010101010101010, 0b1000100010001000, 0b1010101010101010),
+        [JACK_OUT_5B] = BARS4(0b0010101010101010, 0b0010101010101010, 0b0000000000000000, 0b0010101010101010),
+        [JACK_OUT_6A] = BARS4(0b1111111111111111, 0b1111111111111111, 0b0001000100010001, 0b1111111111111111),
+        [JACK_OUT_6B] = BARS4(0b1111111111111101, 0b1111111111111101, 0b0000000000000000, 0b0101010101010101),
+        [JACK_OUT_1A] = 0, [JACK_OUT_1B] = 0, [JACK_OUT_UNUSED_PB2] = 0, [JACK_OUT_UNUSED_PB3] = 0,
+        [JACK_OUT_UNUSED_PB4] = 0, [JACK_OUT_UNUSED_PB7] = 0, [JACK_OUT_UNUSED_PB11] = 0,
+        [JACK_OUT_STATUS_LED_PA15] = 0, [JACK_OUT_AUX_LED_PA3] = 0
     }
 };
 
+static const uint8_t bank_steps[NUM_FIXED_BANKS] = {
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 32, MODE_RHYTHM_MAX_STEPS
+};
+
 static uint8_t current_step = 0;
-static uint8_t current_bank = 0;
+static uint16_t current_bank = 0;
 static bool bank_change_pending = false;
-static uint8_t pending_bank = 0;
-static uint32_t next_step_time = 0;
+static uint16_t pending_bank = 0;
+static mode_step_clock_t step_clock;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
+
+static void build_bar(void) {
+    uint64_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    uint8_t steps;
+    // User banks are decoded straight from flash; a bank that went missing plays bank 0
+    if (current_bank < NUM_FIXED_BANKS ||
+        !pattern_bank_read((uint16_t)(current_bank - NUM_FIXED_BANKS), tracks, &steps)) {
+        uint16_t bank = (current_bank < NUM_FIXED_BANKS) ? current_bank : 0u;
+        for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+            tracks[i] = patterns[bank][mode_rhythm_jacks[i]];
+        }
+        steps = bank_steps[bank];
+    }
+    mode_rhythm_bar_build_long(&bar, tracks, steps);
+    mode_step_clock_follow(&step_clock, &bar);
+    bar_dirty = false;
+}
 
 void mode_fixed_init(void) {
     mode_fixed_reset();
-    next_step_time = 0;
 }
 
-void mode_fixed_update(const mode_context_t* context) {
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) step_interval = 5;
+void mode_fixed_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
+}
 
-    if (next_step_time == 0) next_step_time = now;
+void mode_fixed_update(const mode_context_t* context) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) return;
+    current_step = (uint8_t)step;
 
-    if (now >= next_step_time) {
-        next_step_time += step_interval;
-        if (next_step_time < now) next_step_time = now + step_interval;
+    // Pending bank switches land on the bar line
+    if (step_clock.bar_start && bank_change_pending) {
+        current_bank = pending_bank;
+        bank_change_pending = false;
+        bar_dirty = true;
+    }
 
-        for (int i = 0; i < NUM_JACK_OUTPUTS; i++) {
-            uint16_t pattern = patterns[current_bank][i];
-            if ((pattern >> current_step) & 1) {
-                set_output_high_for_duration((jack_output_t)i, DEFAULT_PULSE_DURATION_MS);
-            }
-        }
+    if (bar_dirty) build_bar();
+    mode_rhythm_bar_play(&bar, current_step);
+}
 
-        current_step++;
-        if (current_step >= 16) {
-            current_step = 0;
-            if (bank_change_pending) {
-                current_bank = pending_bank;
-                bank_change_pending = false;
-            }
-        }
-    }
+uint32_t mode_fixed_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
 
 void mode_fixed_reset(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
     current_bank = 0;
     bank_change_pending = false;
     pending_bank = 0;
+    bar_dirty = true;
 
     for (int i = JACK_OUT_2A; i <= JACK_OUT_6B; i++) {
         set_output((jack_output_t)i, false);
     }
 }
 
-void mode_fixed_set_bank(uint8_t bank) {
-    if (bank < NUM_FIXED_BANKS) current_bank = bank;
+uint16_t mode_fixed_bank_count(void) {
+    return (uint16_t)(NUM_FIXED_BANKS + pattern_bank_count());
 }
 
-uint8_t mode_fixed_get_bank(void) { return current_bank; }
+void mode_fixed_set_bank(uint16_t bank) {
+    if (bank < mode_fixed_bank_count()) {
+        current_bank = bank;
+        bar_dirty = true;
+    }
+}
 
-void mode_fixed_reset_step(void) { current_step = 0; }
+uint16_t mode_fixed_get_bank(void) { return current_bank; }
+
+// MOD press: step to the next bank (factory banks, then flash user banks), wrapping around
+void mode_fixed_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ev;
+    (void)ts_ms;
+    mode_fixed_set_bank((uint16_t)((current_bank + 1u) % mode_fixed_bank_count()));
+}
+
+void mode_fixed_reset_step(void) {
+    current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
 
-void mode_fixed_set_bank_pending(uint8_t bank) {
-    if (bank < NUM_FIXED_BANKS) {
+void mode_fixed_set_bank_pending(uint16_t bank) {
+    if (bank < mode_fixed_bank_count()) {
         pending_bank = bank;
         bank_change_pending = true;
     }
 }
 
-uint8_t mode_fixed_get_bank_pending(void) { return pending_bank; }
+uint16_t mode_fixed_get_bank_pending(void) { return pending_bank; }
 
 bool mode_fixed_is_bank_change_pending(void) { return bank_change_pending; }
 
@@ -185,5 +258,6 @@ void mode_fixed_apply_bank_change(void) {
     if (bank_change_pending) {
         current_bank = pending_bank;
         bank_change_pending = false;
+        bar_dirty = true;
     }
 }
@@ -5,18 +5,21 @@
 #include <stdbool.h>
 #include "modes/modes.h"
 
-#define NUM_FIXED_BANKS 10
+#define NUM_FIXED_BANKS 12 // Built in (0-9: 16 steps, 10: 32, 11: 64); flash banks follow
 
 void mode_fixed_init(void);
 void mode_fixed_update(const mode_context_t* context);
 void mode_fixed_reset(void);
 
-void mode_fixed_set_bank(uint8_t bank);
-uint8_t mode_fixed_get_bank(void);
+/** Built-in banks plus the user banks found in the flash bank region. */
+uint16_t mode_fixed_bank_count(void);
+
+void mode_fixed_set_bank(uint16_t bank);
+uint16_t mode_fixed_get_bank(void);
 void mode_fixed_reset_step(void);
 
-void mode_fixed_set_bank_pending(uint8_t bank);
-uint8_t mode_fixed_get_bank_pending(void);
+void mode_fixed_set_bank_pending(uint16_t bank);
+uint16_t mode_fixed_get_bank_pending(void);
 bool mode_fixed_is_bank_change_pending(void);
 void mode_fixed_apply_bank_change(void);
 
@@ -25,10 +25,11 @@ static const jack_output_t GCF_B[6] = {
 };
 static const uint8_t GCF_F[6] = { 1u, 2u, 3u, 4u, 5u, 6u };
 
-static uint32_t next_mult_trigger_time[NUM_JACK_OUTPUTS];
+/** Start of the next effective beat (Teff grid); each starts one timer-driven burst per mult jack. */
+static uint32_t next_beat_time;
 static uint32_t div_counters[NUM_JACK_OUTPUTS];
 static bool waiting_for_first_f1;
-/** Last raw tempo from context (unscaled); used on MOD to rescale mult deadlines. */
+/** Last raw tempo from context (unscaled); used on MOD and tempo changes to rescale mult deadlines. */
 static uint32_t gcf_base_tempo_ms = DEFAULT_TEMPO_INTERVAL;
 
 static uint32_t gcf_ratchet_Teff_for(uint32_t T, bool dbl) {
@@ -75,21 +76,32 @@ static uint32_t gcf_effective_T(uint32_t T) {
     return T;
 }
 
+/** gcf_effective_T() read from the Clock Manager's timing table while the live tempo is valid. */
+static uint32_t gcf_effective_T_cached(const mode_timing_t *timing) {
+    if (!timing->valid) {
+        return gcf_effective_T(gcf_base_tempo_ms);
+    }
+    if (gcf_var == GCF_RATCHET && gcf_ratchet_double) {
+        return timing->half_ms;
+    }
+    if (gcf_var == GCF_ANTI_RATCHET && gcf_anti_half) {
+        return timing->double_ms;
+    }
+    return timing->clamped_ms;
+}
+
 static void gcf_scale_mult_triggers(uint32_t now, uint32_t old_teff, uint32_t new_teff) {
     if (old_teff == 0u || new_teff == 0u || old_teff == new_teff) {
         return;
     }
-    for (int i = 0; i < 6; i++) {
-        jack_output_t p = GCF_A[i];
-        uint32_t n = next_mult_trigger_time[p];
-        if (n > now) {
-            uint64_t rem = (uint64_t)(n - now);
-            rem = rem * (uint64_t)new_teff / (uint64_t)old_teff;
-            if (rem > (uint64_t)MAX_INTERVAL * 4u) {
-                rem = MAX_INTERVAL;
-            }
-            next_mult_trigger_time[p] = now + (uint32_t)rem;
+    uint32_t n = next_beat_time;
+    if (n > now) {
+        uint64_t rem = (uint64_t)(n - now);
+        rem = rem * (uint64_t)new_teff / (uint64_t)old_teff;
+        if (rem > (uint64_t)MAX_INTERVAL * 4u) {
+            rem = MAX_INTERVAL;
         }
+        next_beat_time = now + (uint32_t)rem;
     }
 }
 
@@ -106,10 +118,7 @@ static void gcf_outputs_all_low(void) {
 
 static void gcf_resync_phase(void) {
     memset(div_counters, 0, sizeof(div_counters));
-    uint32_t now = millis();
-    for (int j = 0; j < (int)NUM_JACK_OUTPUTS; j++) {
-        next_mult_trigger_time[j] = now;
-    }
+    next_beat_time = millis();
     gcf_outputs_all_low();
     waiting_for_first_f1 = true;
 }
@@ -180,38 +189,21 @@ void mode_gamma_start_stop_reset(void) {
 
 static void gcf_shared_update(const mode_context_t *context) {
     uint32_t current_time = context->current_time_ms;
-    uint32_t raw_T = context->current_tempo_interval_ms;
-    if (raw_T >= MIN_INTERVAL && raw_T <= MAX_INTERVAL) {
-        gcf_base_tempo_ms = raw_T;
+    if (context->timing->valid) {
+        gcf_base_tempo_ms = context->timing->interval_ms;
     }
-    uint32_t tempo_interval = gcf_effective_T(gcf_base_tempo_ms);
+    uint32_t tempo_interval = gcf_effective_T_cached(context->timing);
     bool tempo_valid = (tempo_interval >= MIN_INTERVAL && tempo_interval <= MAX_INTERVAL);
     const bool muted = gcf_outputs_muted();
 
     if (waiting_for_first_f1) {
         if (context->f1_rising_edge && tempo_valid) {
             waiting_for_first_f1 = false;
-            uint32_t first_sync_time = current_time;
             memset(div_counters, 0, sizeof(div_counters));
-
+            next_beat_time = current_time + tempo_interval;
             for (int i = 0; i < 6; i++) {
-                uint32_t factor = GCF_F[i];
-                if (factor == 0u) {
-                    continue;
-                }
-                uint32_t mult_interval = tempo_interval / factor;
-                if (mult_interval < MIN_CLOCK_INTERVAL) {
-                    mult_interval = MIN_CLOCK_INTERVAL;
-                }
-                jack_output_t pin_a = GCF_A[i];
-                jack_output_t pin_b = GCF_B[i];
-
-                next_mult_trigger_time[pin_a] = first_sync_time + mult_interval;
-                next_mult_trigger_time[pin_b] = first_sync_time + mult_interval;
-
-                if (!muted && current_time >= next_mult_trigger_time[pin_a]) {
-                    set_output_high_for_duration(pin_a, DEFAULT_PULSE_DURATION_MS);
-                    next_mult_trigger_time[pin_a] += mult_interval;
+                if (!muted && GCF_F[i] != 0u) {
+                    io_burst(GCF_A[i], GCF_F[i], tempo_interval * 1000u);
                 }
             }
             return;
@@ -226,6 +218,15 @@ static void gcf_shared_update(const mode_context_t *context) {
         return;
     }
 
+    // Multipliers: one burst of `factor` pulses per effective beat, generated by the pulse timer
+    bool beat_now = current_time >= next_beat_time;
+    if (beat_now) {
+        next_beat_time += tempo_interval;
+        if (next_beat_time < current_time) {
+            next_beat_time = current_time + tempo_interval;
+        }
+    }
+
     for (int i = 0; i < 6; i++) {
         uint32_t factor = GCF_F[i];
         if (factor == 0u) {
@@ -234,26 +235,15 @@ static void gcf_shared_update(const mode_context_t *context) {
         jack_output_t pin_a = GCF_A[i];
         jack_output_t pin_b = GCF_B[i];
 
-        uint32_t mult_interval = tempo_interval / factor;
-        if (mult_interval < MIN_CLOCK_INTERVAL) {
-            mult_interval = MIN_CLOCK_INTERVAL;
-        }
-
-        if (current_time >= next_mult_trigger_time[pin_a]) {
-            if (!muted) {
-                set_output_high_for_duration(pin_a, DEFAULT_PULSE_DURATION_MS);
-            }
-            next_mult_trigger_time[pin_a] += mult_interval;
-            if (next_mult_trigger_time[pin_a] < current_time) {
-                next_mult_trigger_time[pin_a] = current_time + mult_interval;
-            }
+        if (beat_now && !muted) {
+            io_burst(pin_a, (uint16_t)factor, tempo_interval * 1000u);
         }
 
         if (context->f1_rising_edge) {
             div_counters[pin_b]++;
             if (div_counters[pin_b] >= factor) {
                 if (!muted) {
-                    set_output_high_for_duration(pin_b, DEFAULT_PULSE_DURATION_MS);
+                    io_trigger(pin_b);
                 }
                 div_counters[pin_b] = 0;
             }
@@ -276,6 +266,29 @@ void mode_gamma_start_stop_update(const mode_context_t *context) {
     gcf_shared_update(context);
 }
 
+static void gcf_on_tempo_change(uint32_t now, uint32_t old_T, uint32_t new_T) {
+    if (new_T < MIN_INTERVAL || new_T > MAX_INTERVAL) {
+        return;
+    }
+    gcf_scale_mult_triggers(now, gcf_effective_T(old_T), gcf_effective_T(new_T));
+    gcf_base_tempo_ms = new_T;
+}
+
+void mode_gamma_ratchet_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    gcf_var = GCF_RATCHET;
+    gcf_on_tempo_change(now_ms, old_interval_ms, new_interval_ms);
+}
+
+void mode_gamma_anti_ratchet_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    gcf_var = GCF_ANTI_RATCHET;
+    gcf_on_tempo_change(now_ms, old_interval_ms, new_interval_ms);
+}
+
+void mode_gamma_start_stop_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    gcf_var = GCF_START_STOP;
+    gcf_on_tempo_change(now_ms, old_interval_ms, new_interval_ms);
+}
+
 void mode_gamma_ratchet_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
     (void)ts_ms;
     if (ev != MOD_PRESS_EVENT_SINGLE) {
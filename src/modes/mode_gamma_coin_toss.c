@@ -48,9 +48,9 @@ void mode_gamma_coin_toss_update(const mode_context_t *context) {
         }
         uint8_t r = (uint8_t)(rand() % 100);
         if (r < p_a) {
-            set_output_high_for_duration(COIN_A[i], DEFAULT_PULSE_DURATION_MS);
+            io_trigger(COIN_A[i]);
         } else {
-            set_output_high_for_duration(COIN_B[i], DEFAULT_PULSE_DURATION_MS);
+            io_trigger(COIN_B[i]);
         }
     }
 }
@@ -100,6 +100,15 @@ void mode_gamma_portals_update(const mode_context_t *context) {
     }
 }
 
+void mode_gamma_portals_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    if (!portals_multiply_mode) {
+        return; /* Divide cadence counts F1 edges, nothing is scheduled */
+    }
+    for (uint8_t i = 0u; i < 6u; i++) {
+        portals_last_swap_ms[i] = mode_rescale_elapsed(portals_last_swap_ms[i], now_ms, old_interval_ms, new_interval_ms);
+    }
+}
+
 void mode_gamma_portals_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
     (void)ts_ms;
     if (ev != MOD_PRESS_EVENT_SINGLE) {
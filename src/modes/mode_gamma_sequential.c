@@ -0,0 +1,332 @@
+#include "modes.h"
+#include "clock_manager.h"
+#include "../drivers/io.h"
+#include "../main_constants.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Gamma sequential family (modes 21–24) as data. Each mode is a table of step masks (bit per
+ * jack_output_t) plus how it is stepped and what MOD does; an F1 edge is a table lookup and one
+ * io_trigger_mask(). Bounce (25) schedules timed trains and keeps its own file.
+ */
+
+#define J(jack) (1u << (jack))
+
+/* How the step position advances on F1 */
+typedef enum {
+    GAMMA_SEQ_FROM_F1_COUNTER, // Position = (f1_counter - 1) % length: locked to the beat count
+    GAMMA_SEQ_OWN_STEP,        // Own step counter, advanced per F1 unless held
+} gamma_seq_clock_t;
+
+/* What MOD does */
+typedef enum {
+    GAMMA_SEQ_MOD_RESTART_BEAT, // clock_manager_restart_beat_phase_now()
+    GAMMA_SEQ_MOD_HOLD,         // Toggle hold: the current step repeats
+    GAMMA_SEQ_MOD_NEXT_TABLE,   // Next table, from step 0
+    GAMMA_SEQ_MOD_FIRE,         // Fire mod_mask now, then play the table once
+} gamma_seq_mod_t;
+
+typedef struct {
+    const uint16_t *steps;
+    uint8_t length;
+} gamma_seq_table_t;
+
+typedef struct {
+    const gamma_seq_table_t *tables;
+    uint8_t num_tables;
+    gamma_seq_clock_t clock;
+    gamma_seq_mod_t mod;
+    bool swap_reverses; // CALC swapped plays the table backwards
+    uint16_t mod_mask;  // Jacks fired by GAMMA_SEQ_MOD_FIRE
+} gamma_seq_def_t;
+
+typedef struct {
+    const gamma_seq_def_t *def;
+    uint8_t table;
+    uint8_t step;
+    bool held; // Frozen, or a one-shot waiting for MOD
+} gamma_seq_t;
+
+static void gamma_seq_reset(gamma_seq_t *s) {
+    s->table = 0;
+    s->step = 0;
+    s->held = (s->def->mod == GAMMA_SEQ_MOD_FIRE);
+    for (jack_output_t j = JACK_OUT_1A; j <= JACK_OUT_6B; j = (jack_output_t)(j + 1)) {
+        set_output(j, false);
+    }
+}
+
+static void gamma_seq_update(gamma_seq_t *s, const mode_context_t *context) {
+    if (!context->f1_rising_edge) {
+        return;
+    }
+    const gamma_seq_def_t *def = s->def;
+    const gamma_seq_table_t *t = &def->tables[s->table];
+    bool one_shot = (def->mod == GAMMA_SEQ_MOD_FIRE);
+    if (t->length == 0u || (one_shot && s->held)) {
+        return;
+    }
+
+    uint32_t pos = s->step;
+    if (def->clock == GAMMA_SEQ_FROM_F1_COUNTER) {
+        if (context->f1_counter == 0u) {
+            return;
+        }
+        pos = (context->f1_counter - 1u) % t->length;
+    }
+    if (def->swap_reverses && context->calc_mode == CALC_MODE_SWAPPED) {
+        pos = (t->length - 1u) - pos;
+    }
+    io_trigger_mask(t->steps[pos]);
+
+    if (def->clock != GAMMA_SEQ_OWN_STEP || (s->held && !one_shot)) {
+        return;
+    }
+    s->step++;
+    if (s->step >= t->length) {
+        s->step = 0;
+        s->held = one_shot; // A one-shot goes idle after its last step
+    }
+}
+
+static void gamma_seq_on_mod(gamma_seq_t *s) {
+    const gamma_seq_def_t *def = s->def;
+    switch (def->mod) {
+    case GAMMA_SEQ_MOD_RESTART_BEAT:
+        clock_manager_restart_beat_phase_now();
+        break;
+    case GAMMA_SEQ_MOD_HOLD:
+        s->held = !s->held;
+        break;
+    case GAMMA_SEQ_MOD_NEXT_TABLE:
+        s->table = (uint8_t)((s->table + 1u) % def->num_tables);
+        s->step = 0;
+        break;
+    case GAMMA_SEQ_MOD_FIRE:
+        io_trigger_mask(def->mod_mask);
+        s->step = 0;
+        s->held = false;
+        break;
+    }
+}
+
+/* --- Tables --- */
+
+/* 1A…6A then 1B…6B */
+static const uint16_t SWEEP[] = {
+    J(JACK_OUT_1A), J(JACK_OUT_2A), J(JACK_OUT_3A), J(JACK_OUT_4A), J(JACK_OUT_5A), J(JACK_OUT_6A),
+    J(JACK_OUT_1B), J(JACK_OUT_2B), J(JACK_OUT_3B), J(JACK_OUT_4B), J(JACK_OUT_5B), J(JACK_OUT_6B),
+};
+static const gamma_seq_table_t SWEEP_TABLE[] = {{SWEEP, 12u}};
+
+/*
+ * Mode 23 trip patterns — see README / AGENTS.md (Gamma).
+ * MOD/CV cycles pattern 1→6; calc swapped reverses step order within the pattern.
+ */
+/* 1: inverted pairs 1A+6B … 6A+1B */
+static const uint16_t TRIP_P0[] = {
+    J(JACK_OUT_1A) | J(JACK_OUT_6B),
+    J(JACK_OUT_2A) | J(JACK_OUT_5B),
+    J(JACK_OUT_3A) | J(JACK_OUT_4B),
+    J(JACK_OUT_4A) | J(JACK_OUT_3B),
+    J(JACK_OUT_5A) | J(JACK_OUT_2B),
+    J(JACK_OUT_6A) | J(JACK_OUT_1B),
+};
+
+/* 2: bounce on same pairs — up 1…6 then down to 2 (10 steps) */
+static const uint16_t TRIP_P1[] = {
+    J(JACK_OUT_1A) | J(JACK_OUT_6B),
+    J(JACK_OUT_2A) | J(JACK_OUT_5B),
+    J(JACK_OUT_3A) | J(JACK_OUT_4B),
+    J(JACK_OUT_4A) | J(JACK_OUT_3B),
+    J(JACK_OUT_5A) | J(JACK_OUT_2B),
+    J(JACK_OUT_6A) | J(JACK_OUT_1B),
+    J(JACK_OUT_5A) | J(JACK_OUT_2B),
+    J(JACK_OUT_4A) | J(JACK_OUT_3B),
+    J(JACK_OUT_3A) | J(JACK_OUT_4B),
+    J(JACK_OUT_2A) | J(JACK_OUT_5B),
+};
+
+/* 3: stairs interleaved */
+static const uint16_t TRIP_P2[] = {
+    J(JACK_OUT_1A), J(JACK_OUT_1B), J(JACK_OUT_2A), J(JACK_OUT_2B),
+    J(JACK_OUT_3A), J(JACK_OUT_3B), J(JACK_OUT_4A), J(JACK_OUT_4B),
+    J(JACK_OUT_5A), J(JACK_OUT_5B), J(JACK_OUT_6A), J(JACK_OUT_6B),
+};
+
+/* 4: circle — A 1…6 then B 6…1 */
+static const uint16_t TRIP_P3[] = {
+    J(JACK_OUT_1A), J(JACK_OUT_2A), J(JACK_OUT_3A), J(JACK_OUT_4A),
+    J(JACK_OUT_5A), J(JACK_OUT_6A),
+    J(JACK_OUT_6B), J(JACK_OUT_5B), J(JACK_OUT_4B), J(JACK_OUT_3B),
+    J(JACK_OUT_2B), J(JACK_OUT_1B),
+};
+
+/* 5: convergence (explicit pairs) */
+static const uint16_t TRIP_P4[] = {
+    J(JACK_OUT_1A) | J(JACK_OUT_4B),
+    J(JACK_OUT_6A) | J(JACK_OUT_3B),
+    J(JACK_OUT_2A) | J(JACK_OUT_5B),
+    J(JACK_OUT_5A) | J(JACK_OUT_2B),
+    J(JACK_OUT_3A) | J(JACK_OUT_6B),
+    J(JACK_OUT_4A) | J(JACK_OUT_1B),
+};
+
+/* 6: groups */
+static const uint16_t TRIP_P5[] = {
+    J(JACK_OUT_1A) | J(JACK_OUT_6A) | J(JACK_OUT_3B) | J(JACK_OUT_4B),
+    J(JACK_OUT_2A) | J(JACK_OUT_5A) | J(JACK_OUT_2B) | J(JACK_OUT_5B),
+    J(JACK_OUT_3A) | J(JACK_OUT_4A) | J(JACK_OUT_1B) | J(JACK_OUT_6B),
+};
+
+#define GAMMA_TRIP_NUM_PATTERNS 6u
+
+static const gamma_seq_table_t TRIP_TABLES[GAMMA_TRIP_NUM_PATTERNS] = {
+    {TRIP_P0, 6u},
+    {TRIP_P1, 10u},
+    {TRIP_P2, 12u},
+    {TRIP_P3, 12u},
+    {TRIP_P4, 6u},
+    {TRIP_P5, 3u},
+};
+
+/* After MOD's 1A+6B: paired 2A+5B … 6A+1B, A stepping up and B down */
+static const uint16_t FIRE_STEPS[] = {
+    J(JACK_OUT_2A) | J(JACK_OUT_5B),
+    J(JACK_OUT_3A) | J(JACK_OUT_4B),
+    J(JACK_OUT_4A) | J(JACK_OUT_3B),
+    J(JACK_OUT_5A) | J(JACK_OUT_2B),
+    J(JACK_OUT_6A) | J(JACK_OUT_1B),
+};
+static const gamma_seq_table_t FIRE_TABLE[] = {{FIRE_STEPS, 5u}};
+
+/* --- Modes --- */
+
+static const gamma_seq_def_t RESET_DEF = {
+    SWEEP_TABLE, 1u, GAMMA_SEQ_FROM_F1_COUNTER, GAMMA_SEQ_MOD_RESTART_BEAT, true, 0u
+};
+static const gamma_seq_def_t FREEZE_DEF = {
+    SWEEP_TABLE, 1u, GAMMA_SEQ_OWN_STEP, GAMMA_SEQ_MOD_HOLD, true, 0u
+};
+static const gamma_seq_def_t TRIP_DEF = {
+    TRIP_TABLES, GAMMA_TRIP_NUM_PATTERNS, GAMMA_SEQ_OWN_STEP, GAMMA_SEQ_MOD_NEXT_TABLE, true, 0u
+};
+static const gamma_seq_def_t FIRE_DEF = {
+    FIRE_TABLE, 1u, GAMMA_SEQ_OWN_STEP, GAMMA_SEQ_MOD_FIRE, false, J(JACK_OUT_1A) | J(JACK_OUT_6B)
+};
+
+static gamma_seq_t reset_seq = {&RESET_DEF, 0, 0, false};
+static gamma_seq_t freeze_seq = {&FREEZE_DEF, 0, 0, false};
+static gamma_seq_t trip_seq = {&TRIP_DEF, 0, 0, false};
+static gamma_seq_t fire_seq = {&FIRE_DEF, 0, 0, true};
+
+/* Mode 21 — one jack per F1 on the beat count. MOD/CV restarts the beat phase. */
+void mode_gamma_sequential_reset_init(void) {
+    mode_gamma_sequential_reset_reset();
+}
+
+void mode_gamma_sequential_reset_update(const mode_context_t *context) {
+    gamma_seq_update(&reset_seq, context);
+}
+
+void mode_gamma_sequential_reset_reset(void) {
+    gamma_seq_reset(&reset_seq);
+}
+
+void mode_gamma_sequential_reset_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ev;
+    (void)ts_ms;
+    gamma_seq_on_mod(&reset_seq);
+}
+
+/* Mode 22 — same sweep on its own step. MOD/CV toggles freeze (hold step). */
+void mode_gamma_sequential_freeze_set_state(bool frz, uint8_t step) {
+    freeze_seq.held = frz;
+    freeze_seq.step = (step >= SWEEP_TABLE[0].length) ? 0u : step;
+}
+
+void mode_gamma_sequential_freeze_get_state(bool *frz, uint8_t *step) {
+    if (frz) {
+        *frz = freeze_seq.held;
+    }
+    if (step) {
+        *step = freeze_seq.step;
+    }
+}
+
+void mode_gamma_sequential_freeze_init(void) {
+    mode_gamma_sequential_freeze_reset();
+}
+
+void mode_gamma_sequential_freeze_reset(void) {
+    gamma_seq_reset(&freeze_seq);
+}
+
+void mode_gamma_sequential_freeze_update(const mode_context_t *context) {
+    gamma_seq_update(&freeze_seq, context);
+}
+
+void mode_gamma_sequential_freeze_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ev;
+    (void)ts_ms;
+    gamma_seq_on_mod(&freeze_seq);
+}
+
+/* Mode 23 — six trip patterns. MOD/CV cycles pattern. */
+void mode_gamma_sequential_trip_set_state(uint8_t pat, uint8_t step) {
+    if (pat >= GAMMA_TRIP_NUM_PATTERNS) {
+        pat = 0;
+    }
+    trip_seq.table = pat;
+    trip_seq.step = (step >= TRIP_TABLES[pat].length) ? 0u : step;
+}
+
+void mode_gamma_sequential_trip_get_state(uint8_t *pat, uint8_t *step) {
+    if (pat) {
+        *pat = trip_seq.table;
+    }
+    if (step) {
+        *step = trip_seq.step;
+    }
+}
+
+void mode_gamma_sequential_trip_init(void) {
+    mode_gamma_sequential_trip_reset();
+}
+
+void mode_gamma_sequential_trip_reset(void) {
+    gamma_seq_reset(&trip_seq);
+}
+
+void mode_gamma_sequential_trip_update(const mode_context_t *context) {
+    gamma_seq_update(&trip_seq, context);
+}
+
+void mode_gamma_sequential_trip_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ev;
+    (void)ts_ms;
+    gamma_seq_on_mod(&trip_seq);
+}
+
+/* Mode 24 — MOD fires 1A+6B, then each F1 one mirrored pair until 6A+1B. */
+void mode_gamma_sequential_fire_init(void) {
+    mode_gamma_sequential_fire_reset();
+}
+
+void mode_gamma_sequential_fire_update(const mode_context_t *context) {
+    gamma_seq_update(&fire_seq, context);
+}
+
+void mode_gamma_sequential_fire_reset(void) {
+    gamma_seq_reset(&fire_seq);
+}
+
+void mode_gamma_sequential_fire_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ts_ms;
+    if (ev != MOD_PRESS_EVENT_SINGLE) {
+        return;
+    }
+    gamma_seq_on_mod(&fire_seq);
+}
@@ -12,10 +12,12 @@ static const jack_output_t BOUNCE_JACK[BOUNCE_CH] = {
     JACK_OUT_1A, JACK_OUT_2A, JACK_OUT_3A, JACK_OUT_4A, JACK_OUT_5A, JACK_OUT_6A,
     JACK_OUT_1B, JACK_OUT_2B, JACK_OUT_3B, JACK_OUT_4B, JACK_OUT_5B, JACK_OUT_6B
 };
+#define BOUNCE_ALL_MASK ((1u << (JACK_OUT_6B + 1)) - 1u) /* 1A…6B */
 
-/** Per-output absolute fire times from scene t0 (pulse 0 at t0). */
+/** Per-output absolute fire times (io_now_us) from scene t0 (pulse 0 at t0). */
 static uint32_t bnc_abs[BOUNCE_CH][BOUNCE_PULSES];
-static uint8_t bnc_next[BOUNCE_CH]; /* next pulse index to fire (1..5); 6 = done */
+static uint8_t bnc_next[BOUNCE_CH]; /* next pulse index to queue (1..5); 6 = done */
+static uint32_t bnc_refill_us;      /* earliest queued pulse; nothing to do before it */
 static bool bounce_active;
 
 static uint32_t lerp_u32(uint32_t a, uint32_t b, uint8_t step, uint8_t max_step) {
@@ -68,20 +70,51 @@ static void bounce_build_row(uint8_t idx, uint32_t t0) {
         bounce_decel_gaps_ms((uint8_t)(idx - 6u), gaps);
     }
     for (int k = 0; k < 5; k++) {
-        t += gaps[k];
+        t += gaps[k] * 1000u;
         bnc_abs[idx][(uint8_t)(k + 1)] = t;
     }
 }
 
+/**
+ * Each output keeps exactly one pulse in the pulse timer queue: once the queued one has risen,
+ * the next is handed over with io_trigger_at(). bnc_refill_us tracks the earliest queued pulse
+ * so the update loop is a single compare until then.
+ */
+static void bounce_refill(uint32_t now) {
+    bool any = false;
+    bool have_refill = false;
+    uint32_t refill = 0u;
+    for (uint8_t i = 0u; i < BOUNCE_CH; i++) {
+        uint8_t k = bnc_next[i];
+        if (k >= BOUNCE_PULSES) {
+            continue;
+        }
+        any = true;
+        if ((int32_t)(now - bnc_abs[i][k - 1u]) >= 0 && !io_trigger_pending(BOUNCE_JACK[i])) {
+            io_trigger_at(BOUNCE_JACK[i], bnc_abs[i][k]);
+            bnc_next[i] = ++k;
+            if (k >= BOUNCE_PULSES) {
+                continue;
+            }
+        }
+        uint32_t due = bnc_abs[i][k - 1u];
+        if (!have_refill || (int32_t)(due - refill) < 0) {
+            refill = due;
+            have_refill = true;
+        }
+    }
+    bnc_refill_us = refill;
+    bounce_active = any && have_refill;
+}
+
 static void bounce_arm(uint32_t t0) {
     for (uint8_t i = 0u; i < BOUNCE_CH; i++) {
         bounce_build_row(i, t0);
         bnc_next[i] = 1u;
     }
-    for (uint8_t i = 0u; i < BOUNCE_CH; i++) {
-        set_output_high_for_duration(BOUNCE_JACK[i], DEFAULT_PULSE_DURATION_MS);
-    }
+    io_trigger_mask(BOUNCE_ALL_MASK); /* Pulse 0 on all twelve rows at once */
     bounce_active = true;
+    bounce_refill(t0);
 }
 
 void mode_gamma_sequential_bounce_init(void) {
@@ -93,21 +126,19 @@ void mode_gamma_sequential_bounce_update(const mode_context_t *context) {
     if (!bounce_active) {
         return;
     }
-    uint32_t now = millis();
-    bool any = false;
-    for (uint8_t i = 0u; i < BOUNCE_CH; i++) {
-        if (bnc_next[i] >= BOUNCE_PULSES) {
-            continue;
-        }
-        any = true;
-        if (now >= bnc_abs[i][bnc_next[i]]) {
-            set_output_high_for_duration(BOUNCE_JACK[i], DEFAULT_PULSE_DURATION_MS);
-            bnc_next[i]++;
-        }
+    uint32_t now = io_now_us();
+    if ((int32_t)(now - bnc_refill_us) < 0) {
+        return;
     }
-    if (!any) {
-        bounce_active = false;
+    bounce_refill(now);
+}
+
+uint32_t mode_gamma_sequential_bounce_next_wake_us(uint32_t now_us) {
+    if (!bounce_active) {
+        return MODE_WAKE_ON_F1; /* Idle until the next MOD */
     }
+    int32_t left = (int32_t)(bnc_refill_us - now_us);
+    return (left > 0) ? (uint32_t)left : MODE_WAKE_NOW;
 }
 
 void mode_gamma_sequential_bounce_reset(void) {
@@ -125,5 +156,5 @@ void mode_gamma_sequential_bounce_on_mod_press(mod_press_event_t ev, uint32_t ts
     if (ev != MOD_PRESS_EVENT_SINGLE) {
         return;
     }
-    bounce_arm(millis());
+    bounce_arm(io_now_us());
 }
@@ -107,11 +107,11 @@ void mode_logic_update(const mode_context_t *context) {
 
         // Trigger A output only on rising edge
         if (current_a_state && !prev_output_a_state[i]) {
-            set_output_high_for_duration(JACK_OUT_A[i], DEFAULT_PULSE_DURATION_MS);
+            io_trigger(JACK_OUT_A[i]);
         }
         // Trigger B output only on rising edge
         if (current_b_state && !prev_output_b_state[i]) {
-            set_output_high_for_duration(JACK_OUT_B[i], DEFAULT_PULSE_DURATION_MS);
+            io_trigger(JACK_OUT_B[i]);
         }
 
         // Update previous state for next tick's comparison
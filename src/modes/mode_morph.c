@@ -13,9 +13,12 @@ static uint16_t patterns_b[MODE_RHYTHM_NUM_OUTPUTS];
 static uint16_t morphed_patterns[MODE_RHYTHM_NUM_OUTPUTS];
 static bool morph_frozen;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static uint32_t morph_generation;
 static calculation_mode_t s_calc;
+static uint16_t next_patterns[MODE_RHYTHM_NUM_OUTPUTS]; /* Next generation, played by the back bar */
+static mode_rhythm_bars_t bars;
+static bool bar_dirty = true; /* morphed_patterns changed since the bar was built */
 
 static uint32_t morph_step_rng(uint32_t x) {
     x ^= x << 13;
@@ -31,9 +34,12 @@ static void load_base_from_calc(void) {
         patterns_b[i] = patterns_a[i];
         morphed_patterns[i] = patterns_a[i];
     }
+    bar_dirty = true;
+    bars.back_ready = false;
 }
 
-static void morph_generate_next(void) {
+/* Generation morph_generation + 1 from the current one, into `out`; no state changes. */
+static void morph_generate(uint16_t *out) {
     static const uint32_t primes[MODE_RHYTHM_NUM_OUTPUTS] = {
         2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u
     };
@@ -62,21 +68,37 @@ static void morph_generate_next(void) {
             next &= (uint16_t)~(1u << anchor);
         }
 
-        patterns_b[oi] = next;
-        morphed_patterns[oi] = next;
+        out[oi] = next;
     }
+}
+
+static void morph_commit(const uint16_t *next) {
+    memcpy(patterns_b, next, sizeof patterns_b);
+    memcpy(morphed_patterns, next, sizeof morphed_patterns);
     morph_generation++;
+    bars.back_ready = false;
+}
+
+static void morph_generate_next(void) {
+    morph_generate(next_patterns);
+    morph_commit(next_patterns);
+    bar_dirty = true;
+}
+
+static void prepare_next_bar(void) {
+    morph_generate(next_patterns);
+    mode_rhythm_bar_build(mode_rhythm_bars_back(&bars), next_patterns);
+    bars.back_ready = true;
 }
 
 void mode_morph_init(void) {
     mode_morph_reset();
-    next_step_time = 0;
 }
 
 void mode_morph_reset(void) {
     morph_frozen = false;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     morph_generation = 0;
     s_calc = CALC_MODE_NORMAL;
     load_base_from_calc();
@@ -88,6 +110,11 @@ void mode_morph_reset(void) {
 
 void mode_morph_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_morph_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_morph_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -108,7 +135,9 @@ void mode_morph_set_state(bool frozen, uint32_t generation, const uint16_t *morp
     if (morphed) {
         memcpy(morphed_patterns, morphed, sizeof morphed_patterns);
         memcpy(patterns_b, morphed, sizeof patterns_b);
+        bar_dirty = true;
     }
+    bars.back_ready = false;
 }
 
 void mode_morph_get_state(bool *frozen, uint32_t *generation, uint16_t *morphed) {
@@ -132,38 +161,36 @@ void mode_morph_update(const mode_context_t *context) {
         load_base_from_calc();
     }
 
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
+        /* Generate the next bar in idle time, off the downbeat. */
+        if (!morph_frozen && !bars.back_ready) {
+            prepare_next_bar();
+        }
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    if (!morph_frozen && current_step == 0) {
-        morph_generate_next();
-    }
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t pattern = morphed_patterns[i];
-        if ((pattern >> current_step) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
+    if (!morph_frozen && step_clock.bar_start) {
+        if (!bars.back_ready) {
+            prepare_next_bar();
         }
-    }
+        morph_commit(next_patterns);
+        mode_rhythm_bars_swap(&bars);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    } else if (bar_dirty) {
+        mode_rhythm_bar_build(&bars.bar[bars.front], morphed_patterns);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    }
+    mode_rhythm_bar_play(mode_rhythm_bars_front(&bars), current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
+uint32_t mode_morph_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    if (!morph_frozen && !bars.back_ready) {
+        return MODE_WAKE_NOW; /* Next bar still to generate */
     }
+    return mode_step_clock_next_wake_us(&step_clock);
 }
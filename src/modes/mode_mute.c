@@ -13,8 +13,10 @@ static uint16_t variation_mask[MODE_RHYTHM_NUM_OUTPUTS];
 static uint8_t mute_count;
 static bool mute_ramp_up;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
 
 static int pick_random_index_by_state(bool want_muted) {
     uint8_t count = 0;
@@ -39,9 +41,28 @@ static int pick_random_index_by_state(bool want_muted) {
     return -1;
 }
 
+/* Base XOR variation, then the muted tracks cleared. */
+static void build_bar(void) {
+    uint16_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    uint16_t muted_tracks = 0;
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        tracks[i] = mode_rhythm_base_pattern(s_calc, i);
+        if (muted[i]) {
+            muted_tracks |= (uint16_t)(1u << i);
+        }
+    }
+    const mode_rhythm_xf_t stages[] = {
+        { MODE_RHYTHM_XF_XOR, 0, MODE_RHYTHM_ALL_TRACKS, variation_mask, NULL },
+        { MODE_RHYTHM_XF_CLEAR, 0, muted_tracks, NULL, NULL },
+    };
+    mode_rhythm_xf_apply(tracks, stages, 2);
+    mode_rhythm_bar_build(&bar, tracks);
+    mode_step_clock_follow(&step_clock, &bar);
+    bar_dirty = false;
+}
+
 void mode_mute_init(void) {
     mode_mute_reset();
-    next_step_time = 0;
 }
 
 void mode_mute_reset(void) {
@@ -50,14 +71,20 @@ void mode_mute_reset(void) {
     mute_count = 0;
     mute_ramp_up = true;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         set_output(mode_rhythm_jacks[i], false);
     }
+    bar_dirty = true;
 }
 
 void mode_mute_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_mute_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_mute_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -89,6 +116,7 @@ void mode_mute_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
             mute_ramp_up = true;
         }
     }
+    bar_dirty = true;
 }
 
 void mode_mute_set_state(uint16_t muted_mask, uint8_t count, bool ramp_up, const uint16_t *variation) {
@@ -109,6 +137,7 @@ void mode_mute_set_state(uint16_t muted_mask, uint8_t count, bool ramp_up, const
     } else {
         memset(variation_mask, 0, sizeof variation_mask);
     }
+    bar_dirty = true;
 }
 
 void mode_mute_get_state(uint16_t *muted_mask, uint8_t *count, bool *ramp_up, uint16_t *variation) {
@@ -133,38 +162,23 @@ void mode_mute_update(const mode_context_t *context) {
     if (context->sync_request) {
         mode_mute_reset_step();
     }
-
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
+    if (context->calc_mode_changed) {
+        bar_dirty = true;
     }
 
-    if (next_step_time == 0) {
-        next_step_time = now;
-    }
-
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        if (muted[i]) {
-            continue;
-        }
-        uint16_t base = mode_rhythm_base_pattern(s_calc, i) ^ variation_mask[i];
-        if ((base >> current_step) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
-        }
+    if (bar_dirty) {
+        build_bar();
     }
+    mode_rhythm_bar_play(&bar, current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
-    }
+uint32_t mode_mute_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -7,8 +7,6 @@
 #include "main_constants.h"
 #include <stdint.h>
 #include <stdbool.h>
-#include <math.h> // For fabsf if needed, or just manual calc
-#include <limits.h> // For UINT32_MAX
 #include <string.h> // For memset
 
 #define NUM_PHASING_OUTPUTS 5 // Outputs 2-6
@@ -28,26 +26,36 @@ static const uint16_t output_factors[NUM_PHASING_OUTPUTS][2] = {
     {3, 1}  // Output 6: Triple interval (1/3 speed)
 };
 
-// Frequency offsets in BPM for Group B
-static const float delta_f_values_bpm[NUM_DELTA_LEVELS] = {
-    0.1f,  // Small offset
-    1.0f,  // Medium offset
-    5.0f   // Large offset
+// Frequency offsets for Group B in milli-BPM (0.1, 1 and 5 BPM)
+static const uint32_t delta_f_values_mbpm[NUM_DELTA_LEVELS] = {
+    100u,  // Small offset
+    1000u, // Medium offset
+    5000u  // Large offset
 };
 
-// --- State ---
-typedef struct {
-    uint32_t ms_counter;         // Accumulator for time towards next trigger
-    uint32_t pulse_ms_remaining; // How many ms left for the current pulse
-} phasing_output_state_t;
+// Phase accumulators cover one output period in 2^64 steps and advance per microsecond of the
+// TIM5 timebase, so a 0.1 BPM offset is represented to ~1e-14 and the A/B drift stays exact.
+// Elapsed time is applied in slices short enough that no output can wrap twice in one slice
+// (fastest output: MIN_INTERVAL / 3 = 11 ms).
+#define PHASING_MAX_SLICE_US 5000u
+#define PHASING_US_PER_MINUTE_MBPM 60000000000ull // 1 BPM = 1 beat / 60e6 us, in milli-BPM
 
-static phasing_output_state_t state_a[NUM_PHASING_OUTPUTS];
-static phasing_output_state_t state_b[NUM_PHASING_OUTPUTS];
+// --- State ---
+static uint64_t phase_a[NUM_PHASING_OUTPUTS];
+static uint64_t phase_b[NUM_PHASING_OUTPUTS];
 static uint8_t current_delta_level = 0;
+static uint32_t last_update_us = 0;
+
+// Per-output increments (2^-64 cycle per us), rebuilt only when the tempo (timing generation) or
+// delta level changes; Group B is Group A plus the exact delta term
+static uint64_t phase_inc_a[NUM_PHASING_OUTPUTS];
+static uint64_t phase_inc_b[NUM_PHASING_OUTPUTS];
+static uint32_t increments_generation = 0; // 0 = not built
+static uint8_t increments_delta_level = 0;
 
 // --- Forward Declarations of Static Helpers ---
-static void update_phasing_output(jack_output_t pin, phasing_output_state_t* state, uint32_t target_interval, uint32_t pulse_duration, uint32_t ms_elapsed);
-static uint32_t calculate_derived_interval(uint32_t base_interval, uint16_t multiplier, uint16_t divisor);
+static void refresh_phase_increments(const mode_timing_t *timing);
+static void advance_phases(uint32_t elapsed_us);
 
 // --- Initialization ---
 void mode_phasing_init(void) {
@@ -60,8 +68,7 @@ void mode_phasing_update(const mode_context_t* context) {
     // Handle Calculation Mode change (cycles through delta levels for Group B)
     if (context->calc_mode_changed) {
         current_delta_level = (current_delta_level + 1) % NUM_DELTA_LEVELS;
-        // Optional: Reset counters on delta change?
-        // mode_phasing_reset(); // Might be too abrupt, let's recalculate intervals only.
+        // Phases are kept; only Group B's increment changes.
     }
 
     // Handle Sync Request (e.g., mode change)
@@ -70,55 +77,19 @@ void mode_phasing_update(const mode_context_t* context) {
         // No need to return, update logic below will run with reset state
     }
 
-    // --- Calculate Base Intervals --- 
-    uint32_t base_interval_a_ms = 0;
-    uint32_t base_interval_b_ms = 0;
-
-    if (context->current_tempo_interval_ms == 0) { // Avoid division by zero
-        // Keep intervals at 0 if tempo is invalid/zero
-    } else {
-        // Group A interval is the main tempo interval
-        base_interval_a_ms = context->current_tempo_interval_ms;
-        if (base_interval_a_ms < MIN_INTERVAL) base_interval_a_ms = MIN_INTERVAL;
-        if (base_interval_a_ms > MAX_INTERVAL) base_interval_a_ms = MAX_INTERVAL;
-
-        // Calculate Group B base interval based on frequency offset
-        float f_a_bpm = 60000.0f / (float)context->current_tempo_interval_ms;
-        float f_b_bpm = f_a_bpm + delta_f_values_bpm[current_delta_level];
-
-        if (f_b_bpm <= 0.0f) {
-            base_interval_b_ms = UINT32_MAX; // Stop clock B if frequency is zero/negative
-        } else {
-            base_interval_b_ms = (uint32_t)(60000.0f / f_b_bpm);
-        }
-
-        if (base_interval_b_ms < MIN_INTERVAL) base_interval_b_ms = MIN_INTERVAL;
-        if (base_interval_b_ms > MAX_INTERVAL) base_interval_b_ms = MAX_INTERVAL;
-    }
-
-    // --- Update each output --- 
-    uint32_t ms_elapsed = context->ms_since_last_call;
+    refresh_phase_increments(context->timing);
 
-    for (int i = 0; i < NUM_PHASING_OUTPUTS; ++i) {
-        // Calculate target interval for this specific output (A and B)
-        uint16_t multiplier = output_factors[i][0];
-        uint16_t divisor    = output_factors[i][1];
-
-        uint32_t target_interval_a = calculate_derived_interval(base_interval_a_ms, multiplier, divisor);
-        uint32_t target_interval_b = calculate_derived_interval(base_interval_b_ms, multiplier, divisor);
-
-        // Update state machine for output A
-        update_phasing_output(group_a_pins[i], &state_a[i], target_interval_a, DEFAULT_PULSE_DURATION_MS, ms_elapsed);
-        
-        // Update state machine for output B
-        update_phasing_output(group_b_pins[i], &state_b[i], target_interval_b, DEFAULT_PULSE_DURATION_MS, ms_elapsed);
-    }
+    uint32_t now_us = io_now_us();
+    uint32_t elapsed_us = now_us - last_update_us;
+    last_update_us = now_us;
+    advance_phases(elapsed_us);
 }
 
 // --- Reset Function ---
 void mode_phasing_reset(void) {
-    memset(state_a, 0, sizeof(state_a));
-    memset(state_b, 0, sizeof(state_b));
+    memset(phase_a, 0, sizeof(phase_a));
+    memset(phase_b, 0, sizeof(phase_b));
+    last_update_us = io_now_us();
     for (int i = 0; i < NUM_PHASING_OUTPUTS; ++i) {
         set_output(group_a_pins[i], false);
         set_output(group_b_pins[i], false);
@@ -128,65 +99,50 @@ void mode_phasing_reset(void) {
 // --- Static Helper Functions ---
 
 /**
- * @brief Calculates a derived interval based on a base interval and factors.
- */
-static uint32_t calculate_derived_interval(uint32_t base_interval, uint16_t multiplier, uint16_t divisor) {
-    if (base_interval == 0 || base_interval == UINT32_MAX || divisor == 0) {
-        return UINT32_MAX; // Treat 0 or max base interval, or div by zero as invalid
-    }
-    uint64_t result = ((uint64_t)base_interval * multiplier) / divisor;
-    if (result > MAX_INTERVAL) return MAX_INTERVAL;
-    // If result is less than minimum pulse width, make it effectively immediate but valid
-    if (result < MIN_INTERVAL) return MIN_INTERVAL; 
-    return (uint32_t)result;
-}
-
-/**
- * @brief Updates the state for a single phasing output.
- * Manages the ms counter, triggers output on interval completion, and handles pulse timing.
+ * @brief Rebuilds the A/B phase increments from the Clock Manager's timing table.
+ * Output period = T * multiplier / divisor, so the increment is 2^64 * divisor / (multiplier * T_us);
+ * Group B adds 2^64 * divisor * delta_mbpm / (multiplier * 60e9).
  */
-static void update_phasing_output(jack_output_t pin, phasing_output_state_t* state, uint32_t target_interval, uint32_t pulse_duration, uint32_t ms_elapsed) {
-    
-    // Handle invalid interval - ensure output is off
-    if (target_interval == UINT32_MAX || target_interval == 0) {
-        if (state->pulse_ms_remaining > 0) { // If it was mid-pulse
-             state->pulse_ms_remaining = 0;
-             set_output(pin, false);
-        }
-        state->ms_counter = 0; // Reset counter
+static void refresh_phase_increments(const mode_timing_t *timing) {
+    if (increments_generation == timing->generation && increments_delta_level == current_delta_level) {
         return;
     }
-    
-    // Decrement remaining pulse time if active
-    if (state->pulse_ms_remaining > 0) {
-        if (ms_elapsed >= state->pulse_ms_remaining) {
-            state->pulse_ms_remaining = 0;
-            set_output(pin, false);
-        } else {
-            state->pulse_ms_remaining -= ms_elapsed;
+    increments_generation = timing->generation;
+    increments_delta_level = current_delta_level;
+
+    for (int i = 0; i < NUM_PHASING_OUTPUTS; ++i) {
+        uint64_t multiplier = output_factors[i][0];
+        uint64_t divisor    = output_factors[i][1];
+        if (timing->interval_ms == 0) { // No tempo: hold every output
+            phase_inc_a[i] = 0;
+            phase_inc_b[i] = 0;
+            continue;
         }
+        uint64_t period_den = multiplier * (uint64_t)timing->clamped_ms * 1000u;
+        uint64_t delta_den = multiplier * PHASING_US_PER_MINUTE_MBPM;
+        phase_inc_a[i] = (UINT64_MAX / period_den) * divisor;
+        phase_inc_b[i] = phase_inc_a[i] + (UINT64_MAX / delta_den) * divisor * delta_f_values_mbpm[current_delta_level];
     }
+}
 
-    // Increment the time counter
-    state->ms_counter += ms_elapsed;
-
-    // Check if the target interval is reached
-    if (state->ms_counter >= target_interval) {
-        // Trigger only if not already pulsing
-        if (state->pulse_ms_remaining == 0) {
-            set_output(pin, true);
-            // Ensure pulse duration isn't longer than the interval itself
-            uint32_t actual_pulse_duration = (pulse_duration >= target_interval && target_interval > 0) ? target_interval -1 : pulse_duration;
-             if (actual_pulse_duration == 0) actual_pulse_duration = 1; // Minimum 1ms pulse if interval allows
-            state->pulse_ms_remaining = actual_pulse_duration;
+/**
+ * @brief Advances every accumulator by elapsed_us and triggers the outputs that wrapped.
+ */
+static void advance_phases(uint32_t elapsed_us) {
+    while (elapsed_us > 0) {
+        uint32_t slice = (elapsed_us > PHASING_MAX_SLICE_US) ? PHASING_MAX_SLICE_US : elapsed_us;
+        elapsed_us -= slice;
+        for (int i = 0; i < NUM_PHASING_OUTPUTS; ++i) {
+            uint64_t prev = phase_a[i];
+            phase_a[i] += phase_inc_a[i] * slice;
+            if (phase_a[i] < prev) {
+                io_trigger(group_a_pins[i]);
+            }
+            prev = phase_b[i];
+            phase_b[i] += phase_inc_b[i] * slice;
+            if (phase_b[i] < prev) {
+                io_trigger(group_b_pins[i]);
+            }
         }
-        // Subtract the interval period from the counter (prevents drift)
-        // Use modulo if counter could exceed 2*interval?
-        // Safer to subtract for now.
-         state->ms_counter -= target_interval; 
-         // Clamp counter to 0 if subtraction resulted in negative (shouldn't happen with unsigned)
-         // if (state->ms_counter > target_interval) { // Check for potential wrap-around? No, unsigned subtraction handles this.
-         //    state->ms_counter = 0;
-        // }
     }
 }
@@ -2,10 +2,10 @@
 #include "drivers/io.h"
 // #include "../status_led.h" // <<< Removed debug include
 #include "modes.h"
+#include "mode_ratio_shared.h"
 #include "main_constants.h"
 
-#include <string.h> // For memset
-#include <stdint.h> // For uint8_t, uint32_t, uint64_t
+#include <stdint.h> // For uint8_t, uint32_t
 #include <stdbool.h> // For bool
 
 // --- Configuration ---
@@ -13,7 +13,8 @@
 #define NUM_POLY_OUTPUTS 4 // Outputs 2-5 per group generate polyrhythms
                            // Outputs 6A/6B are sums
 
-// Define the X (Output Beats) and Y (Base Beats) for outputs 2-5
+// Define the X (Output Beats) and Y (Base Beats) for outputs 2-5: X pulses every Y beats,
+// realigned with F1 at the start of every Y-beat cycle
 // Set A (Defaults for Group A outputs 2A-5A)
 static const uint8_t poly_x_setA[NUM_POLY_OUTPUTS] = { 3, 4, 5, 7 };
 static const uint8_t poly_y_setA[NUM_POLY_OUTPUTS] = { 2, 2, 3, 4 };
@@ -23,50 +24,45 @@ static const uint8_t poly_x_setB[NUM_POLY_OUTPUTS] = { 5, 7, 6, 11 };
 static const uint8_t poly_y_setB[NUM_POLY_OUTPUTS] = { 2, 3, 4,  4 };
 
 // --- Module State ---
-static uint32_t next_trigger_time[NUM_JACK_OUTPUTS]; // Store scheduled ON times for poly outputs 2-5
-static uint32_t output_off_times[NUM_JACK_OUTPUTS];  // Store scheduled OFF times for all outputs (1-6)
+static mode_ratio_clock_t poly_clocks[NUM_JACK_OUTPUTS]; // Used for outputs 2-5 of each group
+static uint32_t beat_index = 0; // F1 edges since the last sync
 
 // --- Mode Interface Functions ---
 
 void mode_polyrhythm_init(void) {
     // status_led_set_override(true, false); // <<< Removed debug
-    memset(next_trigger_time, 0, sizeof(next_trigger_time));
-    memset(output_off_times, 0, sizeof(output_off_times));
+    for (int pin = 0; pin < NUM_JACK_OUTPUTS; pin++) {
+        mode_ratio_clock_reset(&poly_clocks[pin]);
+    }
+    beat_index = 0;
     // Reset should handle turning pins off
     // status_led_set_override(true, true); // <<< Removed debug
 }
 
-void mode_polyrhythm_update(const mode_context_t* context) {
-    uint32_t current_time = context->current_time_ms;
-    uint32_t tempo_interval = context->current_tempo_interval_ms; // Fixed field name
-
-    // --- Check for scheduled OFF events ---
-    for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
-        // Simplified check: pin >= JACK_OUT_1A is always true
-        if ((pin <= JACK_OUT_6A) || (pin >= JACK_OUT_1B && pin <= JACK_OUT_6B)) {
-            if (output_off_times[pin] != 0 && current_time >= output_off_times[pin]) {
-                set_output(pin, false);
-                output_off_times[pin] = 0;
-            }
+// Polls one group's outputs 2-5; returns true if any of them fired (drives the sum output 6)
+static bool update_group(jack_output_t first_pin, const uint8_t *x, const uint8_t *y,
+                         const mode_context_t* context) {
+    bool any = false;
+    for (int index = 0; index < NUM_POLY_OUTPUTS; index++) {
+        jack_output_t pin = (jack_output_t)(first_pin + index);
+        if (context->f1_rising_edge) {
+            mode_ratio_clock_on_beat(&poly_clocks[pin], beat_index, y[index], context->current_time_ms);
+        }
+        if (mode_ratio_clock_poll(&poly_clocks[pin], x[index], y[index],
+                                  context->timing, context->current_time_ms)) {
+            io_trigger(pin);
+            any = true;
         }
     }
+    return any;
+}
 
-    // --- Trigger events for 1A/1B on F1 Tick ---
-    if (context->f1_rising_edge) { // Fixed field name
-         if (output_off_times[JACK_OUT_1A] == 0) {
-            set_output(JACK_OUT_1A, true);
-            output_off_times[JACK_OUT_1A] = current_time + DEFAULT_PULSE_DURATION_MS;
-         }
-         if (output_off_times[JACK_OUT_1B] == 0) {
-            set_output(JACK_OUT_1B, true);
-            output_off_times[JACK_OUT_1B] = current_time + DEFAULT_PULSE_DURATION_MS;
-         }
+void mode_polyrhythm_update(const mode_context_t* context) {
+    // 1A/1B carry F1 from the clock manager
+    if (context->sync_request || context->calc_mode_changed) {
+        mode_polyrhythm_init(); // New ratio sets or phase reset: relock on the next cycle boundary
     }
 
-    // --- Trigger Polyrhythm Outputs (2-5) and Sum Outputs (6) ---
-    bool trigger_6a = false;
-    bool trigger_6b = false;
-
     // Assign ratio sets based on calculation mode
     const uint8_t *active_x_a, *active_y_a, *active_x_b, *active_y_b;
     if (context->calc_mode == CALC_MODE_NORMAL) {
@@ -77,81 +73,20 @@ void mode_polyrhythm_update(const mode_context_t* context) {
         active_x_b = poly_x_setA; active_y_b = poly_y_setA;
     }
 
-    // Group A outputs (2A-5A)
-    for (jack_output_t pin = JACK_OUT_2A; pin <= JACK_OUT_5A; ++pin) {
-        int index = pin - JACK_OUT_2A;
-        if (index < 0 || index >= NUM_POLY_OUTPUTS) continue;
-
-        uint8_t X = active_x_a[index];
-        uint8_t Y = active_y_a[index];
-        if (X == 0) continue; 
-
-        // Use 32-bit calculation (potential overflow)
-        uint32_t output_interval = (Y * tempo_interval) / X;
-        if (output_interval == 0) output_interval = 1;
-
-        if (next_trigger_time[pin] == 0 || current_time >= next_trigger_time[pin]) {
-             if (output_off_times[pin] == 0) { 
-                set_output(pin, true);
-                output_off_times[pin] = current_time + DEFAULT_PULSE_DURATION_MS;
-                trigger_6a = true;
-                uint32_t scheduled_on_time = (next_trigger_time[pin] == 0) ? current_time : next_trigger_time[pin];
-                next_trigger_time[pin] = scheduled_on_time + output_interval;
-             } else {
-                 if (next_trigger_time[pin] != 0) { 
-                     next_trigger_time[pin] += output_interval;
-                 } else {
-                     next_trigger_time[pin] = current_time + output_interval; 
-                 }
-             }
-        }
-    }
-
-    // Group B outputs (2B-5B)
-    for (jack_output_t pin = JACK_OUT_2B; pin <= JACK_OUT_5B; ++pin) {
-        int index = pin - JACK_OUT_2B;
-        if (index < 0 || index >= NUM_POLY_OUTPUTS) continue;
-
-        uint8_t X = active_x_b[index];
-        uint8_t Y = active_y_b[index];
-        if (X == 0) continue;
-
-        // Use 32-bit calculation (potential overflow for slow tempos)
-        uint32_t temp_interval = (uint32_t)Y * tempo_interval;
-        uint32_t output_interval = temp_interval / X;
-         if (output_interval == 0) output_interval = 1; 
-
-        if (next_trigger_time[pin] == 0 || current_time >= next_trigger_time[pin]) {
-             if (output_off_times[pin] == 0) { 
-                set_output(pin, true);
-                output_off_times[pin] = current_time + DEFAULT_PULSE_DURATION_MS;
-                trigger_6b = true;
-                uint32_t scheduled_on_time = (next_trigger_time[pin] == 0) ? current_time : next_trigger_time[pin];
-                next_trigger_time[pin] = scheduled_on_time + output_interval;
-             } else {
-                 if (next_trigger_time[pin] != 0) { 
-                     next_trigger_time[pin] += output_interval;
-                 } else {
-                     next_trigger_time[pin] = current_time + output_interval; 
-                 }
-             }
-        }
+    // Polyrhythm outputs (2-5) and their sums (6)
+    if (update_group(JACK_OUT_2A, active_x_a, active_y_a, context)) {
+        io_trigger(JACK_OUT_6A);
     }
-    
-    // Trigger Sum Outputs (6A / 6B)
-    if (trigger_6a && output_off_times[JACK_OUT_6A] == 0) {
-        set_output(JACK_OUT_6A, true);
-        output_off_times[JACK_OUT_6A] = current_time + DEFAULT_PULSE_DURATION_MS;
+    if (update_group(JACK_OUT_2B, active_x_b, active_y_b, context)) {
+        io_trigger(JACK_OUT_6B);
     }
-    if (trigger_6b && output_off_times[JACK_OUT_6B] == 0) {
-        set_output(JACK_OUT_6B, true);
-        output_off_times[JACK_OUT_6B] = current_time + DEFAULT_PULSE_DURATION_MS;
+    if (context->f1_rising_edge) {
+        beat_index++;
     }
 }
 
 void mode_polyrhythm_reset(void) {
-    memset(next_trigger_time, 0, sizeof(next_trigger_time));
-    memset(output_off_times, 0, sizeof(output_off_times));
+    mode_polyrhythm_init();
     for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
          // Simplified check: pin >= JACK_OUT_1A is always true
          if ((pin <= JACK_OUT_6A) || (pin >= JACK_OUT_1B && pin <= JACK_OUT_6B)) {
@@ -159,3 +94,9 @@ void mode_polyrhythm_reset(void) {
         }
     }
 }
+
+void mode_polyrhythm_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    for (int pin = 0; pin < NUM_JACK_OUTPUTS; pin++) {
+        mode_ratio_clock_rescale(&poly_clocks[pin], now_ms, old_interval_ms, new_interval_ms);
+    }
+}
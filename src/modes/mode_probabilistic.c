@@ -61,7 +61,7 @@ void mode_probabilistic_update(const mode_context_t* context) {
         // Generate a random float between 0.0 and 1.0
         float random_val = (float)rand() / (float)RAND_MAX;
         if (random_val < current_probs_a[i]) {
-            set_output_high_for_duration(group_a_jacks[i], DEFAULT_PULSE_DURATION_MS); // Use central constant
+            io_trigger(group_a_jacks[i]);
         }
     }
 
@@ -69,7 +69,7 @@ void mode_probabilistic_update(const mode_context_t* context) {
     for (int i = 0; i < NUM_PROB_OUTPUTS; i++) {
         float random_val = (float)rand() / (float)RAND_MAX;
         if (random_val < current_probs_b[i]) {
-            set_output_high_for_duration(group_b_jacks[i], DEFAULT_PULSE_DURATION_MS); // Use central constant
+            io_trigger(group_b_jacks[i]);
         }
     }
 }
@@ -0,0 +1,60 @@
+#include "mode_ratio_shared.h"
+#include "modes.h"
+
+void mode_ratio_clock_reset(mode_ratio_clock_t *c) {
+    c->next_ms = 0;
+    c->step_ms = 0;
+    c->step_gen = 0;
+    c->step_rem = 0;
+    c->rem = 0;
+    c->k = 0;
+    c->armed = false;
+}
+
+void mode_ratio_clock_on_beat(mode_ratio_clock_t *c, uint32_t beat_index, uint8_t beats, uint32_t now_ms) {
+    if (beats == 0u || (beat_index % beats) != 0u) {
+        return;
+    }
+    // Relock: pulse 0 of the new cycle is this edge, whatever the previous cycle left behind
+    c->next_ms = now_ms;
+    c->rem = 0;
+    c->k = 0;
+    c->armed = true;
+}
+
+bool mode_ratio_clock_poll(mode_ratio_clock_t *c, uint8_t pulses, uint8_t beats,
+                           const mode_timing_t *timing, uint32_t now_ms) {
+    if (!c->armed || pulses == 0u || c->k >= pulses) {
+        return false;
+    }
+    if ((int32_t)(now_ms - c->next_ms) < 0) {
+        return false;
+    }
+    if (c->step_gen != timing->generation) {
+        // beats <= 255 and tempo <= MAX_INTERVAL keep the cycle length well inside 32 bits
+        uint32_t cycle_ms = (uint32_t)beats * timing->interval_ms;
+        c->step_ms = cycle_ms / pulses;
+        c->step_rem = (uint16_t)(cycle_ms % pulses);
+        c->step_gen = timing->generation;
+    }
+    uint32_t step = c->step_ms;
+    uint32_t step_rem = c->step_rem;
+    do {
+        c->k++;
+        c->next_ms += step;
+        c->rem = (uint16_t)(c->rem + step_rem);
+        if (c->rem >= pulses) {
+            c->rem = (uint16_t)(c->rem - pulses);
+            c->next_ms++;
+        }
+    } while (c->k < pulses && (int32_t)(now_ms - c->next_ms) >= 0);
+    return true;
+}
+
+void mode_ratio_clock_rescale(mode_ratio_clock_t *c, uint32_t now_ms,
+                              uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    if (!c->armed) {
+        return;
+    }
+    c->next_ms = mode_rescale_deadline(c->next_ms, now_ms, old_interval_ms, new_interval_ms);
+}
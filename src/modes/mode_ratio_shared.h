@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "modes.h" // mode_timing_t
+
+/*
+ * Exact rational clock: `pulses` evenly spaced triggers over `beats` F1 beats.
+ * Each cycle restarts on the F1 edge that begins it, and the pulse grid inside the cycle
+ * advances by (beats*T)/pulses with the remainder carried Bresenham-style, so the last step
+ * lands exactly on the next cycle's F1 edge and nothing drifts however long it runs.
+ */
+typedef struct {
+    uint32_t next_ms; // Due time of the next pulse in the current cycle
+    uint32_t step_ms; // (beats*T)/pulses for the tempo in step_gen
+    uint32_t step_gen; // mode_timing_t generation step_ms/step_rem were built for (0 = none)
+    uint16_t step_rem; // (beats*T)%pulses
+    uint16_t rem;     // Carried remainder, in 1/pulses ms
+    uint8_t k;        // Pulses already emitted in the current cycle
+    bool armed;       // False until the first cycle-starting F1 edge
+} mode_ratio_clock_t;
+
+void mode_ratio_clock_reset(mode_ratio_clock_t *c);
+
+/** Call on every F1 edge; starts a new cycle when beat_index is a multiple of `beats`. */
+void mode_ratio_clock_on_beat(mode_ratio_clock_t *c, uint32_t beat_index, uint8_t beats, uint32_t now_ms);
+
+/**
+ * True when a pulse is due at now_ms; several overdue pulses collapse into one.
+ * The step is divided out once per tempo (timing generation), not per pulse.
+ */
+bool mode_ratio_clock_poll(mode_ratio_clock_t *c, uint8_t pulses, uint8_t beats,
+                           const mode_timing_t *timing, uint32_t now_ms);
+
+/** Tempo-change hook: stretch the time left to the next pulse by new/old. */
+void mode_ratio_clock_rescale(mode_ratio_clock_t *c, uint32_t now_ms,
+                              uint32_t old_interval_ms, uint32_t new_interval_ms);
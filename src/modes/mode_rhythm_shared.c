@@ -1,5 +1,7 @@
 #include "mode_rhythm_shared.h"
 
+#include <stdlib.h>
+
 const jack_output_t mode_rhythm_jacks[MODE_RHYTHM_NUM_OUTPUTS] = {
     JACK_OUT_2A, JACK_OUT_2B, JACK_OUT_3A, JACK_OUT_3B,
     JACK_OUT_4A, JACK_OUT_4B, JACK_OUT_5A, JACK_OUT_5B,
@@ -31,3 +33,182 @@ uint16_t mode_rhythm_base_pattern(calculation_mode_t calc, int out_idx) {
     int bank = (calc == CALC_MODE_SWAPPED) ? 1 : 0;
     return g_rhythm_base[bank][out_idx];
 }
+
+void mode_step_clock_restart(mode_step_clock_t *c) {
+    c->beat_ms = 0;
+    c->interval_ms = 0;
+    c->wake = UINT64_MAX;
+    c->bar_steps = MODE_RHYTHM_BAR_STEPS;
+    c->beat_base = 0;
+    c->next_sub = MODE_RHYTHM_STEPS_PER_BEAT;
+    c->started = false;
+    c->bar_start = false;
+}
+
+void mode_step_clock_follow(mode_step_clock_t *c, const mode_rhythm_bar_t *bar) {
+    c->wake = bar->hits | 1u;
+    c->bar_steps = bar->length;
+}
+
+int mode_step_clock_update(mode_step_clock_t *c, const mode_context_t *context) {
+    uint32_t now = context->current_time_ms;
+    if (context->f1_rising_edge) {
+        const uint32_t beats_per_bar = c->bar_steps / MODE_RHYTHM_STEPS_PER_BEAT;
+        uint32_t beat = (context->f1_counter > 0u) ? (context->f1_counter - 1u) % beats_per_bar : 0u;
+        c->beat_ms = now;
+        c->beat_base = (uint8_t)(beat * MODE_RHYTHM_STEPS_PER_BEAT);
+        c->next_sub = 0;
+        c->started = true;
+    }
+    c->interval_ms = context->timing->valid ? context->timing->interval_ms : 0u;
+    if (!c->started || c->interval_ms == 0u || c->next_sub >= MODE_RHYTHM_STEPS_PER_BEAT) {
+        return -1;
+    }
+
+    /* Wake steps left in this beat, bit 0 = next_sub. */
+    uint64_t ahead = (c->wake >> (c->beat_base + c->next_sub)) &
+                     (UINT64_MAX >> (64u - (MODE_RHYTHM_STEPS_PER_BEAT - c->next_sub)));
+    if (ahead == 0u) {
+        c->next_sub = MODE_RHYTHM_STEPS_PER_BEAT; // Nothing to play until the next F1 edge
+        return -1;
+    }
+    uint32_t t = c->interval_ms;
+    uint8_t sub = (uint8_t)(c->next_sub + __builtin_ctzll(ahead));
+    if ((int32_t)(now - (c->beat_ms + (sub * t) / MODE_RHYTHM_STEPS_PER_BEAT)) < 0) {
+        return -1;
+    }
+    ahead &= ahead - 1u;
+    while (ahead != 0u) {
+        uint8_t later = (uint8_t)(c->next_sub + __builtin_ctzll(ahead));
+        if ((int32_t)(now - (c->beat_ms + (later * t) / MODE_RHYTHM_STEPS_PER_BEAT)) < 0) {
+            break;
+        }
+        sub = later;
+        ahead &= ahead - 1u;
+    }
+    c->bar_start = (c->beat_base == 0u && c->next_sub == 0u);
+    c->next_sub = (uint8_t)(sub + 1u);
+    return c->beat_base + sub;
+}
+
+uint32_t mode_step_clock_next_wake_us(const mode_step_clock_t *c) {
+    if (!c->started || c->interval_ms == 0u || c->next_sub >= MODE_RHYTHM_STEPS_PER_BEAT) {
+        return MODE_WAKE_ON_F1;
+    }
+    uint64_t ahead = (c->wake >> (c->beat_base + c->next_sub)) &
+                     (UINT64_MAX >> (64u - (MODE_RHYTHM_STEPS_PER_BEAT - c->next_sub)));
+    if (ahead == 0u) {
+        return MODE_WAKE_ON_F1;
+    }
+    uint8_t sub = (uint8_t)(c->next_sub + __builtin_ctzll(ahead));
+    int32_t left_ms = (int32_t)(c->beat_ms + (sub * c->interval_ms) / MODE_RHYTHM_STEPS_PER_BEAT - millis());
+    return (left_ms > 0) ? (uint32_t)left_ms * 1000u : MODE_WAKE_NOW;
+}
+
+void mode_step_clock_rescale(mode_step_clock_t *c, uint32_t now_ms,
+                             uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    c->interval_ms = new_interval_ms;
+    if (!c->started) {
+        return;
+    }
+    c->beat_ms = mode_rescale_elapsed(c->beat_ms, now_ms, old_interval_ms, new_interval_ms);
+}
+
+static uint16_t rotate_track(uint16_t t, uint8_t by) {
+    by &= (MODE_RHYTHM_BAR_STEPS - 1u);
+    if (by == 0u) {
+        return t;
+    }
+    return (uint16_t)((t >> by) | (t << (MODE_RHYTHM_BAR_STEPS - by)));
+}
+
+static uint16_t repeat_window(uint16_t t, uint8_t len) {
+    if (len == 0u || len >= MODE_RHYTHM_BAR_STEPS) {
+        return t;
+    }
+    uint16_t window = (uint16_t)(t & ((1u << len) - 1u));
+    uint16_t out = 0;
+    for (uint8_t s = 0; s < MODE_RHYTHM_BAR_STEPS; s = (uint8_t)(s + len)) {
+        out |= (uint16_t)(window << s);
+    }
+    return out;
+}
+
+/* Each set bit of `candidates` survives with `percent` % probability. */
+static uint16_t random_subset(uint16_t candidates, uint8_t percent) {
+    if (percent >= 100u) {
+        return candidates;
+    }
+    uint16_t out = 0;
+    while (candidates != 0u && percent > 0u) {
+        uint16_t bit = (uint16_t)(candidates & (uint16_t)(0u - candidates));
+        candidates &= (uint16_t)(candidates - 1u);
+        if ((uint8_t)(rand() % 100) < percent) {
+            out |= bit;
+        }
+    }
+    return out;
+}
+
+void mode_rhythm_xf_apply(uint16_t *tracks, const mode_rhythm_xf_t *stages, uint8_t count) {
+    for (uint8_t k = 0; k < count; k++) {
+        const mode_rhythm_xf_t *x = &stages[k];
+        for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+            if (!((x->tracks >> i) & 1u)) {
+                continue;
+            }
+            uint16_t t = tracks[i];
+            switch (x->op) {
+            case MODE_RHYTHM_XF_AND:    t &= x->masks[i]; break;
+            case MODE_RHYTHM_XF_OR:     t |= x->masks[i]; break;
+            case MODE_RHYTHM_XF_XOR:    t ^= x->masks[i]; break;
+            case MODE_RHYTHM_XF_CLEAR:  t = 0; break;
+            case MODE_RHYTHM_XF_ROTATE: t = rotate_track(t, x->amounts ? x->amounts[i] : x->amount); break;
+            case MODE_RHYTHM_XF_THIN:   t = random_subset(t, (uint8_t)(100u - (x->amount > 100u ? 100u : x->amount))); break;
+            case MODE_RHYTHM_XF_FILL:   t |= random_subset((uint16_t)~t, x->amount); break;
+            case MODE_RHYTHM_XF_REPEAT: t = repeat_window(t, x->amount); break;
+            }
+            tracks[i] = t;
+        }
+    }
+}
+
+void mode_rhythm_bar_build(mode_rhythm_bar_t *bar, const uint16_t *tracks) {
+    uint64_t wide[MODE_RHYTHM_NUM_OUTPUTS];
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        wide[i] = tracks[i];
+    }
+    mode_rhythm_bar_build_long(bar, wide, MODE_RHYTHM_BAR_STEPS);
+}
+
+void mode_rhythm_bar_build_long(mode_rhythm_bar_t *bar, const uint64_t *tracks, uint8_t length) {
+    if (length == 0u || length > MODE_RHYTHM_MAX_STEPS || (length % MODE_RHYTHM_STEPS_PER_BEAT) != 0u) {
+        length = MODE_RHYTHM_BAR_STEPS;
+    }
+    uint64_t in_bar = (length == MODE_RHYTHM_MAX_STEPS) ? UINT64_MAX : ((1ull << length) - 1u);
+    for (int s = 0; s < length; s++) {
+        bar->steps[s] = 0;
+    }
+    bar->hits = 0;
+    bar->length = length;
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        uint64_t t = tracks[i] & in_bar;
+        bar->hits |= t;
+        while (t != 0u) {
+            int s = __builtin_ctzll(t);
+            t &= t - 1u;
+            bar->steps[s] |= (uint16_t)(1u << i);
+        }
+    }
+}
+
+void mode_rhythm_bar_play(const mode_rhythm_bar_t *bar, uint8_t step) {
+    if (step >= bar->length) {
+        return;
+    }
+    uint16_t fire = bar->steps[step];
+    while (fire != 0u) {
+        io_trigger(mode_rhythm_jacks[__builtin_ctz(fire)]);
+        fire &= (uint16_t)(fire - 1u);
+    }
+}
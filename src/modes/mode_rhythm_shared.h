@@ -1,11 +1,126 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include "modes.h"
+#include "variables.h"
 #include "drivers/io.h"
 
 #define MODE_RHYTHM_NUM_OUTPUTS 10
+#define MODE_RHYTHM_BAR_STEPS 16 // One uint16_t pattern per bar
+#define MODE_RHYTHM_MAX_STEPS 64 // Longest bar: one uint64_t pattern (lengths 16, 32, 64)
+
+#if (MODE_RHYTHM_BAR_STEPS % MODE_RHYTHM_STEPS_PER_BEAT) != 0
+#error "MODE_RHYTHM_STEPS_PER_BEAT must divide MODE_RHYTHM_BAR_STEPS"
+#endif
 
 extern const jack_output_t mode_rhythm_jacks[MODE_RHYTHM_NUM_OUTPUTS];
 
 uint16_t mode_rhythm_base_pattern(calculation_mode_t calc, int out_idx);
+
+/** Every rhythm track (bit per track index) for mode_rhythm_xf_t.tracks. */
+#define MODE_RHYTHM_ALL_TRACKS ((uint16_t)((1u << MODE_RHYTHM_NUM_OUTPUTS) - 1u))
+
+/*
+ * Pattern transforms over the ten 16-step tracks. Modes describe their variation as a list of
+ * stages applied in order to a copy of their source tracks once per bar (or when their state
+ * changes), then play the resulting step table, so stacked transforms cost nothing per step.
+ */
+typedef enum {
+    MODE_RHYTHM_XF_AND = 0, // track &= masks[i]
+    MODE_RHYTHM_XF_OR,      // track |= masks[i]
+    MODE_RHYTHM_XF_XOR,     // track ^= masks[i]
+    MODE_RHYTHM_XF_CLEAR,   // track = 0 (mute)
+    MODE_RHYTHM_XF_ROTATE,  // step s plays source step s + amount (or + amounts[i])
+    MODE_RHYTHM_XF_THIN,    // each hit dropped with `amount` % probability
+    MODE_RHYTHM_XF_FILL,    // each rest filled with `amount` % probability
+    MODE_RHYTHM_XF_REPEAT   // the first `amount` steps repeat across the bar (stutter)
+} mode_rhythm_xf_op_t;
+
+typedef struct {
+    mode_rhythm_xf_op_t op;
+    uint8_t amount;         // ROTATE steps, THIN/FILL percent, REPEAT window
+    uint16_t tracks;        // Tracks the stage applies to (bit per track index)
+    const uint16_t *masks;  // AND/OR/XOR operand per track
+    const uint8_t *amounts; // ROTATE per track; NULL uses `amount`
+} mode_rhythm_xf_t;
+
+/** Bar ready to play: steps[s] has bit i set when mode_rhythm_jacks[i] fires on step s. */
+typedef struct {
+    uint16_t steps[MODE_RHYTHM_MAX_STEPS];
+    uint64_t hits;  // Bit s set when any track fires on step s
+    uint8_t length; // Steps in the bar: a multiple of MODE_RHYTHM_STEPS_PER_BEAT up to 64
+} mode_rhythm_bar_t;
+
+/** Apply `count` stages in order to tracks[MODE_RHYTHM_NUM_OUTPUTS], in place. */
+void mode_rhythm_xf_apply(uint16_t *tracks, const mode_rhythm_xf_t *stages, uint8_t count);
+
+/** Transpose 16-step tracks (bit s = step s) into a step table. */
+void mode_rhythm_bar_build(mode_rhythm_bar_t *bar, const uint16_t *tracks);
+
+/** Same for `length`-step tracks held in uint64_t (other lengths fall back to 16). */
+void mode_rhythm_bar_build_long(mode_rhythm_bar_t *bar, const uint64_t *tracks, uint8_t length);
+
+/** Trigger every jack set for `step`. */
+void mode_rhythm_bar_play(const mode_rhythm_bar_t *bar, uint8_t step);
+
+/*
+ * Front/back bar pair for modes that generate a new bar at every bar line: the next bar is
+ * generated into the back buffer during idle main-loop time of the current one, and the bar
+ * line only flips the index, so the downbeat does not wait for the generator.
+ */
+typedef struct {
+    mode_rhythm_bar_t bar[2];
+    uint8_t front;   // bar[front] is playing
+    bool back_ready; // bar[front ^ 1] holds the next bar
+} mode_rhythm_bars_t;
+
+static inline const mode_rhythm_bar_t *mode_rhythm_bars_front(const mode_rhythm_bars_t *b) {
+    return &b->bar[b->front];
+}
+
+static inline mode_rhythm_bar_t *mode_rhythm_bars_back(mode_rhythm_bars_t *b) {
+    return &b->bar[b->front ^ 1u];
+}
+
+/** Play the prepared back bar from now on. */
+static inline void mode_rhythm_bars_swap(mode_rhythm_bars_t *b) {
+    b->front ^= 1u;
+    b->back_ready = false;
+}
+
+/*
+ * F1-locked step clock shared by the step modes (11-20). Every F1 edge starts a beat and its
+ * MODE_RHYTHM_STEPS_PER_BEAT steps sit at edge + k*T/steps, so step 0 of each beat lands on
+ * 1A/1B and the steps never drift from F1. The bar position comes from the F1 counter, so it
+ * restarts with every sync. Only steps set in `wake` are returned: the next one is found with
+ * count-trailing-zeros, and mode_step_clock_next_wake_us() lets the Clock Manager skip the mode
+ * until then, so sparse bars cost nothing between hits.
+ */
+typedef struct {
+    uint32_t beat_ms;     // F1 edge that started the current beat
+    uint32_t interval_ms; // Beat length seen by the last update; 0 while timing is invalid
+    uint64_t wake;        // Steps returned by update (bit per bar step); all after a restart
+    uint8_t bar_steps;    // Bar length (mode_rhythm_bar_t.length)
+    uint8_t beat_base;    // Bar step of the beat's first step
+    uint8_t next_sub;     // Next step of the beat not yet returned
+    bool started;         // False until the first F1 edge
+    bool bar_start;       // Set with the first step returned in each bar
+} mode_step_clock_t;
+
+/** Forget the beat; stepping resumes on the next F1 edge, waking on every step of a 16-step bar. */
+void mode_step_clock_restart(mode_step_clock_t *c);
+
+/** Wake only on the bar's hits (and step 0, for bar-line work), with the bar's length. */
+void mode_step_clock_follow(mode_step_clock_t *c, const mode_rhythm_bar_t *bar);
+
+/** Next wake step (0..bar_steps-1) due now, or -1. Overdue wake steps of the beat collapse into one. */
+int mode_step_clock_update(mode_step_clock_t *c, const mode_context_t *context);
+
+/** next_wake_us for the step modes: time to the next wake step of the beat, else MODE_WAKE_ON_F1. */
+uint32_t mode_step_clock_next_wake_us(const mode_step_clock_t *c);
+
+/** Tempo-change hook: keep the fraction of the beat already played. */
+void mode_step_clock_rescale(mode_step_clock_t *c, uint32_t now_ms,
+                             uint32_t old_interval_ms, uint32_t new_interval_ms);
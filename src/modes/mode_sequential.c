@@ -54,7 +54,7 @@ void mode_sequential_update(const mode_context_t* context) {
         if (divisor > 0) { // Handle 1 in Fib/Lucas and standard division
             if ((current_clock_count % divisor) == 0) {
                 trigger = true;
-                set_output_high_for_duration(group_a_jacks[i], DEFAULT_PULSE_DURATION_MS); // Use central constant
+                io_trigger(group_a_jacks[i]);
             }
         }
         group_a_sum_trigger = group_a_sum_trigger || trigger; // OR logic for sum
@@ -67,7 +67,7 @@ void mode_sequential_update(const mode_context_t* context) {
         if (divisor > 0) { // Should always be true for Primes/Composites > 1
             if ((current_clock_count % divisor) == 0) {
                  trigger = true;
-                set_output_high_for_duration(group_b_jacks[i], DEFAULT_PULSE_DURATION_MS); // Use central constant
+                io_trigger(group_b_jacks[i]);
             }
         }
         group_b_sum_trigger = group_b_sum_trigger || trigger; // OR logic for sum
@@ -75,10 +75,10 @@ void mode_sequential_update(const mode_context_t* context) {
 
     // Trigger sum outputs (6A/6B) if any sequence output in their group triggered
     if (group_a_sum_trigger) {
-        set_output_high_for_duration(group_a_jacks[SUM_OUTPUT_INDEX], DEFAULT_PULSE_DURATION_MS); // Use central constant
+        io_trigger(group_a_jacks[SUM_OUTPUT_INDEX]);
     }
      if (group_b_sum_trigger) {
-        set_output_high_for_duration(group_b_jacks[SUM_OUTPUT_INDEX], DEFAULT_PULSE_DURATION_MS); // Use central constant
+        io_trigger(group_b_jacks[SUM_OUTPUT_INDEX]);
     }
 }
 
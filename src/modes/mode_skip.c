@@ -3,7 +3,6 @@
 #include "../main_constants.h"
 #include "../variables.h"
 
-#include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -11,12 +10,28 @@ static uint8_t skip_probability;
 static bool skip_active;
 static bool skip_ramp_up;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
+
+/* Skips are drawn once per bar: the base tracks thinned by skip_probability. */
+static void build_bar(void) {
+    uint16_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        tracks[i] = mode_rhythm_base_pattern(s_calc, i);
+    }
+    if (skip_active && skip_probability > 0) {
+        const mode_rhythm_xf_t skip_xf = { MODE_RHYTHM_XF_THIN, skip_probability, MODE_RHYTHM_ALL_TRACKS, NULL, NULL };
+        mode_rhythm_xf_apply(tracks, &skip_xf, 1);
+    }
+    mode_rhythm_bar_build(&bar, tracks);
+    mode_step_clock_follow(&step_clock, &bar);
+    bar_dirty = false;
+}
 
 void mode_skip_init(void) {
     mode_skip_reset();
-    next_step_time = 0;
 }
 
 void mode_skip_reset(void) {
@@ -24,14 +39,20 @@ void mode_skip_reset(void) {
     skip_probability = 0;
     skip_ramp_up = true;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         set_output(mode_rhythm_jacks[i], false);
     }
+    bar_dirty = true;
 }
 
 void mode_skip_reset_step(void) {
     current_step = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_skip_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_skip_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -57,12 +78,14 @@ void mode_skip_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
             skip_probability = (uint8_t)(skip_probability - 10);
         }
     }
+    bar_dirty = true;
 }
 
 void mode_skip_set_state(bool active, uint8_t probability, bool ramp_up) {
     skip_active = active;
     skip_probability = probability;
     skip_ramp_up = ramp_up;
+    bar_dirty = true;
 }
 
 void mode_skip_get_state(bool *active, uint8_t *probability, bool *ramp_up) {
@@ -76,42 +99,23 @@ void mode_skip_update(const mode_context_t *context) {
     if (context->sync_request) {
         mode_skip_reset_step();
     }
-
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
+    if (context->calc_mode_changed) {
+        bar_dirty = true;
     }
 
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t base = mode_rhythm_base_pattern(s_calc, i);
-        if (((base >> current_step) & 1)) {
-            bool play = true;
-            if (skip_active && skip_probability > 0 &&
-                (uint8_t)(rand() % 100) < skip_probability) {
-                play = false;
-            }
-            if (play) {
-                set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
-            }
-        }
+    if (step_clock.bar_start || bar_dirty) {
+        build_bar();
     }
+    mode_rhythm_bar_play(&bar, current_step);
+}
 
-    current_step++;
-    if (current_step >= 16) {
-        current_step = 0;
-    }
+uint32_t mode_skip_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -6,17 +6,29 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-static uint16_t generated_patterns[MODE_RHYTHM_NUM_OUTPUTS];
-static uint16_t variation_patterns[MODE_RHYTHM_NUM_OUTPUTS];
-static uint8_t song_step;
+typedef struct {
+    uint16_t generated[MODE_RHYTHM_NUM_OUTPUTS];
+    uint16_t variation[MODE_RHYTHM_NUM_OUTPUTS]; /* Played from SONG_VARIATION_BAR on */
+} song_set_t;
+
+static song_set_t song_sets[2];
+static uint8_t live_set;        /* song_sets[live_set] is playing; the other takes regenerations */
+static uint8_t song_bar;
+static bool song_playing;  /* First bar start after a restart does not advance the bar */
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static bool variation_pending;
 static uint32_t variation_seed;
 static uint32_t song_mod_nonce;
 static calculation_mode_t s_calc;
+static mode_rhythm_bars_t bars;
+static uint8_t next_bar;        /* song_bar of the back bar */
+static bool next_regenerated;   /* Back bar plays the other song set */
+static bool bar_dirty = true;
 
 #define SONG_DEFAULT_SEED 0xC0FFEE01u
+#define SONG_BARS 8u
+#define SONG_VARIATION_BAR 6u /* Bars 6-7 play the variation */
 
 static int popcount16(uint16_t x) {
     int c = 0;
@@ -64,29 +76,55 @@ static uint16_t generate_track(uint32_t *rng, uint16_t base) {
     return p;
 }
 
-static void song_regenerate(uint32_t seed) {
+static void song_regenerate(uint32_t seed, song_set_t *set) {
     uint32_t rng = seed;
     for (int oi = 0; oi < MODE_RHYTHM_NUM_OUTPUTS; oi++) {
         uint16_t base = mode_rhythm_base_pattern(s_calc, oi);
-        generated_patterns[oi] = generate_track(&rng, base);
-        variation_patterns[oi] = generate_track(&rng, generated_patterns[oi]);
+        set->generated[oi] = generate_track(&rng, base);
+        set->variation[oi] = generate_track(&rng, set->generated[oi]);
     }
 }
 
+static const uint16_t *song_tracks(const song_set_t *set, uint8_t bar) {
+    return (bar < SONG_VARIATION_BAR) ? set->generated : set->variation;
+}
+
+/* Advance the song by one bar into the back buffer; a pending new loop is generated here, in the
+ * idle time of the last bar, rather than on its first downbeat. */
+static void prepare_next_bar(void) {
+    next_bar = song_bar;
+    next_regenerated = false;
+    if (song_playing) {
+        next_bar++;
+        if (next_bar >= SONG_BARS) {
+            next_bar = 0;
+            if (variation_pending) {
+                song_regenerate(variation_seed, &song_sets[live_set ^ 1u]);
+                next_regenerated = true;
+            }
+        }
+    }
+    const song_set_t *set = &song_sets[next_regenerated ? (live_set ^ 1u) : live_set];
+    mode_rhythm_bar_build(mode_rhythm_bars_back(&bars), song_tracks(set, next_bar));
+    bars.back_ready = true;
+}
+
 void mode_song_init(void) {
     mode_song_reset();
-    next_step_time = 0;
 }
 
 void mode_song_reset(void) {
-    song_step = 0;
+    song_bar = 0;
+    song_playing = false;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     variation_pending = false;
     variation_seed = SONG_DEFAULT_SEED;
     song_mod_nonce = 0;
     s_calc = CALC_MODE_NORMAL;
-    song_regenerate(variation_seed);
+    song_regenerate(variation_seed, &song_sets[live_set]);
+    bar_dirty = true;
+    bars.back_ready = false;
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         set_output(mode_rhythm_jacks[i], false);
     }
@@ -94,7 +132,14 @@ void mode_song_reset(void) {
 
 void mode_song_reset_step(void) {
     current_step = 0;
-    song_step = 0;
+    mode_step_clock_restart(&step_clock);
+    song_bar = 0;
+    song_playing = false;
+    bars.back_ready = false;
+}
+
+void mode_song_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_song_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -103,11 +148,13 @@ void mode_song_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
     song_mod_nonce++;
     variation_seed = ts_ms ^ (song_mod_nonce * 2654435761u) ^ 0xA5C3E91Du;
     variation_pending = true;
+    bars.back_ready = false;
 }
 
 void mode_song_set_state(uint32_t seed, bool pending) {
     variation_seed = seed;
     variation_pending = pending;
+    bars.back_ready = false;
 }
 
 void mode_song_get_state(uint32_t *seed, bool *pending) {
@@ -121,45 +168,45 @@ void mode_song_update(const mode_context_t *context) {
         mode_song_reset_step();
     }
     if (context->calc_mode_changed) {
-        song_regenerate(variation_seed);
-    }
-
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
+        song_regenerate(variation_seed, &song_sets[live_set]);
+        bar_dirty = true;
+        bars.back_ready = false;
     }
 
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
+        if (!bars.back_ready) {
+            prepare_next_bar();
+        }
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
-    }
-
-    uint8_t bit_pos = (uint8_t)(song_step % 16u);
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t pat = (song_step < 96) ? generated_patterns[i] : variation_patterns[i];
-        if ((pat >> bit_pos) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
+    if (step_clock.bar_start) {
+        if (!bars.back_ready) {
+            prepare_next_bar();
         }
-    }
-
-    song_step++;
-    if (song_step >= 128) {
-        song_step = 0;
-        if (variation_pending) {
-            song_regenerate(variation_seed);
+        song_bar = next_bar;
+        if (next_regenerated) {
+            live_set ^= 1u;
             variation_pending = false;
         }
-    }
+        song_playing = true;
+        mode_rhythm_bars_swap(&bars);
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    } else if (bar_dirty) {
+        mode_rhythm_bar_build(&bars.bar[bars.front], song_tracks(&song_sets[live_set], song_bar));
+        mode_step_clock_follow(&step_clock, mode_rhythm_bars_front(&bars));
+        bar_dirty = false;
+    }
+    mode_rhythm_bar_play(mode_rhythm_bars_front(&bars), current_step);
+}
 
-    current_step = (uint8_t)(song_step % 16u);
+uint32_t mode_song_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    if (!bars.back_ready) {
+        return MODE_WAKE_NOW; /* Next bar still to generate */
+    }
+    return mode_step_clock_next_wake_us(&step_clock);
 }
@@ -12,14 +12,37 @@ static bool stutter_active;
 static uint8_t stutter_length;
 static bool stutter_ramp_up;
 static uint16_t stutter_variation_mask[MODE_RHYTHM_NUM_OUTPUTS];
-static uint8_t seq_pos;
 static uint8_t current_step;
-static uint32_t next_step_time;
+static mode_step_clock_t step_clock;
 static calculation_mode_t s_calc;
+static mode_rhythm_bar_t bar;
+static bool bar_dirty = true;
+
+/* Base XOR variation, then the first `stutter_length` steps repeated across the bar. */
+static void build_bar(void) {
+    uint16_t tracks[MODE_RHYTHM_NUM_OUTPUTS];
+    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
+        tracks[i] = mode_rhythm_base_pattern(s_calc, i);
+    }
+    const mode_rhythm_xf_t stages[] = {
+        { MODE_RHYTHM_XF_XOR, 0, MODE_RHYTHM_ALL_TRACKS, stutter_variation_mask, NULL },
+        { MODE_RHYTHM_XF_REPEAT, stutter_length, MODE_RHYTHM_ALL_TRACKS, NULL, NULL },
+    };
+    bool stuttering = stutter_active && stutter_length >= 2;
+    mode_rhythm_xf_apply(tracks, stages, stuttering ? 2u : 1u);
+    mode_rhythm_bar_build(&bar, tracks);
+    mode_step_clock_follow(&step_clock, &bar);
+    if (stuttering) {
+        /* Also wake at the end of each stutter cycle for the nudge below. */
+        for (uint8_t s = (uint8_t)(stutter_length - 1u); s < MODE_RHYTHM_BAR_STEPS; s = (uint8_t)(s + stutter_length)) {
+            step_clock.wake |= (uint64_t)1u << s;
+        }
+    }
+    bar_dirty = false;
+}
 
 void mode_stutter_init(void) {
     mode_stutter_reset();
-    next_step_time = 0;
 }
 
 void mode_stutter_reset(void) {
@@ -29,17 +52,21 @@ void mode_stutter_reset(void) {
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         stutter_variation_mask[i] = 0;
     }
-    seq_pos = 0;
     current_step = 0;
-    next_step_time = 0;
+    mode_step_clock_restart(&step_clock);
     for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
         set_output(mode_rhythm_jacks[i], false);
     }
+    bar_dirty = true;
 }
 
 void mode_stutter_reset_step(void) {
     current_step = 0;
-    seq_pos = 0;
+    mode_step_clock_restart(&step_clock);
+}
+
+void mode_stutter_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    mode_step_clock_rescale(&step_clock, now_ms, old_interval_ms, new_interval_ms);
 }
 
 void mode_stutter_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
@@ -57,6 +84,7 @@ void mode_stutter_on_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
         stutter_length = 2;
     }
     stutter_ramp_up = true;
+    bar_dirty = true;
 }
 
 void mode_stutter_set_state(bool active, uint8_t length, bool ramp_up, const uint16_t *variation_mask) {
@@ -68,9 +96,7 @@ void mode_stutter_set_state(bool active, uint8_t length, bool ramp_up, const uin
     } else {
         memset(stutter_variation_mask, 0, sizeof stutter_variation_mask);
     }
-    if (!stutter_active) {
-        seq_pos = 0;
-    }
+    bar_dirty = true;
 }
 
 void mode_stutter_get_state(bool *active, uint8_t *length, bool *ramp_up, uint16_t *variation_mask) {
@@ -87,49 +113,33 @@ void mode_stutter_update(const mode_context_t *context) {
     if (context->sync_request) {
         mode_stutter_reset_step();
     }
-
-    uint32_t now = context->current_time_ms;
-    uint32_t step_interval = context->current_tempo_interval_ms / 4;
-    if (step_interval < 5) {
-        step_interval = 5;
-    }
-
-    if (next_step_time == 0) {
-        next_step_time = now;
+    if (context->calc_mode_changed) {
+        bar_dirty = true;
     }
 
-    if (now < next_step_time) {
+    int step = mode_step_clock_update(&step_clock, context);
+    if (step < 0) {
         return;
     }
+    current_step = (uint8_t)step;
 
-    next_step_time += step_interval;
-    if (next_step_time < now) {
-        next_step_time = now + step_interval;
+    if (step_clock.bar_start || bar_dirty) {
+        build_bar();
     }
-
-    uint8_t bit_pos = stutter_active ? seq_pos : current_step;
-
-    for (int i = 0; i < MODE_RHYTHM_NUM_OUTPUTS; i++) {
-        uint16_t base = mode_rhythm_base_pattern(s_calc, i) ^ stutter_variation_mask[i];
-        if ((base >> bit_pos) & 1) {
-            set_output_high_for_duration(mode_rhythm_jacks[i], DEFAULT_PULSE_DURATION_MS);
-        }
+    mode_rhythm_bar_play(&bar, current_step);
+
+    bool stuttering = stutter_active && stutter_length >= 2;
+    if (stuttering && (uint8_t)(current_step % stutter_length) == stutter_length - 1u) {
+        /* After each full stutter cycle, nudge pattern for evolving feel. */
+        int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
+        int b1 = rand() % 16;
+        int b2 = rand() % 16;
+        stutter_variation_mask[oi] ^= (uint16_t)((1u << b1) | (1u << b2));
+        bar_dirty = true;
     }
+}
 
-    if (stutter_active && stutter_length >= 2) {
-        seq_pos++;
-        if (seq_pos >= stutter_length) {
-            seq_pos = 0;
-            /* After each full stutter cycle, nudge pattern for evolving feel. */
-            int oi = rand() % MODE_RHYTHM_NUM_OUTPUTS;
-            int b1 = rand() % 16;
-            int b2 = rand() % 16;
-            stutter_variation_mask[oi] ^= (uint16_t)((1u << b1) | (1u << b2));
-        }
-    } else {
-        current_step++;
-        if (current_step >= 16) {
-            current_step = 0;
-        }
-    }
+uint32_t mode_stutter_next_wake_us(uint32_t now_us) {
+    (void)now_us;
+    return mode_step_clock_next_wake_us(&step_clock);
 }
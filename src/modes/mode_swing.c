@@ -1,9 +1,7 @@
 #include "mode_swing.h"
 #include "drivers/io.h"
 #include "modes.h" // For mode_context_t
-#include "main_constants.h" // For DEFAULT_PULSE_DURATION_MS
-
-#include <string.h> // For memset
+#include "main_constants.h"
 
 // --- Configuration ---
 #define SWING_MEASURE_BEATS 4
@@ -36,26 +34,43 @@ static const uint8_t* const swing_profiles_available[NUM_SWING_PROFILES] = {
 static uint8_t current_swing_profile_index_A = 3; // Default to Medium for Group A
 static uint8_t current_swing_profile_index_B = 3; // Default to Medium for Group B
 
-static uint32_t output_on_times[NUM_JACK_OUTPUTS];  // Time when pin should turn ON
-static uint32_t output_off_times[NUM_JACK_OUTPUTS]; // Time when pin should turn OFF
+static const jack_output_t swing_pins_a[NUM_SWING_OUTPUTS] = { JACK_OUT_2A, JACK_OUT_3A, JACK_OUT_4A, JACK_OUT_5A, JACK_OUT_6A };
+static const jack_output_t swing_pins_b[NUM_SWING_OUTPUTS] = { JACK_OUT_2B, JACK_OUT_3B, JACK_OUT_4B, JACK_OUT_5B, JACK_OUT_6B };
 
 // Helper function to calculate swing delay
-static uint32_t calculate_delay(uint32_t beat_index, uint32_t tempo_interval, uint8_t swing_percent) {
+static uint32_t calculate_delay(uint32_t beat_index, const mode_timing_t *timing, uint8_t swing_percent) {
     if (beat_index % 2 == 0 || swing_percent <= 50) { // No delay on even beats (0, 2 for SWING_MEASURE_BEATS=4) or if swing <= 50%
         return 0;
     }
-    // Calculate delay for odd beats (1, 3 for SWING_MEASURE_BEATS=4)
-    int32_t delay_ms = ((int32_t)swing_percent - 50) * (int32_t)tempo_interval / 100;
-    return (delay_ms > 0) ? (uint32_t)delay_ms : 0;
+    // Delay for odd beats (1, 3 for SWING_MEASURE_BEATS=4), precomputed per tempo by the Clock Manager
+    uint32_t step = (uint32_t)swing_percent - 50u;
+    if (step >= MODE_TIMING_SWING_STEPS) step = MODE_TIMING_SWING_STEPS - 1u;
+    return timing->swing_offset_ms[step];
 }
 
 // --- Mode Interface Functions ---
 
+// Fire now, or hand the swung trigger to the pulse timer queue; nothing to poll afterwards
+static void schedule_swung(jack_output_t pin, uint32_t f1_tick_us, uint32_t delay_ms) {
+    if (delay_ms == 0) {
+        io_trigger(pin);
+    } else {
+        io_trigger_at(pin, f1_tick_us + delay_ms * 1000u);
+    }
+}
+
+static uint32_t swing_jack_mask(void) {
+    uint32_t mask = 0;
+    for (int i = 0; i < NUM_SWING_OUTPUTS; i++) {
+        mask |= (1u << swing_pins_a[i]) | (1u << swing_pins_b[i]);
+    }
+    return mask;
+}
+
 void mode_swing_init(void) {
-    memset(output_on_times, 0, sizeof(output_on_times));
-    memset(output_off_times, 0, sizeof(output_off_times));
-    for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
-        set_output(pin, false);
+    for (int i = 0; i < NUM_SWING_OUTPUTS; i++) {
+        set_output(swing_pins_a[i], false);
+        set_output(swing_pins_b[i], false);
     }
     // Default indices are set by global var initialization or by mode_swing_set_profile_indices later
     // For a clean init, ensure they are set to a known default if not relying on persistence load immediately.
@@ -64,106 +79,46 @@ void mode_swing_init(void) {
 }
 
 void mode_swing_update(const mode_context_t* context) {
-    uint32_t current_time = context->current_time_ms;
-
     // Handle profile change immediately if calc_mode_changed is true (from PA1 or PB4).
     if (context->calc_mode_changed) { 
         current_swing_profile_index_A = (current_swing_profile_index_A + 1) % NUM_SWING_PROFILES; 
         current_swing_profile_index_B = (current_swing_profile_index_B - 1 + NUM_SWING_PROFILES) % NUM_SWING_PROFILES; 
     }
 
-    // --- Check for scheduled ON events ---
-    for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
-        bool is_group_b = (pin >= JACK_OUT_1B && pin <= JACK_OUT_6B);
-        if (pin > JACK_OUT_6A && !is_group_b) continue; // Skip invalid enum range
-
-        if (output_on_times[pin] != 0 && current_time >= output_on_times[pin]) {
-            if (output_off_times[pin] == 0) { // Ensure it's not already ON and waiting for OFF
-                set_output(pin, true);
-                output_off_times[pin] = current_time + DEFAULT_PULSE_DURATION_MS; // Set off_time based on actual on_time
-            }
-            output_on_times[pin] = 0; // Clear the scheduled ON event
-        }
-    }
-
-    // --- Check for scheduled OFF events ---
-    for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
-        bool is_group_b = (pin >= JACK_OUT_1B && pin <= JACK_OUT_6B);
-        if (pin > JACK_OUT_6A && !is_group_b) continue; // Skip invalid enum range
-
-        if (output_off_times[pin] != 0 && current_time >= output_off_times[pin]) {
-            set_output(pin, false);
-            output_off_times[pin] = 0; // Clear the scheduled OFF event
-        }
-    }
-
     // --- Schedule events on F1 Tick ---
+    // 1A/1B carry the plain F1 clock from the Clock Manager; outputs 2-6 get the swing profiles.
     if (context->f1_rising_edge) {
         uint32_t beat_index = (context->f1_counter - 1) % SWING_MEASURE_BEATS; 
-        uint32_t f1_tick_time = current_time; // Use current_time from context for f1 scheduling base
+        uint32_t f1_tick_us = io_now_us();
 
         const uint8_t *active_percentages_A = swing_profiles_available[current_swing_profile_index_A];
         const uint8_t *active_percentages_B = swing_profiles_available[current_swing_profile_index_B];
 
-        // --- Group A (1A-6A) ---
-        for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6A; ++pin) {
-            uint32_t delay = 0;
-            if (pin >= JACK_OUT_2A) { // Outputs 2A-6A get swing from profile A
-                 int index_in_profile = pin - JACK_OUT_2A; 
-                 if (index_in_profile < NUM_SWING_OUTPUTS) { 
-                    delay = calculate_delay(beat_index, context->current_tempo_interval_ms, active_percentages_A[index_in_profile]);
-                 }
-            } // Output 1A (F1) has no swing, delay remains 0
-            
-            uint32_t trigger_on_time = f1_tick_time + delay;
-
-            if (output_off_times[pin] == 0 && output_on_times[pin] == 0) { // If output is ready for a new trigger
-                 if (delay == 0) { // No swing delay, or F1 output
-                    set_output(pin, true);
-                    output_off_times[pin] = trigger_on_time + DEFAULT_PULSE_DURATION_MS;
-                 } else { // Swing delay applies
-                    output_on_times[pin] = trigger_on_time;
-                 }
-            }
-        }
-
-        // --- Group B (1B-6B) ---
-         for (jack_output_t pin = JACK_OUT_1B; pin <= JACK_OUT_6B; ++pin) {
-            uint32_t delay = 0;
-            if (pin >= JACK_OUT_2B) { // Outputs 2B-6B get swing from profile B
-                 int index_in_profile = pin - JACK_OUT_2B; 
-                 if (index_in_profile < NUM_SWING_OUTPUTS) { 
-                     delay = calculate_delay(beat_index, context->current_tempo_interval_ms, active_percentages_B[index_in_profile]);
-                 }
-            } // Output 1B (F1) has no swing, delay remains 0
-
-            uint32_t trigger_on_time = f1_tick_time + delay;
-
-            if (output_off_times[pin] == 0 && output_on_times[pin] == 0) { // If output is ready for a new trigger
-                 if (delay == 0) { // No swing delay, or F1 output
-                    set_output(pin, true);
-                    output_off_times[pin] = trigger_on_time + DEFAULT_PULSE_DURATION_MS;
-                 } else { // Swing delay applies
-                    output_on_times[pin] = trigger_on_time;
-                 }
-            }
+        for (int i = 0; i < NUM_SWING_OUTPUTS; i++) {
+            schedule_swung(swing_pins_a[i], f1_tick_us,
+                           calculate_delay(beat_index, context->timing, active_percentages_A[i]));
+            schedule_swung(swing_pins_b[i], f1_tick_us,
+                           calculate_delay(beat_index, context->timing, active_percentages_B[i]));
         }
     } 
 }
 
 void mode_swing_reset(void) {
-    memset(output_on_times, 0, sizeof(output_on_times));
-    memset(output_off_times, 0, sizeof(output_off_times));
-     for (jack_output_t pin = JACK_OUT_1A; pin <= JACK_OUT_6B; ++pin) {
-        bool is_group_b = (pin >= JACK_OUT_1B && pin <= JACK_OUT_6B);
-        if (pin > JACK_OUT_6A && !is_group_b) continue; 
-        set_output(pin, false);
+    for (int i = 0; i < NUM_SWING_OUTPUTS; i++) {
+        set_output(swing_pins_a[i], false);
+        set_output(swing_pins_b[i], false);
     }
     // Reset to default medium profiles
     current_swing_profile_index_A = 3; 
     current_swing_profile_index_B = 3; 
 }
 
+void mode_swing_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    (void)now_ms;
+    // Swung triggers still waiting in the pulse timer queue follow the new beat length
+    io_trigger_at_rescale(swing_jack_mask(), old_interval_ms, new_interval_ms);
+}
+
 // Functions for persistence
 void mode_swing_set_profile_indices(uint8_t profile_index_a, uint8_t profile_index_b) {
     if (profile_index_a < NUM_SWING_PROFILES) {
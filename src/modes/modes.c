@@ -1,5 +1,5 @@
 #include "modes.h"
-#include <stddef.h> // For NULL
+#include "drivers/persistence.h" // krono_state_t for the saved-state adapters
 
 // Include headers for all modes
 #include "mode_default.h"
@@ -14,95 +14,520 @@
 #include "mode_chaos.h"
 #include "mode_fixed.h"
 
-// Function pointer table for mode reset functions
-static void (*mode_reset_functions[NUM_OPERATIONAL_MODES])(void) = {
-    mode_default_reset,
-    mode_euclidean_reset,
-    mode_musical_reset,
-    mode_probabilistic_reset,
-    mode_sequential_reset,
-    mode_swing_reset,
-    mode_polyrhythm_reset,
-    mode_logic_reset,
-    mode_phasing_reset,
-    mode_chaos_reset,
-    mode_fixed_reset,
-    mode_drift_reset,
-    mode_fill_reset,
-    mode_skip_reset,
-    mode_stutter_reset,
-    mode_morph_reset,
-    mode_mute_reset,
-    mode_density_reset,
-    mode_song_reset,
-    mode_accumulate_reset,
-    mode_gamma_sequential_reset_reset,
-    mode_gamma_sequential_freeze_reset,
-    mode_gamma_sequential_trip_reset,
-    mode_gamma_sequential_fire_reset,
-    mode_gamma_sequential_bounce_reset,
-    mode_gamma_portals_reset,
-    mode_gamma_coin_toss_reset,
-    mode_gamma_ratchet_reset,
-    mode_gamma_anti_ratchet_reset,
-    mode_gamma_start_stop_reset
-};
+// --- Descriptor helpers ---
+
+static void mode_nop_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    (void)now_ms;
+    (void)old_interval_ms;
+    (void)new_interval_ms;
+}
+
+static void mode_nop_mod_press(mod_press_event_t ev, uint32_t ts_ms) {
+    (void)ev;
+    (void)ts_ms;
+}
+
+static void mode_nop_apply_state(const krono_state_t *state) {
+    (void)state;
+}
+
+static void mode_nop_capture_state(krono_state_t *state) {
+    (void)state;
+}
+
+static uint32_t mode_wake_now(uint32_t now_us) {
+    (void)now_us;
+    return MODE_WAKE_NOW;
+}
+
+// Modes that only act on F1 edges, calc swaps and sync requests
+static uint32_t mode_wake_on_f1(uint32_t now_us) {
+    (void)now_us;
+    return MODE_WAKE_ON_F1;
+}
+
+#if (KRONO_MODES_ENABLED & KRONO_MODES_ALL) != KRONO_MODES_ALL
+static void mode_nop(void) {
+}
+
+static void mode_nop_update(const mode_context_t *context) {
+    (void)context;
+}
+#endif
+
+// --- Saved-state adapters (krono_state_t fields <-> mode runtime) ---
+
+#if KRONO_MODE_ENABLED(5)
+static void swing_apply_state(const krono_state_t *s) {
+    mode_swing_set_profile_indices(s->swing_profile_index_A, s->swing_profile_index_B);
+}
+static void swing_capture_state(krono_state_t *s) {
+    mode_swing_get_profile_indices(&s->swing_profile_index_A, &s->swing_profile_index_B);
+}
+#endif
 
-// Function pointer table for mode init functions
-static void (*mode_init_functions[NUM_OPERATIONAL_MODES])(void) = {
-    mode_default_init,
-    mode_euclidean_init,
-    mode_musical_init,
-    mode_probabilistic_init,
-    mode_sequential_init,
-    mode_swing_init,
-    mode_polyrhythm_init,
-    mode_logic_init,
-    mode_phasing_init,
-    mode_chaos_init,
-    mode_fixed_init,
-    mode_drift_init,
-    mode_fill_init,
-    mode_skip_init,
-    mode_stutter_init,
-    mode_morph_init,
-    mode_mute_init,
-    mode_density_init,
-    mode_song_init,
-    mode_accumulate_init,
-    mode_gamma_sequential_reset_init,
-    mode_gamma_sequential_freeze_init,
-    mode_gamma_sequential_trip_init,
-    mode_gamma_sequential_fire_init,
-    mode_gamma_sequential_bounce_init,
-    mode_gamma_portals_init,
-    mode_gamma_coin_toss_init,
-    mode_gamma_ratchet_init,
-    mode_gamma_anti_ratchet_init,
-    mode_gamma_start_stop_init
+#if KRONO_MODE_ENABLED(9)
+static void chaos_apply_state(const krono_state_t *s) {
+    mode_chaos_set_divisor(s->chaos_mode_divisor);
+    mode_chaos_set_engine(s->chaos_engine);
+}
+static void chaos_capture_state(krono_state_t *s) {
+    s->chaos_mode_divisor = mode_chaos_get_divisor();
+    s->chaos_engine = mode_chaos_get_engine();
+}
+#endif
+
+#if KRONO_MODE_ENABLED(10)
+static void fixed_apply_state(const krono_state_t *s) {
+    mode_fixed_set_bank(persistence_get_fixed_bank(s)); // Ignored if out of range: bank 0 from init
+}
+static void fixed_capture_state(krono_state_t *s) {
+    persistence_set_fixed_bank(s, mode_fixed_get_bank());
+}
+#endif
+
+#if KRONO_MODE_ENABLED(11)
+static void drift_apply_state(const krono_state_t *s) {
+    mode_drift_set_state(s->drift_active, s->drift_probability, s->drift_ramp_up);
+}
+static void drift_capture_state(krono_state_t *s) {
+    mode_drift_get_state(&s->drift_active, &s->drift_probability, &s->drift_ramp_up);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(12)
+static void fill_apply_state(const krono_state_t *s) {
+    mode_fill_set_state(s->fill_density, s->fill_ramp_up);
+}
+static void fill_capture_state(krono_state_t *s) {
+    mode_fill_get_state(&s->fill_density, &s->fill_ramp_up);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(13)
+static void skip_apply_state(const krono_state_t *s) {
+    mode_skip_set_state(s->skip_active, s->skip_probability, s->skip_ramp_up);
+}
+static void skip_capture_state(krono_state_t *s) {
+    mode_skip_get_state(&s->skip_active, &s->skip_probability, &s->skip_ramp_up);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(14)
+static void stutter_apply_state(const krono_state_t *s) {
+    mode_stutter_set_state(s->stutter_active, s->stutter_length, s->stutter_ramp_up, s->stutter_variation_mask);
+}
+static void stutter_capture_state(krono_state_t *s) {
+    mode_stutter_get_state(&s->stutter_active, &s->stutter_length, &s->stutter_ramp_up, s->stutter_variation_mask);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(15)
+static void morph_apply_state(const krono_state_t *s) {
+    mode_morph_set_state(s->morph_frozen, s->morph_generation, s->morph_patterns);
+}
+static void morph_capture_state(krono_state_t *s) {
+    mode_morph_get_state(&s->morph_frozen, &s->morph_generation, s->morph_patterns);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(16)
+static void mute_apply_state(const krono_state_t *s) {
+    mode_mute_set_state(s->mute_mask, s->mute_count, s->mute_ramp_up, s->mute_variation_mask);
+}
+static void mute_capture_state(krono_state_t *s) {
+    mode_mute_get_state(&s->mute_mask, &s->mute_count, &s->mute_ramp_up, s->mute_variation_mask);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(17)
+static void density_apply_state(const krono_state_t *s) {
+    mode_density_set_state(s->density_pct, s->density_ramp_up);
+}
+static void density_capture_state(krono_state_t *s) {
+    mode_density_get_state(&s->density_pct, &s->density_ramp_up);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(18)
+static void song_apply_state(const krono_state_t *s) {
+    mode_song_set_state(s->song_variation_seed, s->song_variation_pending);
+}
+static void song_capture_state(krono_state_t *s) {
+    mode_song_get_state(&s->song_variation_seed, &s->song_variation_pending);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(19)
+static void accumulate_apply_state(const krono_state_t *s) {
+    mode_accumulate_set_state(s->accumulate_active_count, s->accumulate_add_pending, s->accumulate_active_mask,
+                              s->accumulate_phase_offsets, s->accumulate_variation_masks);
+}
+static void accumulate_capture_state(krono_state_t *s) {
+    mode_accumulate_get_state(&s->accumulate_active_count, &s->accumulate_add_pending, &s->accumulate_active_mask,
+                              s->accumulate_phase_offsets, s->accumulate_variation_masks);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(21)
+static void gamma_freeze_apply_state(const krono_state_t *s) {
+    mode_gamma_sequential_freeze_set_state(s->gamma_seq_freeze_frozen, s->gamma_seq_freeze_step);
+}
+static void gamma_freeze_capture_state(krono_state_t *s) {
+    mode_gamma_sequential_freeze_get_state(&s->gamma_seq_freeze_frozen, &s->gamma_seq_freeze_step);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(22)
+static void gamma_trip_apply_state(const krono_state_t *s) {
+    mode_gamma_sequential_trip_set_state(s->gamma_seq_trip_pattern, s->gamma_seq_trip_step);
+}
+static void gamma_trip_capture_state(krono_state_t *s) {
+    mode_gamma_sequential_trip_get_state(&s->gamma_seq_trip_pattern, &s->gamma_seq_trip_step);
+}
+#endif
+
+// Gamma toggles 26–30 are hot state: also mirrored to the RTC backup registers on every change
+#if KRONO_MODE_ENABLED(25)
+static void gamma_portals_apply_state(const krono_state_t *s) {
+    mode_gamma_portals_set_state(s->gamma_portals_div_on_a);
+}
+static void gamma_portals_capture_state(krono_state_t *s) {
+    mode_gamma_portals_get_state(&s->gamma_portals_div_on_a);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(26)
+static void gamma_coin_toss_apply_state(const krono_state_t *s) {
+    mode_gamma_coin_toss_set_state(s->gamma_coin_invert);
+}
+static void gamma_coin_toss_capture_state(krono_state_t *s) {
+    mode_gamma_coin_toss_get_state(&s->gamma_coin_invert);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(27)
+static void gamma_ratchet_apply_state(const krono_state_t *s) {
+    mode_gamma_ratchet_set_state(s->gamma_ratchet_double);
+}
+static void gamma_ratchet_capture_state(krono_state_t *s) {
+    mode_gamma_ratchet_get_state(&s->gamma_ratchet_double);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(28)
+static void gamma_anti_ratchet_apply_state(const krono_state_t *s) {
+    mode_gamma_anti_ratchet_set_state(s->gamma_antiratchet_half);
+}
+static void gamma_anti_ratchet_capture_state(krono_state_t *s) {
+    mode_gamma_anti_ratchet_get_state(&s->gamma_antiratchet_half);
+}
+#endif
+
+#if KRONO_MODE_ENABLED(29)
+static void gamma_start_stop_apply_state(const krono_state_t *s) {
+    mode_gamma_start_stop_set_state(s->gamma_startstop_muted);
+}
+static void gamma_start_stop_capture_state(krono_state_t *s) {
+    mode_gamma_start_stop_get_state(&s->gamma_startstop_muted);
+}
+#endif
+
+// --- Descriptor table ---
+
+#define MODE_HOOKS(name) \
+    .init = mode_##name##_init, .update = mode_##name##_update, .reset = mode_##name##_reset
+#define MODE_NO_TEMPO .on_tempo_change = mode_nop_tempo_change
+#define MODE_TEMPO(name) .on_tempo_change = mode_##name##_on_tempo_change
+#define MODE_NO_MOD .on_mod_press = mode_nop_mod_press
+#define MODE_MOD(name) .on_mod_press = mode_##name##_on_mod_press
+#define MODE_NO_STATE \
+    .apply_state = mode_nop_apply_state, .capture_state = mode_nop_capture_state, \
+    .capture_hot = mode_nop_capture_state
+#define MODE_STATE(prefix) \
+    .apply_state = prefix##_apply_state, .capture_state = prefix##_capture_state, \
+    .capture_hot = mode_nop_capture_state
+#define MODE_HOT_STATE(prefix) \
+    .apply_state = prefix##_apply_state, .capture_state = prefix##_capture_state, \
+    .capture_hot = prefix##_capture_state
+
+// Left out by KRONO_MODES_ENABLED: never selectable, and its code is not referenced
+#define MODE_DISABLED { \
+    .init = mode_nop, .update = mode_nop_update, .reset = mode_nop, MODE_NO_TEMPO, MODE_NO_MOD, \
+    MODE_NO_STATE, .next_wake_us = mode_wake_on_f1, .flags = MODE_FLAG_DISABLED }
+
+const mode_descriptor_t mode_descriptors[NUM_OPERATIONAL_MODES] = {
+    // MODE_DEFAULT is always built: it is the fallback for unknown or disabled modes
+    [MODE_DEFAULT] = {
+        MODE_HOOKS(default), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#if KRONO_MODE_ENABLED(1)
+    [MODE_EUCLIDEAN] = {
+        MODE_HOOKS(euclidean), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_EUCLIDEAN] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(2)
+    [MODE_MUSICAL] = {
+        MODE_HOOKS(musical), MODE_TEMPO(musical), MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_SKIP_FIRST_UPDATE
+    },
+#else
+    [MODE_MUSICAL] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(3)
+    [MODE_PROBABILISTIC] = {
+        MODE_HOOKS(probabilistic), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_PROBABILISTIC] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(4)
+    [MODE_SEQUENTIAL] = {
+        MODE_HOOKS(sequential), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_SEQUENTIAL] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(5)
+    [MODE_SWING] = {
+        MODE_HOOKS(swing), MODE_TEMPO(swing), MODE_NO_MOD, MODE_STATE(swing),
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_SWING] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(6)
+    [MODE_POLYRHYTHM] = {
+        MODE_HOOKS(polyrhythm), MODE_TEMPO(polyrhythm), MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_SKIP_FIRST_UPDATE
+    },
+#else
+    [MODE_POLYRHYTHM] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(7)
+    [MODE_LOGIC] = {
+        MODE_HOOKS(logic), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_LOGIC] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(8)
+    [MODE_PHASING] = {
+        MODE_HOOKS(phasing), MODE_NO_TEMPO, MODE_NO_MOD, MODE_NO_STATE,
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_PHASING] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(9)
+    [MODE_CHAOS] = {
+        MODE_HOOKS(chaos), MODE_NO_TEMPO, MODE_NO_MOD, MODE_STATE(chaos),
+        .next_wake_us = mode_wake_now, .flags = 0
+    },
+#else
+    [MODE_CHAOS] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(10)
+    [MODE_FIXED] = {
+        MODE_HOOKS(fixed), MODE_TEMPO(fixed), MODE_MOD(fixed), MODE_STATE(fixed),
+        .next_wake_us = mode_fixed_next_wake_us, .flags = 0
+    },
+#else
+    [MODE_FIXED] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(11)
+    [MODE_DRIFT] = {
+        MODE_HOOKS(drift), MODE_TEMPO(drift), MODE_MOD(drift), MODE_STATE(drift),
+        .next_wake_us = mode_drift_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_DRIFT] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(12)
+    [MODE_FILL] = {
+        MODE_HOOKS(fill), MODE_TEMPO(fill), MODE_MOD(fill), MODE_STATE(fill),
+        .next_wake_us = mode_fill_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_FILL] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(13)
+    [MODE_SKIP] = {
+        MODE_HOOKS(skip), MODE_TEMPO(skip), MODE_MOD(skip), MODE_STATE(skip),
+        .next_wake_us = mode_skip_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_SKIP] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(14)
+    [MODE_STUTTER] = {
+        MODE_HOOKS(stutter), MODE_TEMPO(stutter), MODE_MOD(stutter), MODE_STATE(stutter),
+        .next_wake_us = mode_stutter_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_STUTTER] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(15)
+    [MODE_MORPH] = {
+        MODE_HOOKS(morph), MODE_TEMPO(morph), MODE_MOD(morph), MODE_STATE(morph),
+        .next_wake_us = mode_morph_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_MORPH] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(16)
+    [MODE_MUTE] = {
+        MODE_HOOKS(mute), MODE_TEMPO(mute), MODE_MOD(mute), MODE_STATE(mute),
+        .next_wake_us = mode_mute_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_MUTE] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(17)
+    [MODE_DENSITY] = {
+        MODE_HOOKS(density), MODE_TEMPO(density), MODE_MOD(density), MODE_STATE(density),
+        .next_wake_us = mode_density_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_DENSITY] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(18)
+    [MODE_SONG] = {
+        MODE_HOOKS(song), MODE_TEMPO(song), MODE_MOD(song), MODE_STATE(song),
+        .next_wake_us = mode_song_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_SONG] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(19)
+    [MODE_ACCUMULATE] = {
+        MODE_HOOKS(accumulate), MODE_TEMPO(accumulate), MODE_MOD(accumulate), MODE_STATE(accumulate),
+        .next_wake_us = mode_accumulate_next_wake_us, .flags = MODE_FLAG_MOD_GESTURES
+    },
+#else
+    [MODE_ACCUMULATE] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(20)
+    [MODE_GAMMA_SEQUENTIAL_RESET] = {
+        MODE_HOOKS(gamma_sequential_reset), MODE_NO_TEMPO, MODE_MOD(gamma_sequential_reset), MODE_NO_STATE,
+        .next_wake_us = mode_wake_on_f1, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_SEQUENTIAL_RESET] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(21)
+    [MODE_GAMMA_SEQUENTIAL_FREEZE] = {
+        MODE_HOOKS(gamma_sequential_freeze), MODE_NO_TEMPO, MODE_MOD(gamma_sequential_freeze),
+        MODE_STATE(gamma_freeze),
+        .next_wake_us = mode_wake_on_f1, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_SEQUENTIAL_FREEZE] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(22)
+    [MODE_GAMMA_SEQUENTIAL_TRIP] = {
+        MODE_HOOKS(gamma_sequential_trip), MODE_NO_TEMPO, MODE_MOD(gamma_sequential_trip),
+        MODE_STATE(gamma_trip),
+        .next_wake_us = mode_wake_on_f1, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_SEQUENTIAL_TRIP] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(23)
+    [MODE_GAMMA_SEQUENTIAL_FIRE] = {
+        MODE_HOOKS(gamma_sequential_fire), MODE_NO_TEMPO, MODE_MOD(gamma_sequential_fire), MODE_NO_STATE,
+        .next_wake_us = mode_wake_on_f1, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_SEQUENTIAL_FIRE] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(24)
+    [MODE_GAMMA_SEQUENTIAL_BOUNCE] = {
+        MODE_HOOKS(gamma_sequential_bounce), MODE_NO_TEMPO, MODE_MOD(gamma_sequential_bounce), MODE_NO_STATE,
+        .next_wake_us = mode_gamma_sequential_bounce_next_wake_us,
+        .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_SEQUENTIAL_BOUNCE] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(25)
+    [MODE_GAMMA_PORTALS] = {
+        MODE_HOOKS(gamma_portals), MODE_TEMPO(gamma_portals), MODE_MOD(gamma_portals),
+        MODE_HOT_STATE(gamma_portals),
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_PORTALS] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(26)
+    [MODE_GAMMA_COIN_TOSS] = {
+        MODE_HOOKS(gamma_coin_toss), MODE_NO_TEMPO, MODE_MOD(gamma_coin_toss), MODE_HOT_STATE(gamma_coin_toss),
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_COIN_TOSS] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(27)
+    [MODE_GAMMA_RATCHET] = {
+        MODE_HOOKS(gamma_ratchet), MODE_TEMPO(gamma_ratchet), MODE_MOD(gamma_ratchet),
+        MODE_HOT_STATE(gamma_ratchet),
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_RATCHET] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(28)
+    [MODE_GAMMA_ANTI_RATCHET] = {
+        MODE_HOOKS(gamma_anti_ratchet), MODE_TEMPO(gamma_anti_ratchet), MODE_MOD(gamma_anti_ratchet),
+        MODE_HOT_STATE(gamma_anti_ratchet),
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_ANTI_RATCHET] = MODE_DISABLED,
+#endif
+#if KRONO_MODE_ENABLED(29)
+    [MODE_GAMMA_START_STOP] = {
+        MODE_HOOKS(gamma_start_stop), MODE_TEMPO(gamma_start_stop), MODE_MOD(gamma_start_stop),
+        MODE_HOT_STATE(gamma_start_stop),
+        .next_wake_us = mode_wake_now, .flags = MODE_FLAG_MOD_GESTURES | MODE_FLAG_OWNS_1AB
+    },
+#else
+    [MODE_GAMMA_START_STOP] = MODE_DISABLED,
+#endif
 };
 
+void mode_dispatch_mod_press(operational_mode_t op, mod_press_event_t ev, uint32_t ts_ms) {
+    mode_descriptor(op)->on_mod_press(ev, ts_ms);
+}
 
-/**
- * @brief Resets the state of the currently active mode.
- * @param mode The operational mode to reset.
- */
-void mode_reset_current(operational_mode_t mode) {
-    if (mode < NUM_OPERATIONAL_MODES) {
-        if (mode_reset_functions[mode] != NULL) {
-            mode_reset_functions[mode]();
-        }
+uint32_t mode_rescale_deadline(uint32_t deadline_ms, uint32_t now_ms,
+                               uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    if (deadline_ms == 0 || old_interval_ms == 0 || deadline_ms <= now_ms) {
+        return deadline_ms;
     }
+    uint64_t remaining = ((uint64_t)(deadline_ms - now_ms) * new_interval_ms) / old_interval_ms;
+    if (remaining > MAX_INTERVAL) {
+        remaining = MAX_INTERVAL;
+    }
+    uint32_t rescaled = now_ms + (uint32_t)remaining;
+    return (rescaled == 0) ? 1 : rescaled; // 0 means "unscheduled" to the modes
 }
 
-/**
- * @brief Initializes the state of the currently active mode.
- * @param mode The operational mode to initialize.
- */
-void mode_init_current(operational_mode_t mode) {
-    if (mode < NUM_OPERATIONAL_MODES) {
-        if (mode_init_functions[mode] != NULL) {
-            mode_init_functions[mode]();
-        }
+uint32_t mode_rescale_elapsed(uint32_t since_ms, uint32_t now_ms,
+                              uint32_t old_interval_ms, uint32_t new_interval_ms) {
+    if (old_interval_ms == 0) {
+        return since_ms;
+    }
+    uint64_t elapsed = ((uint64_t)(now_ms - since_ms) * new_interval_ms) / old_interval_ms;
+    if (elapsed > now_ms) {
+        elapsed = now_ms;
     }
+    return now_ms - (uint32_t)elapsed;
 }
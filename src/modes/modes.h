@@ -60,10 +60,26 @@ typedef enum {
 
 // --- Structs ---
 
+#define MODE_TIMING_SWING_STEPS 51 // Swing offsets for 50..100 percent
+
+// Values derived from the tempo interval. Owned by the Clock Manager and rebuilt only when the
+// tempo changes, so mode updates read them instead of dividing on every loop.
+typedef struct {
+    uint32_t interval_ms;  // Tempo interval the table was built from (0 = no tempo)
+    uint32_t interval_us;  // interval_ms * 1000, for io_burst() spans
+    uint32_t generation;   // Bumped on every rebuild (never 0); lets modes key their own caches
+    bool valid;            // interval_ms within MIN_INTERVAL..MAX_INTERVAL
+    uint32_t clamped_ms;   // interval_ms clamped to MIN_INTERVAL..MAX_INTERVAL
+    uint32_t half_ms;      // clamped_ms / 2, floored at MIN_INTERVAL
+    uint32_t double_ms;    // clamped_ms * 2, capped at MAX_INTERVAL
+    uint32_t swing_offset_ms[MODE_TIMING_SWING_STEPS]; // (percent - 50) * interval / 100, by percent - 50
+} mode_timing_t;
+
 // Structure to pass context from Clock Manager to the active mode's update function.
 typedef struct {
     uint32_t current_time_ms;       // Current system time in milliseconds
     uint32_t current_tempo_interval_ms; // Current tempo interval in milliseconds
+    const mode_timing_t *timing;    // Values derived from current_tempo_interval_ms
     calculation_mode_t calc_mode;   // Current calculation mode (Normal/Swapped)
     bool calc_mode_changed;         // True if calc_mode changed since the last update
     bool f1_rising_edge;            // True if the base F1 clock just ticked (rising edge)
@@ -77,17 +93,13 @@ typedef struct {
 // --- Common Mode Function Prototypes ---
 // These allow main.c or other modules to interact with the modes generically.
 
-/**
- * @brief Resets the state of the currently active mode.
- * @param mode The operational mode to reset.
- */
-void mode_reset_current(operational_mode_t mode);
+/** @brief Deadline moved so that (deadline - now) scales by new/old; past and 0 (unscheduled) deadlines are kept. */
+uint32_t mode_rescale_deadline(uint32_t deadline_ms, uint32_t now_ms,
+                               uint32_t old_interval_ms, uint32_t new_interval_ms);
 
-/**
- * @brief Initializes the state of the newly selected mode.
- * @param mode The operational mode to initialize.
- */
-void mode_init_current(operational_mode_t mode);
+/** @brief Reference time moved so that (now - since) scales by new/old. */
+uint32_t mode_rescale_elapsed(uint32_t since_ms, uint32_t now_ms,
+                              uint32_t old_interval_ms, uint32_t new_interval_ms);
 
 // Specific mode function prototypes (implementations are in mode_xxx.c)
 
@@ -105,6 +117,7 @@ void mode_euclidean_reset(void);
 void mode_musical_init(void);
 void mode_musical_update(const mode_context_t* context);
 void mode_musical_reset(void);
+void mode_musical_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 
 // Mode Probabilistic
 void mode_probabilistic_init(void);
@@ -120,11 +133,13 @@ void mode_sequential_reset(void);
 void mode_swing_init(void);
 void mode_swing_update(const mode_context_t* context);
 void mode_swing_reset(void);
+void mode_swing_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 
 // Mode Polyrhythm
 void mode_polyrhythm_init(void);
 void mode_polyrhythm_update(const mode_context_t* context);
 void mode_polyrhythm_reset(void);
+void mode_polyrhythm_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 
 // Mode Logic Gates
 void mode_logic_init(void);
@@ -145,77 +160,98 @@ void mode_chaos_reset(void);
 void mode_fixed_init(void);
 void mode_fixed_update(const mode_context_t* context);
 void mode_fixed_reset(void);
+void mode_fixed_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
+void mode_fixed_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_fixed_next_wake_us(uint32_t now_us);
 
 // Modes 12–20 (rhythm pattern + short MOD)
 void mode_drift_init(void);
 void mode_drift_update(const mode_context_t *context);
 void mode_drift_reset(void);
+void mode_drift_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_drift_reset_step(void);
 void mode_drift_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_drift_next_wake_us(uint32_t now_us);
 void mode_drift_set_state(bool active, uint8_t probability, bool ramp_up);
 void mode_drift_get_state(bool *active, uint8_t *probability, bool *ramp_up);
 
 void mode_fill_init(void);
 void mode_fill_update(const mode_context_t *context);
 void mode_fill_reset(void);
+void mode_fill_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_fill_reset_step(void);
 void mode_fill_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_fill_next_wake_us(uint32_t now_us);
 void mode_fill_set_state(uint8_t density, bool ramp_up);
 void mode_fill_get_state(uint8_t *density, bool *ramp_up);
 
 void mode_skip_init(void);
 void mode_skip_update(const mode_context_t *context);
 void mode_skip_reset(void);
+void mode_skip_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_skip_reset_step(void);
 void mode_skip_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_skip_next_wake_us(uint32_t now_us);
 void mode_skip_set_state(bool active, uint8_t probability, bool ramp_up);
 void mode_skip_get_state(bool *active, uint8_t *probability, bool *ramp_up);
 
 void mode_stutter_init(void);
 void mode_stutter_update(const mode_context_t *context);
 void mode_stutter_reset(void);
+void mode_stutter_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_stutter_reset_step(void);
 void mode_stutter_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_stutter_next_wake_us(uint32_t now_us);
 void mode_stutter_set_state(bool active, uint8_t length, bool ramp_up, const uint16_t *variation_mask);
 void mode_stutter_get_state(bool *active, uint8_t *length, bool *ramp_up, uint16_t *variation_mask);
 
 void mode_morph_init(void);
 void mode_morph_update(const mode_context_t *context);
 void mode_morph_reset(void);
+void mode_morph_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_morph_reset_step(void);
 void mode_morph_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_morph_next_wake_us(uint32_t now_us);
 void mode_morph_set_state(bool frozen, uint32_t generation, const uint16_t *morphed);
 void mode_morph_get_state(bool *frozen, uint32_t *generation, uint16_t *morphed);
 
 void mode_mute_init(void);
 void mode_mute_update(const mode_context_t *context);
 void mode_mute_reset(void);
+void mode_mute_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_mute_reset_step(void);
 void mode_mute_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_mute_next_wake_us(uint32_t now_us);
 void mode_mute_set_state(uint16_t muted_mask, uint8_t mute_count, bool ramp_up, const uint16_t *variation_mask);
 void mode_mute_get_state(uint16_t *muted_mask, uint8_t *mute_count, bool *ramp_up, uint16_t *variation_mask);
 
 void mode_density_init(void);
 void mode_density_update(const mode_context_t *context);
 void mode_density_reset(void);
+void mode_density_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_density_reset_step(void);
 void mode_density_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_density_next_wake_us(uint32_t now_us);
 void mode_density_set_state(uint8_t density_pct, bool ramp_up);
 void mode_density_get_state(uint8_t *density_pct, bool *ramp_up);
 
 void mode_song_init(void);
 void mode_song_update(const mode_context_t *context);
 void mode_song_reset(void);
+void mode_song_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_song_reset_step(void);
 void mode_song_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_song_next_wake_us(uint32_t now_us);
 void mode_song_set_state(uint32_t variation_seed, bool variation_pending);
 void mode_song_get_state(uint32_t *variation_seed, bool *variation_pending);
 
 void mode_accumulate_init(void);
 void mode_accumulate_update(const mode_context_t *context);
 void mode_accumulate_reset(void);
+void mode_accumulate_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_accumulate_reset_step(void);
 void mode_accumulate_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_accumulate_next_wake_us(uint32_t now_us);
 void mode_accumulate_set_state(uint8_t active_count, bool add_pending, uint16_t active_mask,
                                const uint8_t *phase_offsets, const uint16_t *variation_masks);
 void mode_accumulate_get_state(uint8_t *active_count, bool *add_pending, uint16_t *active_mask,
@@ -249,10 +285,12 @@ void mode_gamma_sequential_bounce_init(void);
 void mode_gamma_sequential_bounce_update(const mode_context_t *context);
 void mode_gamma_sequential_bounce_reset(void);
 void mode_gamma_sequential_bounce_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
+uint32_t mode_gamma_sequential_bounce_next_wake_us(uint32_t now_us);
 
 void mode_gamma_portals_init(void);
 void mode_gamma_portals_update(const mode_context_t *context);
 void mode_gamma_portals_reset(void);
+void mode_gamma_portals_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_gamma_portals_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
 void mode_gamma_portals_set_state(bool multiply_mode);
 void mode_gamma_portals_get_state(bool *multiply_mode);
@@ -267,6 +305,7 @@ void mode_gamma_coin_toss_get_state(bool *invert_probabilities);
 void mode_gamma_ratchet_init(void);
 void mode_gamma_ratchet_update(const mode_context_t *context);
 void mode_gamma_ratchet_reset(void);
+void mode_gamma_ratchet_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_gamma_ratchet_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
 void mode_gamma_ratchet_set_state(bool double_speed);
 void mode_gamma_ratchet_get_state(bool *double_speed);
@@ -274,6 +313,7 @@ void mode_gamma_ratchet_get_state(bool *double_speed);
 void mode_gamma_anti_ratchet_init(void);
 void mode_gamma_anti_ratchet_update(const mode_context_t *context);
 void mode_gamma_anti_ratchet_reset(void);
+void mode_gamma_anti_ratchet_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_gamma_anti_ratchet_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
 void mode_gamma_anti_ratchet_set_state(bool half_speed);
 void mode_gamma_anti_ratchet_get_state(bool *half_speed);
@@ -281,17 +321,61 @@ void mode_gamma_anti_ratchet_get_state(bool *half_speed);
 void mode_gamma_start_stop_init(void);
 void mode_gamma_start_stop_update(const mode_context_t *context);
 void mode_gamma_start_stop_reset(void);
+void mode_gamma_start_stop_on_tempo_change(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
 void mode_gamma_start_stop_on_mod_press(mod_press_event_t ev, uint32_t ts_ms);
 void mode_gamma_start_stop_set_state(bool muted);
 void mode_gamma_start_stop_get_state(bool *muted);
 
-/** True for modes 12–20 and Gamma family: MOD short-press → mode_*_on_mod_press (not calc/fixed swap). */
-#define MODE_USES_MOD_GESTURES(m) \
-    (((int)(m) >= (int)MODE_DRIFT && (int)(m) <= (int)MODE_ACCUMULATE) || \
-     ((int)(m) >= (int)MODE_GAMMA_SEQUENTIAL_RESET && (int)(m) < (int)NUM_OPERATIONAL_MODES))
+// --- Mode Descriptors ---
+// One const (flash) entry per op mode; the Clock Manager, MOD routing and saved-state code dispatch
+// through it. Every hook is set (no-op stubs where a mode has nothing to do), so callers never test
+// for NULL.
+
+struct krono_state_s; // drivers/persistence.h
 
-/** Gamma: internal F1 timing stays; 1A/1B are not driven as the automatic base-clock mirror. */
-#define MODE_SKIPS_AUTO_F1_CLOCK_ON_1AB(m) ((int)(m) >= (int)MODE_GAMMA_SEQUENTIAL_RESET)
+#define MODE_FLAG_MOD_GESTURES      (1u << 0) // Short MOD / PB4 go to on_mod_press, not calc or bank swap
+#define MODE_FLAG_OWNS_1AB          (1u << 1) // Internal F1 timing stays; 1A/1B are not the automatic mirror
+#define MODE_FLAG_SKIP_FIRST_UPDATE (1u << 2) // First update after the mode is selected is skipped
+#define MODE_FLAG_DISABLED          (1u << 3) // Left out of this build (KRONO_MODES_ENABLED)
+
+#define MODE_WAKE_NOW   0u         // next_wake_us: update on every Clock Manager pass
+#define MODE_WAKE_ON_F1 UINT32_MAX // next_wake_us: only F1 edges, calc swaps and sync requests
+
+typedef struct {
+    void (*init)(void);
+    void (*update)(const mode_context_t *context);
+    void (*reset)(void);
+    /** Remap pending deadlines after a tempo change (see mode_rescale_deadline()). */
+    void (*on_tempo_change)(uint32_t now_ms, uint32_t old_interval_ms, uint32_t new_interval_ms);
+    void (*on_mod_press)(mod_press_event_t ev, uint32_t ts_ms);
+    /** Hydrate the runtime from the saved state (after init/reset). */
+    void (*apply_state)(const struct krono_state_s *state);
+    /** Copy the runtime into the saved state. */
+    void (*capture_state)(struct krono_state_s *state);
+    /** Copy only the fields mirrored to the RTC backup registers (Gamma toggles 26–30). */
+    void (*capture_hot)(struct krono_state_s *state);
+    /** Microseconds (io_now_us()) until the mode next needs an update besides F1 edges, calc swaps
+     *  and sync requests; MODE_WAKE_NOW or MODE_WAKE_ON_F1. A mode skipped in between does not see
+     *  the skipped ms_since_last_call time. */
+    uint32_t (*next_wake_us)(uint32_t now_us);
+    uint8_t flags;      // MODE_FLAG_*
+} mode_descriptor_t;
+
+extern const mode_descriptor_t mode_descriptors[NUM_OPERATIONAL_MODES];
+
+/** Descriptor of @p mode; out-of-range values get MODE_DEFAULT's. */
+static inline const mode_descriptor_t *mode_descriptor(operational_mode_t mode) {
+    return &mode_descriptors[((unsigned)mode < NUM_OPERATIONAL_MODES) ? mode : MODE_DEFAULT];
+}
+
+static inline bool mode_has_flag(operational_mode_t mode, uint8_t flag) {
+    return (mode_descriptor(mode)->flags & flag) != 0u;
+}
+
+/** In range and built into this image. */
+static inline bool mode_is_enabled(operational_mode_t mode) {
+    return (unsigned)mode < NUM_OPERATIONAL_MODES && !(mode_descriptors[mode].flags & MODE_FLAG_DISABLED);
+}
 
 void mode_dispatch_mod_press(operational_mode_t op, mod_press_event_t ev, uint32_t ts_ms);
 
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#include <libopencm3/cm3/scs.h>
+#include <libopencm3/cm3/dwt.h>
+
+/* Cortex-M4 DWT cycle counter: free-running at the core clock, wraps every ~51 s at 84 MHz.
+ * Use differences only (unsigned subtraction is wrap-safe). */
+
+/**
+ * @brief Start the cycle counter if it is not running. Never clears it, so
+ * independent users (tap timing, boot profile) can share it.
+ */
+static inline void cycle_counter_enable(void) {
+    SCS_DEMCR |= SCS_DEMCR_TRCENA;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t cycle_counter_now(void) {
+    return DWT_CYCCNT;
+}
@@ -0,0 +1,5 @@
+#include "cycle_profile.h"
+
+#if KRONO_CYCLE_PROFILE
+volatile cycle_profile_entry_t g_cycle_profile[NUM_CYCLE_PROFILE_SLOTS];
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * Per-function cycle counts for the hot paths, compiled in with -DKRONO_CYCLE_PROFILE=1.
+ * Read g_cycle_profile with a debugger; compare builds with KRONO_RAM_HOT_PATHS=0/1.
+ */
+#ifndef KRONO_CYCLE_PROFILE
+#define KRONO_CYCLE_PROFILE 0
+#endif
+
+typedef enum {
+    CYCLE_PROFILE_PULSE_TIMER_ISR = 0,
+    CYCLE_PROFILE_EXT_CLOCK_IRQ,
+    CYCLE_PROFILE_CLOCK_MANAGER_UPDATE,
+    CYCLE_PROFILE_MODE_UPDATE,
+    NUM_CYCLE_PROFILE_SLOTS
+} cycle_profile_slot_t;
+
+typedef struct {
+    uint32_t last;
+    uint32_t max;
+    uint32_t count;
+} cycle_profile_entry_t;
+
+#if KRONO_CYCLE_PROFILE
+#include "cycle_counter.h"
+
+extern volatile cycle_profile_entry_t g_cycle_profile[NUM_CYCLE_PROFILE_SLOTS];
+
+static inline void cycle_profile_record(cycle_profile_slot_t slot, uint32_t cycles) {
+    g_cycle_profile[slot].last = cycles;
+    if (cycles > g_cycle_profile[slot].max) g_cycle_profile[slot].max = cycles;
+    g_cycle_profile[slot].count++;
+}
+
+#define CYCLE_PROFILE_BEGIN(slot) uint32_t cycle_profile_start_##slot = cycle_counter_now()
+#define CYCLE_PROFILE_END(slot) cycle_profile_record(slot, cycle_counter_now() - cycle_profile_start_##slot)
+#else
+#define CYCLE_PROFILE_BEGIN(slot) do { } while (0)
+#define CYCLE_PROFILE_END(slot) do { } while (0)
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * KRONO_RAMFUNC places a function in SRAM. The libopencm3 linker script
+ * (cortex-m-generic.ld) links every `.ramtext*` input section into `.data`, so the
+ * startup code copies these functions to RAM together with initialized data.
+ * They run without flash wait states, and keep running while flash is erased or
+ * programmed as long as everything they call is in SRAM too. long_call: SRAM (0x2000_0000) is out of BL range from flash and back,
+ * so the attribute belongs on the prototype as well as on the definition.
+ *
+ * Anything a RAM function calls must be RAM-resident or inlined as well; use direct
+ * register access instead of libopencm3 helpers in those paths.
+ *
+ * Build with -DKRONO_RAM_HOT_PATHS=0 to link everything from flash (baseline for
+ * KRONO_CYCLE_PROFILE comparisons).
+ */
+#ifndef KRONO_RAM_HOT_PATHS
+#define KRONO_RAM_HOT_PATHS 1
+#endif
+
+#if KRONO_RAM_HOT_PATHS
+#define KRONO_RAMFUNC __attribute__((section(".ramtext.krono"), long_call, noinline))
+#else
+#define KRONO_RAMFUNC
+#endif
@@ -11,6 +11,84 @@
 /** @brief Default duration (ms) for all output pulses (1A/B and Mode Outputs). */
 #define DEFAULT_PULSE_DURATION_MS 10
 
+/** @brief Default trigger width (us) used by io_trigger(). */
+#define DEFAULT_PULSE_WIDTH_US ((uint32_t)DEFAULT_PULSE_DURATION_MS * 1000u)
+
+/** @brief Default duty (% of the jack's own trigger interval). 0 = fixed width. */
+#define DEFAULT_PULSE_DUTY_PERCENT 0
+
+/**
+ * @brief Per-jack trigger width (us), in jack order 1A…6A, 1B…6B. Loaded by pulse_timer_init();
+ *        io_set_pulse_width_us() changes a jack at runtime.
+ */
+#define JACK_PULSE_WIDTH_US { \
+    DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, \
+    DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, \
+    DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, \
+    DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US, DEFAULT_PULSE_WIDTH_US }
+
+/**
+ * @brief Per-jack duty (%, 0 = use the width above; capped at IO_DUTY_MAX_PERCENT), same order.
+ *        A non-zero entry turns that jack into a gate following its own trigger interval.
+ */
+#define JACK_PULSE_DUTY_PERCENT { \
+    DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, \
+    DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, \
+    DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, \
+    DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT, DEFAULT_PULSE_DUTY_PERCENT }
+
+/** @brief Fixed-width pulses are shortened to this % of the jack's trigger interval so fast multiples never overlap. */
+#define PULSE_MAX_PERIOD_PERCENT 50
+
+/** @brief Minimum LOW time (us) forced between two pulses on one jack; a retrigger while HIGH rises again after it. */
+#define PULSE_MIN_LOW_GAP_US 500u
+
+/** @brief Pulses per beat on 1A/1B (build-time): 1 = one F1 trigger, 24/48 = DIN-sync style clock (timer-driven burst). */
+#define F1_OUTPUT_PPQN 1
+#if F1_OUTPUT_PPQN < 1 || F1_OUTPUT_PPQN > 255
+#error "F1_OUTPUT_PPQN must be 1..255"
+#endif
+
+// --- External Clock Input (PB3) ---
+
+/** @brief Input resolution on PB3 in pulses per beat (build-time): 1, 4, 24 or 48. */
+#define EXT_CLOCK_INPUT_PPQN 1
+#if EXT_CLOCK_INPUT_PPQN != 1 && EXT_CLOCK_INPUT_PPQN != 4 && EXT_CLOCK_INPUT_PPQN != 24 && EXT_CLOCK_INPUT_PPQN != 48
+#error "EXT_CLOCK_INPUT_PPQN must be 1, 4, 24 or 48"
+#endif
+
+/** @brief Edges closer than this (us) after the previous one are treated as glitches and ignored. */
+#define EXT_CLOCK_GLITCH_US 250u
+
+/** @brief An edge interval deviating more than this % from the running mean restarts the tempo window. */
+#define EXT_CLOCK_MAX_EDGE_DEVIATION_PERCENT 25u
+
+/** @brief Clock loss is declared after this many missed input periods (measured edge spacing). */
+#define EXT_CLOCK_LOSS_MISSED_PERIODS 3u
+
+/** @brief Added to the adaptive loss timeout (ms) to absorb ISR/main-loop latency. */
+#define EXT_CLOCK_LOSS_MARGIN_MS 5u
+
+/** @brief On relock the beat phase error is slewed by at most interval / this per beat (no phase jump). */
+#define EXT_CLOCK_PHASE_SLEW_DIVISOR 8u
+
+// --- Chaos Mode Integrator ---
+
+/** @brief Lorenz integration step (us of output time). One RK4 step per step, whatever the loop rate. */
+#define CHAOS_STEP_US 1000u
+
+/** @brief How far ahead of now the trajectory is integrated, so interpolated crossings can still be
+ *         scheduled at their exact time on the pulse timer. Should cover one main-loop pass. */
+#define CHAOS_LOOKAHEAD_US 2000u
+
+/** @brief Backlog (steps) beyond which the integrator skips ahead instead of catching up. */
+#define CHAOS_MAX_CATCHUP_STEPS 100u
+
+// --- Rhythm Modes (11-20) ---
+
+/** @brief Pattern steps per F1 beat for the 16-step rhythm modes (1, 2, 4, 8 or 16; 4 = sixteenths). */
+#define MODE_RHYTHM_STEPS_PER_BEAT 4u
+
 // --- Calculation Mode Persistence Configuration ---
 
 /** @brief Define as 1 to save Calculation Mode (swap state) per Operational Mode.
@@ -67,6 +145,23 @@
 /** @brief Time window (ms) after the LAST Mode press (while Tap is held) to wait for another Mode press before finalizing Op Mode selection. */
 #define OP_MODE_MULTI_PRESS_WINDOW_MS 500
 
+/** @brief Every op mode as a bit mask (bit n = operational_mode_t n, user mode n + 1). */
+#define KRONO_MODES_ALL 0x3FFFFFFFu
+
+/** @brief Op modes built into the image (build with -DKRONO_MODES_ENABLED=<mask> for a smaller one).
+ *         Left-out modes cannot be selected and nothing references their code, so the linker drops it
+ *         (PlatformIO builds with -ffunction-sections and --gc-sections); Default is always built. */
+#ifndef KRONO_MODES_ENABLED
+#define KRONO_MODES_ENABLED KRONO_MODES_ALL
+#endif
+
+/**
+ * @brief 1 if op mode n is built. n is the 0-based operational_mode_t index (user mode n+1), written
+ * as a plain number because enum names are not visible to #if; the modes.c comments give 1-based
+ * user mode numbers.
+ */
+#define KRONO_MODE_ENABLED(n) ((((KRONO_MODES_ENABLED) | 1u) >> (n)) & 1u)
+
 // --- Calc Mode Swap Timing ---
 
 /** @brief Max duration (ms) for a MODE (PA1) press to be considered a 'short press' for Calc Mode Swap. */
@@ -80,5 +175,13 @@
 /** @brief Minimum time (ms) between consecutive saves to Flash to reduce wear. */
 #define SAVE_STATE_COOLDOWN_MS 1000
 
+/** @brief PVD level select (PWR_CR PLS, 0..7 = 2.2 V..2.9 V in 0.1 V steps). The emergency save
+ *         starts below this level; keep it at the top so x32 flash programming (>= 2.7 V) finishes. */
+#define POWER_FAIL_PVD_PLS 7
+
+/** @brief Flash log slots that must stay blank after a boot-time compaction check; fewer free slots
+ *         than this triggers a sector erase at boot, never during performance. */
+#define PERSISTENCE_MIN_FREE_SLOTS_AT_BOOT 8
+
 
 #endif // VARIABLES_H